@@ -85,6 +85,21 @@
 #define LV_REFR_PERIOD      30
 #endif
 
+/* Refresh the screen synchronized to the vertical sync or tearing effect (TE) signal of the display.
+ * Call `lv_refr_vsync()` on the signal (e.g. from an interrupt). The refreshing starts right after it
+ * and happens at most once per vsync. See `lv_refr_get_vsync_stat()` for the frame timing statistics.*/
+#ifndef USE_LV_VSYNC
+#define USE_LV_VSYNC        0
+#endif
+
+/* Time budget of a refresh in milliseconds. If it's used up the refreshing stops after the current VDB part
+ * and continues in the next `lv_task_handler` cycle so the input devices and the other tasks can run meanwhile.
+ * The areas closest to the last input (pressed point or focused object) are refreshed first.
+ * 0: refresh the whole frame at once. Not used with LV_VDB_TRUE_DOUBLE_BUFFERED*/
+#ifndef LV_REFR_BUDGET
+#define LV_REFR_BUDGET      0
+#endif
+
 /*-----------------
  *  VDB settings
  *----------------*/
@@ -104,9 +119,16 @@
 #endif
 
  /* Bit-per-pixel of VDB. Useful for monochrome or non-standard color format displays.
-  * Special formats are handled with `disp_drv.vdb_wr`)*/
+  * With 1, 2 or 4 the VDB stores gray levels (0: black) packed into bytes and `disp_drv.disp_flush` gets them.
+  * Other special formats are handled with `disp_drv.vdb_wr`)*/
 #ifndef LV_VDB_PX_BPP
-#define LV_VDB_PX_BPP       LV_COLOR_SIZE       /*LV_COLOR_SIZE comes from LV_COLOR_DEPTH below to set 8, 16 or 32 bit pixel size automatically */
+#define LV_VDB_PX_BPP       LV_COLOR_SIZE       /*LV_COLOR_SIZE comes from LV_COLOR_DEPTH below to set 8, 16, 24 or 32 bit pixel size automatically */
+#endif
+#ifndef LV_VDB_PX_MSB_FIRST
+#define LV_VDB_PX_MSB_FIRST 1                   /*Packed VDB: 1: the first pixel is on the most significant bits of a byte; 0: on the least significant bits*/
+#endif
+#ifndef LV_VDB_PX_VERTICAL
+#define LV_VDB_PX_VERTICAL  0                   /*Packed VDB: 1: a byte holds pixels of a column (pages, e.g. SSD1306); 0: a byte holds pixels of a row*/
 #endif
 
  /* Place VDB to a specific address (e.g. in external RAM)
@@ -140,6 +162,47 @@
 #define LV_VDB_TRUE_DOUBLE_BUFFERED 0
 #endif
 
+/* With true double buffering the new frame buffer has the image of two frames ago.
+ * 0: copy the areas refreshed in the previous frame from the flushed frame buffer
+ * 1: repaint the areas of the previous frame together with the current ones (no copy, less memory traffic)*/
+#ifndef LV_VDB_TRUE_DOUBLE_REPAINT
+#define LV_VDB_TRUE_DOUBLE_REPAINT  0
+#endif
+
+/* Record the drawings of an invalid area once into a display list and replay it on every VDB part
+ * instead of calling the design functions of the objects again for every part.
+ * Useful if the VDB is much smaller than the invalidated areas.
+ * If the list becomes full the area is refreshed in the normal way.*/
+#ifndef LV_REFR_DISP_LIST
+#define LV_REFR_DISP_LIST       0
+#endif
+#ifndef LV_REFR_DISP_LIST_SIZE
+#define LV_REFR_DISP_LIST_SIZE  (4 * 1024)  /*Size of the display list in bytes*/
+#endif
+
+/* Convert the VDB to the pixel format of the display (`disp_drv.conv_fmt`) before `disp_drv.disp_flush`
+ * instead of converting it in the driver or swapping the bytes on every drawing (LV_COLOR_16_SWAP).
+ * The result is written to `disp_drv.conv_buf` so the VDB can be drawn again while it is sent.
+ * The built-in converters can be replaced with `lv_color_conv_set_cb()` (e.g. with SIMD versions)*/
+#ifndef USE_LV_FLUSH_CONV
+#define USE_LV_FLUSH_CONV       0           /*Requires VDB (LV_VDB_SIZE > 0)*/
+#endif
+
+/* Rotate the VDB by 90, 180 or 270 degrees (`disp_drv.rotated`) before `disp_drv.disp_flush`
+ * to drive a panel mounted in an other orientation. Drawing happens with LV_HOR_RES x LV_VER_RES.
+ * `lv_refr_set_round_cb` and the input devices get the coordinates of the panel.*/
+#ifndef USE_LV_DISP_ROT
+#define USE_LV_DISP_ROT         0           /*Requires VDB (LV_VDB_SIZE > 0)*/
+#endif
+
+/* Join the invalid areas if refreshing them together is cheaper than one by one, even if they don't overlap.
+ * The value is the cost of a `disp_flush` call (commands, window setting, DMA setup) in pixels.
+ * E.g. 200 if sending the window commands of a serial display takes as long as sending 200 pixels.
+ * 0: join only the overlapping areas if the joined area is smaller*/
+#ifndef LV_REFR_FLUSH_COST
+#define LV_REFR_FLUSH_COST      0
+#endif
+
 /*=================
    Misc. setting
  *=================*/
@@ -166,7 +229,7 @@
 
 /*Color settings*/
 #ifndef LV_COLOR_DEPTH
-#define LV_COLOR_DEPTH     16                     /*Color depth: 1/8/16/32*/
+#define LV_COLOR_DEPTH     16                     /*Color depth: 1/8/16/24/32*/
 #endif
 #ifndef LV_COLOR_16_SWAP
 #define LV_COLOR_16_SWAP   0                      /*Swap the 2 bytes of RGB565 color. Useful if the display has a 8 bit interface (e.g. SPI)*/
@@ -205,12 +268,39 @@
 #ifndef USE_LV_GROUP
 #define USE_LV_GROUP            1               /*1: Enable object groups (for keyboards)*/
 #endif
+#ifndef USE_LV_OVERLAY
+#define USE_LV_OVERLAY          0               /*1: Enable a cursor image drawn at flush time (see `lv_indev_set_cursor_img`). Requires VDB but not LV_VDB_TRUE_DOUBLE_BUFFERED*/
+#endif
+#if USE_LV_OVERLAY
+#ifndef LV_OVERLAY_MARGIN
+#define LV_OVERLAY_MARGIN       16              /*Pixels saved around the cursor image. Moves within it don't redraw the objects*/
+#endif
+#endif
+#ifndef USE_LV_QUALITY_GOV
+#define USE_LV_QUALITY_GOV      0               /*1: Skip the shadows and the rounded corners while animating or dragging if the frames are slow (see `lv_quality_get`)*/
+#endif
+#if USE_LV_QUALITY_GOV
+#ifndef LV_QUALITY_FRAME_TIME
+#define LV_QUALITY_FRAME_TIME   20              /*Target frame time in milliseconds. Slower frames reduce the quality while animating or dragging*/
+#endif
+#ifndef LV_QUALITY_RESTORE_DELAY
+#define LV_QUALITY_RESTORE_DELAY 100            /*Restore the full quality if nothing has moved for this many milliseconds (longer after premature restores)*/
+#endif
+#endif
 #ifndef USE_LV_GPU
 #define USE_LV_GPU              1               /*1: Enable GPU interface*/
 #endif
+#ifndef USE_LV_GPU_2D
+#define USE_LV_GPU_2D           0               /*1: Enable the 2D accelerator interface (`lv_disp_drv_t.acc`, requires LV_VDB_SIZE != 0). `lv_acc_sw_get()` is a software implementation of it.*/
+#endif
 #ifndef USE_LV_REAL_DRAW
 #define USE_LV_REAL_DRAW        1               /*1: Enable function which draw directly to the frame buffer instead of VDB (required if LV_VDB_SIZE = 0)*/
 #endif
+#if USE_LV_REAL_DRAW
+#ifndef LV_REAL_DRAW_SPAN_BUF
+#define LV_REAL_DRAW_SPAN_BUF   64              /*Max. pixels of a span (the size of the line buffer). Glyphs, anti-aliased edges and recolored images are written in spans (>= 1)*/
+#endif
+#endif
 #ifndef USE_LV_FILESYSTEM
 #define USE_LV_FILESYSTEM       1               /*1: Enable file system (might be required for images*/
 #endif
@@ -228,6 +318,9 @@
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN                  /* With size optimization (-Os) the compiler might not align data to 4 or 8 byte boundary. This alignment will be explicitly applied where needed.*/
 #endif
+#ifndef LV_ATTRIBUTE_PACKED
+#define LV_ATTRIBUTE_PACKED     __attribute__((packed))     /* Pack a struct or union without padding. Required by LV_COLOR_DEPTH 24 for 3 byte colors */
+#endif
 #ifndef LV_COMPILER_VLA_SUPPORTED
 #define LV_COMPILER_VLA_SUPPORTED            1  /* 1: Variable length array is supported*/
 #endif
@@ -248,6 +341,18 @@
 #endif
 #endif     /*LV_TICK_CUSTOM*/
 
+#ifndef LV_TICK_US_CUSTOM
+#define LV_TICK_US_CUSTOM  0                        /*1: use a microsecond time source for profiling, refresh monitor and animations (0: derive it from the ms tick)*/
+#endif
+#if LV_TICK_US_CUSTOM == 1
+#ifndef LV_TICK_US_CUSTOM_INCLUDE
+#define LV_TICK_US_CUSTOM_INCLUDE  "something.h"      /*Header for the microsecond time function*/
+#endif
+#ifndef LV_TICK_US_CUSTOM_SYS_TIME_EXPR
+#define LV_TICK_US_CUSTOM_SYS_TIME_EXPR (micros())  /*Expression evaluating to current time in us (e.g. from `clock_gettime` or a cycle counter)*/
+#endif
+#endif     /*LV_TICK_US_CUSTOM*/
+
 
 /*Log settings*/
 #ifndef USE_LV_LOG
@@ -270,6 +375,23 @@
 #endif
 #endif  /*USE_LV_LOG*/
 
+/*Trace settings*/
+#ifndef USE_LV_TRACE
+#define USE_LV_TRACE    0   /*1: Record refresh, design, task, flush and input device events into a binary ring buffer (time stamps from `lv_tick_get_us`)*/
+#endif
+#if USE_LV_TRACE
+#ifndef LV_TRACE_BUF_SIZE
+#  define LV_TRACE_BUF_SIZE   1024    /*Number of events to keep (12 bytes each). The oldest events are overwritten*/
+#endif
+#endif  /*USE_LV_TRACE*/
+
+#ifndef LV_SIGNAL_STAT
+#define LV_SIGNAL_STAT  0   /*1: Count the sent signals and the called signal functions per signal (and the sent signals per object type) in every refresh period (`lv_signal_get_sent_cnt`, `lv_signal_get_type_sent_cnt`)*/
+#endif
+#ifndef LV_VDB_FLUSH_STAT
+#define LV_VDB_FLUSH_STAT  0   /*1: Count the flushes and the flushed pixels and bytes in every refresh period (`lv_vdb_get_flush_cnt`)*/
+#endif
+
 /*================
  *  THEME USAGE
  *================*/
@@ -557,6 +679,9 @@
 #ifndef LV_PRELOAD_DEF_ANIM
 #  define LV_PRELOAD_DEF_ANIM         LV_PRELOAD_TYPE_SPINNING_ARC
 #endif
+#ifndef LV_PRELOAD_DEF_ANGLE_CACHE
+#  define LV_PRELOAD_DEF_ANGLE_CACHE  1       /*1: calculate the angles of the arc's pixels only once (needs radius^2 bytes RAM per pre loader)*/
+#endif
 #endif
 
 /*Canvas (dependencies: lv_img)*/
@@ -56,6 +56,17 @@
 /*Screen refresh period in milliseconds*/
 #define LV_REFR_PERIOD      30
 
+/* Refresh the screen synchronized to the vertical sync or tearing effect (TE) signal of the display.
+ * Call `lv_refr_vsync()` on the signal (e.g. from an interrupt). The refreshing starts right after it
+ * and happens at most once per vsync. See `lv_refr_get_vsync_stat()` for the frame timing statistics.*/
+#define USE_LV_VSYNC        0
+
+/* Time budget of a refresh in milliseconds. If it's used up the refreshing stops after the current VDB part
+ * and continues in the next `lv_task_handler` cycle so the input devices and the other tasks can run meanwhile.
+ * The areas closest to the last input (pressed point or focused object) are refreshed first.
+ * 0: refresh the whole frame at once. Not used with LV_VDB_TRUE_DOUBLE_BUFFERED*/
+#define LV_REFR_BUDGET      0
+
 /*-----------------
  *  VDB settings
  *----------------*/
@@ -73,8 +84,11 @@
 #define LV_VDB_SIZE         ((LV_VER_RES * LV_HOR_RES) / 10)
 
  /* Bit-per-pixel of VDB. Useful for monochrome or non-standard color format displays.
-  * Special formats are handled with `disp_drv.vdb_wr`)*/
-#define LV_VDB_PX_BPP       LV_COLOR_SIZE       /*LV_COLOR_SIZE comes from LV_COLOR_DEPTH below to set 8, 16 or 32 bit pixel size automatically */
+  * With 1, 2 or 4 the VDB stores gray levels (0: black) packed into bytes and `disp_drv.disp_flush` gets them.
+  * Other special formats are handled with `disp_drv.vdb_wr`)*/
+#define LV_VDB_PX_BPP       LV_COLOR_SIZE       /*LV_COLOR_SIZE comes from LV_COLOR_DEPTH below to set 8, 16, 24 or 32 bit pixel size automatically */
+#define LV_VDB_PX_MSB_FIRST 1                   /*Packed VDB: 1: the first pixel is on the most significant bits of a byte; 0: on the least significant bits*/
+#define LV_VDB_PX_VERTICAL  0                   /*Packed VDB: 1: a byte holds pixels of a column (pages, e.g. SSD1306); 0: a byte holds pixels of a row*/
 
  /* Place VDB to a specific address (e.g. in external RAM)
   * 0: allocate automatically into RAM
@@ -99,6 +113,35 @@
  */
 #define LV_VDB_TRUE_DOUBLE_BUFFERED 0
 
+/* With true double buffering the new frame buffer has the image of two frames ago.
+ * 0: copy the areas refreshed in the previous frame from the flushed frame buffer
+ * 1: repaint the areas of the previous frame together with the current ones (no copy, less memory traffic)*/
+#define LV_VDB_TRUE_DOUBLE_REPAINT  0
+
+/* Record the drawings of an invalid area once into a display list and replay it on every VDB part
+ * instead of calling the design functions of the objects again for every part.
+ * Useful if the VDB is much smaller than the invalidated areas.
+ * If the list becomes full the area is refreshed in the normal way.*/
+#define LV_REFR_DISP_LIST       0
+#define LV_REFR_DISP_LIST_SIZE  (4 * 1024)  /*Size of the display list in bytes*/
+
+/* Convert the VDB to the pixel format of the display (`disp_drv.conv_fmt`) before `disp_drv.disp_flush`
+ * instead of converting it in the driver or swapping the bytes on every drawing (LV_COLOR_16_SWAP).
+ * The result is written to `disp_drv.conv_buf` so the VDB can be drawn again while it is sent.
+ * The built-in converters can be replaced with `lv_color_conv_set_cb()` (e.g. with SIMD versions)*/
+#define USE_LV_FLUSH_CONV       0           /*Requires VDB (LV_VDB_SIZE > 0)*/
+
+/* Rotate the VDB by 90, 180 or 270 degrees (`disp_drv.rotated`) before `disp_drv.disp_flush`
+ * to drive a panel mounted in an other orientation. Drawing happens with LV_HOR_RES x LV_VER_RES.
+ * `lv_refr_set_round_cb` and the input devices get the coordinates of the panel.*/
+#define USE_LV_DISP_ROT         0           /*Requires VDB (LV_VDB_SIZE > 0)*/
+
+/* Join the invalid areas if refreshing them together is cheaper than one by one, even if they don't overlap.
+ * The value is the cost of a `disp_flush` call (commands, window setting, DMA setup) in pixels.
+ * E.g. 200 if sending the window commands of a serial display takes as long as sending 200 pixels.
+ * 0: join only the overlapping areas if the joined area is smaller*/
+#define LV_REFR_FLUSH_COST      0
+
 /*=================
    Misc. setting
  *=================*/
@@ -112,7 +155,7 @@
 #define LV_INDEV_LONG_PRESS_REP_TIME    100                    /*Repeated trigger period in long press [ms] */
 
 /*Color settings*/
-#define LV_COLOR_DEPTH     16                     /*Color depth: 1/8/16/32*/
+#define LV_COLOR_DEPTH     16                     /*Color depth: 1/8/16/24/32*/
 #define LV_COLOR_16_SWAP   0                      /*Swap the 2 bytes of RGB565 color. Useful if the display has a 8 bit interface (e.g. SPI)*/
 #define LV_COLOR_SCREEN_TRANSP        0           /*1: Enable screen transparency. Useful for OSD or other overlapping GUIs. Requires ARGB8888 colors*/
 #define LV_COLOR_TRANSP    LV_COLOR_LIME          /*Images pixels with this color will not be drawn (with chroma keying)*/
@@ -128,8 +171,21 @@
 #define USE_LV_ANIMATION        1               /*1: Enable all animations*/
 #define USE_LV_SHADOW           1               /*1: Enable shadows*/
 #define USE_LV_GROUP            1               /*1: Enable object groups (for keyboards)*/
+#define USE_LV_OVERLAY          0               /*1: Enable a cursor image drawn at flush time (see `lv_indev_set_cursor_img`). Requires VDB but not LV_VDB_TRUE_DOUBLE_BUFFERED*/
+#if USE_LV_OVERLAY
+#define LV_OVERLAY_MARGIN       16              /*Pixels saved around the cursor image. Moves within it don't redraw the objects*/
+#endif
+#define USE_LV_QUALITY_GOV      0               /*1: Skip the shadows and the rounded corners while animating or dragging if the frames are slow (see `lv_quality_get`)*/
+#if USE_LV_QUALITY_GOV
+#define LV_QUALITY_FRAME_TIME   20              /*Target frame time in milliseconds. Slower frames reduce the quality while animating or dragging*/
+#define LV_QUALITY_RESTORE_DELAY 100            /*Restore the full quality if nothing has moved for this many milliseconds (longer after premature restores)*/
+#endif
 #define USE_LV_GPU              1               /*1: Enable GPU interface*/
+#define USE_LV_GPU_2D           0               /*1: Enable the 2D accelerator interface (`lv_disp_drv_t.acc`, requires LV_VDB_SIZE != 0). `lv_acc_sw_get()` is a software implementation of it.*/
 #define USE_LV_REAL_DRAW        1               /*1: Enable function which draw directly to the frame buffer instead of VDB (required if LV_VDB_SIZE = 0)*/
+#if USE_LV_REAL_DRAW
+#define LV_REAL_DRAW_SPAN_BUF   64              /*Max. pixels of a span (the size of the line buffer). Glyphs, anti-aliased edges and recolored images are written in spans (>= 1)*/
+#endif
 #define USE_LV_FILESYSTEM       1               /*1: Enable file system (might be required for images*/
 #define USE_LV_MULTI_LANG       0               /* Number of languages for labels to store (0: to disable this feature)*/
 
@@ -137,6 +193,7 @@
 #define LV_ATTRIBUTE_TICK_INC                   /* Define a custom attribute to `lv_tick_inc` function */
 #define LV_ATTRIBUTE_TASK_HANDLER               /* Define a custom attribute to `lv_task_handler` function */
 #define LV_ATTRIBUTE_MEM_ALIGN                  /* With size optimization (-Os) the compiler might not align data to 4 or 8 byte boundary. This alignment will be explicitly applied where needed.*/
+#define LV_ATTRIBUTE_PACKED     __attribute__((packed))     /* Pack a struct or union without padding. Required by LV_COLOR_DEPTH 24 for 3 byte colors */
 #define LV_COMPILER_VLA_SUPPORTED            1  /* 1: Variable length array is supported*/
 #define LV_COMPILER_NON_CONST_INIT_SUPPORTED 1  /* 1: Initialization with non constant values are supported */
 
@@ -147,6 +204,12 @@
 #define LV_TICK_CUSTOM_SYS_TIME_EXPR (millis())     /*Expression evaluating to current systime in ms*/
 #endif     /*LV_TICK_CUSTOM*/
 
+#define LV_TICK_US_CUSTOM  0                        /*1: use a microsecond time source for profiling, refresh monitor and animations (0: derive it from the ms tick)*/
+#if LV_TICK_US_CUSTOM == 1
+#define LV_TICK_US_CUSTOM_INCLUDE  "something.h"      /*Header for the microsecond time function*/
+#define LV_TICK_US_CUSTOM_SYS_TIME_EXPR (micros())  /*Expression evaluating to current time in us (e.g. from `clock_gettime` or a cycle counter)*/
+#endif     /*LV_TICK_US_CUSTOM*/
+
 
 /*Log settings*/
 #define USE_LV_LOG      1   /*Enable/disable the log module*/
@@ -163,6 +226,15 @@
 #  define LV_LOG_PRINTF   0
 #endif  /*USE_LV_LOG*/
 
+/*Trace settings*/
+#define USE_LV_TRACE    0   /*1: Record refresh, design, task, flush and input device events into a binary ring buffer (time stamps from `lv_tick_get_us`)*/
+#if USE_LV_TRACE
+#  define LV_TRACE_BUF_SIZE   1024    /*Number of events to keep (12 bytes each). The oldest events are overwritten*/
+#endif  /*USE_LV_TRACE*/
+
+#define LV_SIGNAL_STAT  0   /*1: Count the sent signals and the called signal functions per signal (and the sent signals per object type) in every refresh period (`lv_signal_get_sent_cnt`, `lv_signal_get_type_sent_cnt`)*/
+#define LV_VDB_FLUSH_STAT  0   /*1: Count the flushes and the flushed pixels and bytes in every refresh period (`lv_vdb_get_flush_cnt`)*/
+
 /*================
  *  THEME USAGE
  *================*/
@@ -326,6 +398,7 @@
 #  define LV_PRELOAD_DEF_ARC_LENGTH   60      /*[deg]*/
 #  define LV_PRELOAD_DEF_SPIN_TIME    1000    /*[ms]*/
 #  define LV_PRELOAD_DEF_ANIM         LV_PRELOAD_TYPE_SPINNING_ARC
+#  define LV_PRELOAD_DEF_ANGLE_CACHE  1       /*1: calculate the angles of the arc's pixels only once (needs radius^2 bytes RAM per pre loader)*/
 #endif
 
 /*Canvas (dependencies: lv_img)*/
@@ -5,6 +5,9 @@ CSRCS += lv_refr.c
 CSRCS += lv_style.c
 CSRCS += lv_vdb.c
 CSRCS += lv_lang.c
+CSRCS += lv_signal.c
+CSRCS += lv_overlay.c
+CSRCS += lv_quality.c
 
 DEPPATH += --dep-path $(LVGL_DIR)/lvgl/lv_core
 VPATH += :$(LVGL_DIR)/lvgl/lv_core
@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_group.h"
+#include "lv_signal.h"
 #if USE_LV_GROUP != 0
 #include <stddef.h>
 
@@ -68,14 +69,14 @@ void lv_group_del(lv_group_t * group)
 {
     /*Defocus the the currently focused object*/
     if(group->obj_focus != NULL) {
-        (*group->obj_focus)->signal_func(*group->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
+        lv_signal_send(*group->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
         lv_obj_invalidate(*group->obj_focus);
     }
 
     /*Remove the objects from the group*/
     lv_obj_t ** obj;
     LL_READ(group->obj_ll, obj) {
-        (*obj)->group_p = NULL;
+        lv_obj_set_group(*obj, NULL);
     }
 
     lv_ll_clear(&(group->obj_ll));
@@ -92,15 +93,15 @@ void lv_group_add_obj(lv_group_t * group, lv_obj_t * obj)
     if(group == NULL) return;
 
     /*If the object is already in a group and focused then defocus it*/
-    if(obj->group_p) {
+    if(lv_obj_get_group(obj)) {
         if(lv_obj_is_focused(obj)) {
-            lv_group_refocus(obj->group_p);
+            lv_group_refocus(lv_obj_get_group(obj));
 
             LV_LOG_INFO("group: assign object to an other group");
         }
     }
 
-    obj->group_p = group;
+    lv_obj_set_group(obj, group);
     lv_obj_t ** next = lv_ll_ins_tail(&group->obj_ll);
     lv_mem_assert(next);
     if(next == NULL) return;
@@ -119,7 +120,7 @@ void lv_group_add_obj(lv_group_t * group, lv_obj_t * obj)
  */
 void lv_group_remove_obj(lv_obj_t * obj)
 {
-    lv_group_t * g = obj->group_p;
+    lv_group_t * g = lv_obj_get_group(obj);
     if(g == NULL) return;
     if(g->obj_focus == NULL) return;        /*Just to be sure (Not possible if there is at least one object in the group)*/
 
@@ -127,7 +128,7 @@ void lv_group_remove_obj(lv_obj_t * obj)
     if(*g->obj_focus == obj) {
         /*If this is the only object in the group then focus to nothing.*/
         if(lv_ll_get_head(&g->obj_ll) == g->obj_focus && lv_ll_get_tail(&g->obj_ll) == g->obj_focus) {
-            (*g->obj_focus)->signal_func(*g->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
+            lv_signal_send(*g->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
         }
         /*If there more objects in the group then focus to the next/prev object*/
         else {
@@ -147,7 +148,7 @@ void lv_group_remove_obj(lv_obj_t * obj)
         if(*i == obj) {
             lv_ll_rem(&g->obj_ll, i);
             lv_mem_free(i);
-            obj->group_p = NULL;
+            lv_obj_set_group(obj, NULL);
             break;
         }
     }
@@ -159,7 +160,7 @@ void lv_group_remove_obj(lv_obj_t * obj)
  */
 void lv_group_focus_obj(lv_obj_t * obj)
 {
-    lv_group_t * g = obj->group_p;
+    lv_group_t * g = lv_obj_get_group(obj);
     if(g == NULL) return;
 
     if(g->frozen != 0) return;
@@ -172,14 +173,14 @@ void lv_group_focus_obj(lv_obj_t * obj)
         if(*i == obj) {
             if(g->obj_focus == i) return;       /*Don't focus the already focused object again*/
             if(g->obj_focus != NULL) {
-                (*g->obj_focus)->signal_func(*g->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
+                lv_signal_send(*g->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
                 lv_obj_invalidate(*g->obj_focus);
             }
 
             g->obj_focus = i;
 
             if(g->obj_focus != NULL) {
-                (*g->obj_focus)->signal_func(*g->obj_focus, LV_SIGNAL_FOCUS, NULL);
+                lv_signal_send(*g->obj_focus, LV_SIGNAL_FOCUS, NULL);
                 if(g->focus_cb) g->focus_cb(g);
                 lv_obj_invalidate(*g->obj_focus);
 
@@ -200,7 +201,7 @@ void lv_group_focus_next(lv_group_t * group)
     if(group->frozen) return;
 
     if(group->obj_focus) {
-        (*group->obj_focus)->signal_func(*group->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
+        lv_signal_send(*group->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
         lv_obj_invalidate(*group->obj_focus);
     }
 
@@ -215,7 +216,7 @@ void lv_group_focus_next(lv_group_t * group)
     group->obj_focus = obj_next;
 
     if(group->obj_focus) {
-        (*group->obj_focus)->signal_func(*group->obj_focus, LV_SIGNAL_FOCUS, NULL);
+        lv_signal_send(*group->obj_focus, LV_SIGNAL_FOCUS, NULL);
         lv_obj_invalidate(*group->obj_focus);
 
         if(group->focus_cb) group->focus_cb(group);
@@ -234,7 +235,7 @@ void lv_group_focus_prev(lv_group_t * group)
     if(group->frozen) return;
 
     if(group->obj_focus) {
-        (*group->obj_focus)->signal_func(*group->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
+        lv_signal_send(*group->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
         lv_obj_invalidate(*group->obj_focus);
     }
 
@@ -249,7 +250,7 @@ void lv_group_focus_prev(lv_group_t * group)
     group->obj_focus = obj_next;
 
     if(group->obj_focus != NULL) {
-        (*group->obj_focus)->signal_func(*group->obj_focus, LV_SIGNAL_FOCUS, NULL);
+        lv_signal_send(*group->obj_focus, LV_SIGNAL_FOCUS, NULL);
         lv_obj_invalidate(*group->obj_focus);
 
         if(group->focus_cb) group->focus_cb(group);
@@ -282,7 +283,7 @@ lv_res_t lv_group_send_data(lv_group_t * group, uint32_t c)
     lv_obj_t * act = lv_group_get_focused(group);
     if(act == NULL) return LV_RES_OK;
 
-    return act->signal_func(act, LV_SIGNAL_CONTROLL, &c);
+    return lv_signal_send(act, LV_SIGNAL_CONTROLL, &c);
 }
 
 /**
@@ -331,7 +332,7 @@ void lv_group_set_editing(lv_group_t * group, bool edit)
     group->editing = en_val;
     lv_obj_t * focused = lv_group_get_focused(group);
 
-    if(focused) focused->signal_func(focused, LV_SIGNAL_FOCUS, NULL);       /*Focus again to properly leave edit mode*/
+    if(focused) lv_signal_send(focused, LV_SIGNAL_FOCUS, NULL);       /*Focus again to properly leave edit mode*/
 
     lv_obj_invalidate(focused);
 }
@@ -544,10 +545,7 @@ static void obj_to_foreground(lv_obj_t * obj)
 
     if(last_top != NULL) {
         /*Move the last_top object to the foreground*/
-        lv_obj_t * par = lv_obj_get_parent(last_top);
-        /*After list change it will be the new head*/
-        lv_ll_chg_list(&par->child_ll, &par->child_ll, last_top);
-        lv_obj_invalidate(last_top);
+        lv_obj_move_foreground(last_top);
     }
 }
 
@@ -15,6 +15,8 @@
 #include "../lv_misc/lv_math.h"
 #include "../lv_draw/lv_draw_rbasic.h"
 #include "lv_obj.h"
+#include "lv_signal.h"
+#include "lv_overlay.h"
 
 /*********************
  *      DEFINES
@@ -147,6 +149,28 @@ void lv_indev_set_cursor(lv_indev_t * indev, lv_obj_t * cur_obj)
     lv_obj_set_pos(indev->cursor, indev->proc.act_point.x,  indev->proc.act_point.y);
 }
 
+#if USE_LV_OVERLAY
+/**
+ * Set an image as cursor for a pointer input device (for LV_INPUT_TYPE_POINTER).
+ * Unlike `lv_indev_set_cursor` the image is not an object but drawn when the VDB is flushed
+ * so moving it doesn't redraw the objects under it.
+ * A cursor object set earlier by `lv_indev_set_cursor` is hidden (the caller can delete it).
+ * @param indev pointer to an input device
+ * @param img pointer to an image descriptor (see `lv_overlay_set_img`). NULL to remove the cursor.
+ */
+void lv_indev_set_cursor_img(lv_indev_t * indev, const lv_img_dsc_t * img)
+{
+    if(indev->driver.type != LV_INDEV_TYPE_POINTER) return;
+
+    /*The old cursor object would stay frozen on the system layer*/
+    if(indev->cursor) lv_obj_set_hidden(indev->cursor, true);
+    indev->cursor = NULL;
+    indev->proc.cursor_overlay = img != NULL ? 1 : 0;
+    lv_overlay_set_pos(indev->proc.act_point.x, indev->proc.act_point.y);
+    lv_overlay_set_img(img);
+}
+#endif
+
 #if USE_LV_GROUP
 /**
  * Set a destination group for a keypad input device (for LV_INDEV_TYPE_KEYPAD)
@@ -350,6 +374,17 @@ static void indev_proc_task(void * param)
  */
 static void indev_pointer_proc(lv_indev_t * i, lv_indev_data_t * data)
 {
+#if LV_VDB_SIZE != 0 && USE_LV_DISP_ROT
+    /*The input device gives the coordinates of the rotated display*/
+    lv_disp_t * disp = lv_disp_get_active();
+    if(disp && disp->driver.rotated != LV_ROT_NONE) {
+        lv_area_t p = {data->point.x, data->point.y, data->point.x, data->point.y};
+        lv_rot_area_inv(&p, LV_HOR_RES, LV_VER_RES, disp->driver.rotated);
+        data->point.x = p.x1;
+        data->point.y = p.y1;
+    }
+#endif
+
     /*Move the cursor if set and moved*/
     if(i->cursor != NULL &&
             (i->proc.last_point.x != data->point.x ||
@@ -357,6 +392,14 @@ static void indev_pointer_proc(lv_indev_t * i, lv_indev_data_t * data)
         lv_obj_set_pos(i->cursor, data->point.x, data->point.y);
     }
 
+#if USE_LV_OVERLAY
+    if(i->proc.cursor_overlay &&
+            (i->proc.last_point.x != data->point.x ||
+             i->proc.last_point.y != data->point.y)) {
+        lv_overlay_set_pos(data->point.x, data->point.y);
+    }
+#endif
+
     i->proc.act_point.x = data->point.x;
     i->proc.act_point.y = data->point.y;
 
@@ -394,7 +437,7 @@ static void indev_keypad_proc(lv_indev_t * i, lv_indev_data_t * data)
         i->proc.pr_timestamp = lv_tick_get();
         lv_obj_t * focused = lv_group_get_focused(i->group);
         if(focused && data->key == LV_GROUP_KEY_ENTER) {
-            focused->signal_func(focused, LV_SIGNAL_PRESSED, indev_act);
+            lv_signal_send(focused, LV_SIGNAL_PRESSED, indev_act);
         }
     }
     /*Pressing*/
@@ -405,7 +448,7 @@ static void indev_keypad_proc(lv_indev_t * i, lv_indev_data_t * data)
             /*On enter long press leave edit mode.*/
             lv_obj_t * focused = lv_group_get_focused(i->group);
             if(focused) {
-                focused->signal_func(focused, LV_SIGNAL_LONG_PRESS, indev_act);
+                lv_signal_send(focused, LV_SIGNAL_LONG_PRESS, indev_act);
                 i->proc.long_pr_sent = 1;
             }
         }
@@ -492,18 +535,18 @@ static void indev_encoder_proc(lv_indev_t * i, lv_indev_data_t * data)
             lv_obj_t * focused = lv_group_get_focused(i->group);
 
             bool editable = false;
-            if(focused) focused->signal_func(focused, LV_SIGNAL_GET_EDITABLE, &editable);
+            if(focused) lv_signal_send(focused, LV_SIGNAL_GET_EDITABLE, &editable);
 
             if(editable) {
                 if(i->group->obj_ll.head != i->group->obj_ll.tail)
                     lv_group_set_editing(i->group, lv_group_get_editing(i->group) ? false : true);  /*Toggle edit mode on long press*/
                 else if(focused)
-                    focused->signal_func(focused, LV_SIGNAL_LONG_PRESS, indev_act);
+                    lv_signal_send(focused, LV_SIGNAL_LONG_PRESS, indev_act);
             }
             /*If not editable then just send a long press signal*/
             else {
                 if(focused)
-                    focused->signal_func(focused, LV_SIGNAL_LONG_PRESS, indev_act);
+                    lv_signal_send(focused, LV_SIGNAL_LONG_PRESS, indev_act);
             }
             i->proc.long_pr_sent = 1;
         }
@@ -512,7 +555,7 @@ static void indev_encoder_proc(lv_indev_t * i, lv_indev_data_t * data)
     else if(data->state == LV_INDEV_STATE_REL && i->proc.last_state == LV_INDEV_STATE_PR) {
         lv_obj_t * focused = lv_group_get_focused(i->group);
         bool editable = false;
-        if(focused) focused->signal_func(focused, LV_SIGNAL_GET_EDITABLE, &editable);
+        if(focused) lv_signal_send(focused, LV_SIGNAL_GET_EDITABLE, &editable);
 
         /*The button was released on a non-editable object. Just send enter*/
         if(!editable) {
@@ -609,7 +652,7 @@ static void indev_proc_press(lv_indev_proc_t * proc)
 
         /*If a new object found the previous was lost, so send a signal*/
         if(proc->act_obj != NULL) {
-            proc->act_obj->signal_func(proc->act_obj, LV_SIGNAL_PRESS_LOST, indev_act);
+            lv_signal_send(proc->act_obj, LV_SIGNAL_PRESS_LOST, indev_act);
             if(proc->reset_query != 0) return;
         }
 
@@ -638,14 +681,11 @@ static void indev_proc_press(lv_indev_proc_t * proc)
 
             if(last_top != NULL) {
                 /*Move the last_top object to the foreground*/
-                lv_obj_t * par = lv_obj_get_parent(last_top);
-                /*After list change it will be the new head*/
-                lv_ll_chg_list(&par->child_ll, &par->child_ll, last_top);
-                lv_obj_invalidate(last_top);
+                lv_obj_move_foreground(last_top);
             }
 
             /*Send a signal about the press*/
-            proc->act_obj->signal_func(proc->act_obj, LV_SIGNAL_PRESSED, indev_act);
+            lv_signal_send(proc->act_obj, LV_SIGNAL_PRESSED, indev_act);
             if(proc->reset_query != 0) return;
         }
     }
@@ -656,7 +696,7 @@ static void indev_proc_press(lv_indev_proc_t * proc)
 
     /*If there is active object and it can be dragged run the drag*/
     if(proc->act_obj != NULL) {
-        proc->act_obj->signal_func(proc->act_obj, LV_SIGNAL_PRESSING, indev_act);
+        lv_signal_send(proc->act_obj, LV_SIGNAL_PRESSING, indev_act);
         if(proc->reset_query != 0) return;
 
         indev_drag(proc);
@@ -666,7 +706,7 @@ static void indev_proc_press(lv_indev_proc_t * proc)
         if(proc->drag_in_prog == 0 && proc->long_pr_sent == 0) {
             /*Send a signal about the long press if enough time elapsed*/
             if(lv_tick_elaps(proc->pr_timestamp) > LV_INDEV_LONG_PRESS_TIME) {
-                pr_obj->signal_func(pr_obj, LV_SIGNAL_LONG_PRESS, indev_act);
+                lv_signal_send(pr_obj, LV_SIGNAL_LONG_PRESS, indev_act);
                 if(proc->reset_query != 0) return;
 
                 /*Mark the signal sending to do not send it again*/
@@ -680,7 +720,7 @@ static void indev_proc_press(lv_indev_proc_t * proc)
         if(proc->drag_in_prog == 0 && proc->long_pr_sent == 1) {
             /*Send a signal about the long press repeate if enough time elapsed*/
             if(lv_tick_elaps(proc->longpr_rep_timestamp) > LV_INDEV_LONG_PRESS_REP_TIME) {
-                pr_obj->signal_func(pr_obj, LV_SIGNAL_LONG_PRESS_REP, indev_act);
+                lv_signal_send(pr_obj, LV_SIGNAL_LONG_PRESS_REP, indev_act);
                 if(proc->reset_query != 0) return;
                 proc->longpr_rep_timestamp = lv_tick_get();
 
@@ -711,15 +751,16 @@ static void indev_proc_release(lv_indev_proc_t * proc)
         if(lv_obj_is_protected(proc->act_obj, LV_PROTECT_PRESS_LOST)) {
             /* Search the object on the current current coordinates.
              * The start object is the object itself. If not ON it the the result will be NULL*/
+            lv_obj_update_coords(proc->act_obj);
             lv_obj_t * obj_on = indev_search_obj(proc, proc->act_obj);
-            if(obj_on == proc->act_obj) proc->act_obj->signal_func(proc->act_obj, LV_SIGNAL_RELEASED, indev_act);
-            else proc->act_obj->signal_func(proc->act_obj, LV_SIGNAL_PRESS_LOST, indev_act);
+            if(obj_on == proc->act_obj) lv_signal_send(proc->act_obj, LV_SIGNAL_RELEASED, indev_act);
+            else lv_signal_send(proc->act_obj, LV_SIGNAL_PRESS_LOST, indev_act);
 
         }
         /* The simple case: `act_obj` was not protected against press lost.
          * If it is already not pressed then was handled in `indev_proc_press`*/
         else {
-            proc->act_obj->signal_func(proc->act_obj, LV_SIGNAL_RELEASED, indev_act);
+            lv_signal_send(proc->act_obj, LV_SIGNAL_RELEASED, indev_act);
         }
 
         if(proc->reset_query != 0) return;
@@ -803,14 +844,19 @@ static lv_obj_t * indev_search_obj(const lv_indev_proc_t * proc, lv_obj_t * obj)
     /*If the point is on this object*/
     /*Check its children too*/
     if(lv_area_is_point_on(&obj->coords, &proc->act_point)) {
-        lv_obj_t * i;
+        /*The search goes from the parents to the children so it's enough to move the children*/
+        lv_obj_update_children_coords(obj);
 
-        LL_READ(obj->child_ll, i) {
-            found_p = indev_search_obj(proc, i);
+        /*Check the children only if the point is in their bounding box*/
+        if(lv_area_is_point_on(&obj->child_bound, &proc->act_point)) {
+            uint16_t id;
+            for(id = obj->child_cnt; id > 0; id--) {    /*From the youngest*/
+                found_p = indev_search_obj(proc, obj->child_arr[id - 1]);
 
-            /*If a child was found then break*/
-            if(found_p != NULL) {
-                break;
+                /*If a child was found then break*/
+                if(found_p != NULL) {
+                    break;
+                }
             }
         }
 
@@ -883,7 +929,7 @@ static void indev_drag(lv_indev_proc_t * state)
 
             if(drag_obj->coords.x1 != prev_x || drag_obj->coords.y1 != prev_y) {
                 if(state->drag_range_out != 0) { /*Send the drag begin signal on first move*/
-                    drag_obj->signal_func(drag_obj,  LV_SIGNAL_DRAG_BEGIN, indev_act);
+                    lv_signal_send(drag_obj, LV_SIGNAL_DRAG_BEGIN, indev_act);
                     if(state->reset_query != 0) return;
                 }
                 state->drag_in_prog = 1;
@@ -926,7 +972,7 @@ static void indev_drag_throw(lv_indev_proc_t * state)
     /*Return if the drag throw is not enabled*/
     if(lv_obj_get_drag_throw(drag_obj) == false) {
         state->drag_in_prog = 0;
-        drag_obj->signal_func(drag_obj, LV_SIGNAL_DRAG_END, indev_act);
+        lv_signal_send(drag_obj, LV_SIGNAL_DRAG_END, indev_act);
         return;
     }
 
@@ -952,14 +998,14 @@ static void indev_drag_throw(lv_indev_proc_t * state)
             state->drag_in_prog = 0;
             state->vect.x = 0;
             state->vect.y = 0;
-            drag_obj->signal_func(drag_obj, LV_SIGNAL_DRAG_END, indev_act);
+            lv_signal_send(drag_obj, LV_SIGNAL_DRAG_END, indev_act);
 
         }
     }
     /*If the vectors become 0 -> drag_in_prog = 0 and send a drag end signal*/
     else {
         state->drag_in_prog = 0;
-        drag_obj->signal_func(drag_obj, LV_SIGNAL_DRAG_END, indev_act);
+        lv_signal_send(drag_obj, LV_SIGNAL_DRAG_END, indev_act);
     }
 }
 #endif
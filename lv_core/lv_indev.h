@@ -16,6 +16,7 @@ extern "C" {
 #include "lv_obj.h"
 #include "../lv_hal/lv_hal_indev.h"
 #include "../lv_core/lv_group.h"
+#include "../lv_core/lv_overlay.h"
 
 /*********************
  *      DEFINES
@@ -74,6 +75,18 @@ void lv_indev_enable(lv_hal_indev_type_t type, bool enable);
  */
 void lv_indev_set_cursor(lv_indev_t *indev, lv_obj_t *cur_obj);
 
+#if USE_LV_OVERLAY
+/**
+ * Set an image as cursor for a pointer input device (for LV_INPUT_TYPE_POINTER).
+ * Unlike `lv_indev_set_cursor` the image is not an object but drawn when the VDB is flushed
+ * so moving it doesn't redraw the objects under it.
+ * A cursor object set earlier by `lv_indev_set_cursor` is hidden (the caller can delete it).
+ * @param indev pointer to an input device
+ * @param img pointer to an image descriptor (see `lv_overlay_set_img`). NULL to remove the cursor.
+ */
+void lv_indev_set_cursor_img(lv_indev_t *indev, const lv_img_dsc_t * img);
+#endif
+
 #if USE_LV_GROUP
 /**
  * Set a destination group for a keypad input device (for LV_INDEV_TYPE_KEYPAD)
@@ -10,7 +10,9 @@
 #if USE_LV_MULTI_LANG
 
 #include "lv_obj.h"
+#include "lv_signal.h"
 #include "../lv_misc/lv_gc.h"
+#include <string.h>
 
 /*********************
  *      DEFINES
@@ -20,10 +22,26 @@
  *      TYPEDEFS
  **********************/
 
+/*An element of the language dependent object registry*/
+typedef struct
+{
+    lv_obj_t * obj;
+    uint16_t txt_id;
+    uint8_t txt :1;         /*1: the object gets its text in the common text buffer*/
+} lv_lang_node_t;
+
+/*A parent to re-align after changing the language*/
+typedef struct
+{
+    lv_obj_t * obj;
+    uint16_t depth;
+} lv_lang_par_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static void lang_set_core(lv_obj_t * obj);
+static uint16_t get_depth(const lv_obj_t * obj);
+static void lang_set_unreg(lv_obj_t * scr);
 
 /**********************
  *  STATIC VARIABLES
@@ -40,21 +58,159 @@ static const void * (*get_txt)(uint16_t);
  **********************/
 
 /**
- * Change the language
+ * Init. the language registry
+ */
+void lv_lang_init(void)
+{
+    lv_ll_init(&LV_GC_ROOT(_lv_lang_ll), sizeof(lv_lang_node_t));
+    LV_GC_ROOT(_lv_lang_txt_buf) = NULL;
+}
+
+/**
+ * Change the language.
+ * The registered objects (see `lv_lang_obj_reg`) are notified first: their texts are copied into one buffer,
+ * the labels refer to them as static texts and their parents are re-aligned only once at the end.
+ * (Every label is still measured and invalidated one by one.)
+ * Every not registered object gets `LV_SIGNAL_LANG_CHG` with NULL `param` as before
+ * (e.g. custom objects handling the signal). Their parents are re-aligned on every change.
  * @param lang_id the id of the
  */
 void lv_lang_set(uint8_t lang_id)
 {
     lang_act = lang_id;
 
-    lv_obj_t * i;
-    LL_READ(LV_GC_ROOT(_lv_scr_ll), i) {
-        i->signal_func(i, LV_SIGNAL_LANG_CHG, NULL);
+    /*Measure the texts of the new language*/
+    lv_lang_node_t * node;
+    uint32_t node_cnt = 0;
+    uint32_t buf_size = 0;
+    LL_READ(LV_GC_ROOT(_lv_lang_ll), node) {
+        node_cnt++;
+        if(node->txt) {
+            const char * txt = lv_lang_get_text(node->txt_id);
+            if(txt) buf_size += strlen(txt) + 1;
+        }
+    }
+
+    /*Notify the not registered objects too. They might handle the signal in their own way.*/
+    lv_obj_t ** scr_p;
+    LL_READ(LV_GC_ROOT(_lv_scr_ll), scr_p) {
+        lang_set_unreg(*scr_p);
+    }
+
+    if(node_cnt == 0) return;
+
+    /*Allocate a buffer for all texts. If it fails the objects will allocate their texts as before.*/
+    char * buf_new = NULL;
+    if(buf_size) {
+        buf_new = lv_mem_alloc(buf_size);
+        if(buf_new == NULL) LV_LOG_WARN("lv_lang_set: not enough memory for the text buffer");
+    }
+
+    /*Don't let the parents re-align on every text change. Collect them to notify them only once.
+     * (max. one parent per node, if it fails re-align the parents on every change as before)*/
+    lv_lang_par_t * par_list = lv_mem_alloc(node_cnt * sizeof(lv_lang_par_t));
+    uint32_t par_cnt = 0;
+    if(par_list) {
+        LL_READ(LV_GC_ROOT(_lv_lang_ll), node) {
+            lv_obj_t * par = lv_obj_get_parent(node->obj);
+            if(par == NULL || lv_obj_is_protected(par, LV_PROTECT_CHILD_CHG)) continue;
+
+            lv_obj_set_protect(par, LV_PROTECT_CHILD_CHG);
+            par_list[par_cnt].obj = par;
+            par_list[par_cnt].depth = get_depth(par);
+            par_cnt++;
+        }
+    }
+
+    /*Apply the new language*/
+    char * buf_act = buf_new;
+    LL_READ(LV_GC_ROOT(_lv_lang_ll), node) {
+        char * txt_param = NULL;
+        if(node->txt && buf_act) {
+            const char * txt = lv_lang_get_text(node->txt_id);
+            if(txt) {
+                strcpy(buf_act, txt);
+                txt_param = buf_act;
+                buf_act += strlen(txt) + 1;
+            }
+        }
+        lv_signal_send(node->obj, LV_SIGNAL_LANG_CHG, txt_param);
+    }
+
+    /*Re-align the parents. Start with the deepest ones to not refresh an ancestor twice*/
+    if(par_list) {
+        uint32_t i;
+        uint32_t j;
+        for(i = 1; i < par_cnt; i++) {
+            lv_lang_par_t par = par_list[i];
+            for(j = i; j > 0 && par_list[j - 1].depth < par.depth; j--) {
+                par_list[j] = par_list[j - 1];
+            }
+            par_list[j] = par;
+        }
 
-        lang_set_core(i);
+        for(i = 0; i < par_cnt; i++) {
+            lv_obj_t * par = par_list[i].obj;
+            lv_obj_clear_protect(par, LV_PROTECT_CHILD_CHG);
+            lv_signal_send(par, LV_SIGNAL_CHILD_CHG, NULL);
+        }
+
+        lv_mem_free(par_list);
     }
 
-    lang_set_core(lv_scr_act());
+    /*The objects don't use the texts of the previous language anymore:
+     *they got a text in the new buffer or copied their text on `LV_SIGNAL_LANG_CHG` with NULL `param`*/
+    if(LV_GC_ROOT(_lv_lang_txt_buf)) lv_mem_free(LV_GC_ROOT(_lv_lang_txt_buf));
+    LV_GC_ROOT(_lv_lang_txt_buf) = buf_new;
+}
+
+/**
+ * Register an object to get `LV_SIGNAL_LANG_CHG` when the language changes.
+ * @param node the current node of `obj` (returned by an earlier call) or NULL if not registered yet
+ * @param obj pointer to an object
+ * @param txt_id the ID of the text or image source of the object
+ * @param txt true: `txt_id` refers to a string which can be stored in the common text buffer.
+ *            In this case the `param` of `LV_SIGNAL_LANG_CHG` can point to the text.
+ *            It is valid until the next `lv_lang_set` or `lv_lang_obj_unreg`.
+ *            With NULL `param` the object has to stop using the text it got earlier (e.g. copy it).
+ * @return the node of the object. Should be passed to `lv_lang_obj_unreg` when `obj` is deleted
+ */
+void * lv_lang_obj_reg(void * node, lv_obj_t * obj, uint16_t txt_id, bool txt)
+{
+    lv_lang_node_t * n = node;
+    if(n == NULL) {
+        n = lv_ll_ins_tail(&LV_GC_ROOT(_lv_lang_ll));
+        lv_mem_assert(n);
+        if(n == NULL) return NULL;
+    }
+
+    n->obj = obj;
+    n->txt_id = txt_id;
+    n->txt = txt ? 1 : 0;
+    obj->lang_reg = 1;
+
+    return n;
+}
+
+/**
+ * Remove an object from the language registry.
+ * If there are no more registered objects the text buffer is freed too.
+ * @param node the node of the object returned by `lv_lang_obj_reg`. NULL is ignored.
+ */
+void lv_lang_obj_unreg(void * node)
+{
+    if(node == NULL) return;
+
+    lv_lang_node_t * n = node;
+    n->obj->lang_reg = 0;
+
+    lv_ll_rem(&LV_GC_ROOT(_lv_lang_ll), node);
+    lv_mem_free(node);
+
+    if(lv_ll_get_head(&LV_GC_ROOT(_lv_lang_ll)) == NULL && LV_GC_ROOT(_lv_lang_txt_buf)) {
+        lv_mem_free(LV_GC_ROOT(_lv_lang_txt_buf));
+        LV_GC_ROOT(_lv_lang_txt_buf) = NULL;
+    }
 }
 
 /**
@@ -101,16 +257,38 @@ uint8_t lv_lang_act(void)
  **********************/
 
 /**
- * Change the language of the children. (Called recursively)
+ * Get the number of ancestors of an object
  * @param obj pointer to an object
+ * @return 0 for screens, 1 for their children, etc.
+ */
+static uint16_t get_depth(const lv_obj_t * obj)
+{
+    uint16_t depth = 0;
+    while(obj->par) {
+        obj = obj->par;
+        depth++;
+    }
+
+    return depth;
+}
+
+/**
+ * Send `LV_SIGNAL_LANG_CHG` to the not registered objects of a screen (including the screen)
+ * @param scr pointer to a screen
  */
-static void lang_set_core(lv_obj_t * obj)
+static void lang_set_unreg(lv_obj_t * scr)
 {
-    lv_obj_t * i;
-    LL_READ(obj->child_ll, i) {
-        i->signal_func(i, LV_SIGNAL_LANG_CHG, NULL);
+    /*Walk the tree without recursion (pre-order)*/
+    lv_obj_t * i = scr;
+    while(i != NULL) {
+        if(i->lang_reg == 0) lv_signal_send(i, LV_SIGNAL_LANG_CHG, NULL);
 
-        lang_set_core(i);
+        lv_obj_t * next = lv_obj_get_child(i, NULL);
+        while(next == NULL && i != scr) {
+            next = lv_obj_get_child(i->par, i);
+            if(next == NULL) i = i->par;
+        }
+        i = next;
     }
 }
 
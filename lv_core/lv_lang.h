@@ -22,6 +22,8 @@ extern "C" {
 #if USE_LV_MULTI_LANG
 
 #include <stdint.h>
+#include <stdbool.h>
+#include "lv_obj.h"
 
 /*********************
  *      DEFINES
@@ -37,11 +39,41 @@ extern "C" {
  **********************/
 
 /**
- * Change the language
+ * Init. the language registry
+ */
+void lv_lang_init(void);
+
+/**
+ * Change the language.
+ * The registered objects (see `lv_lang_obj_reg`) are notified first: their texts are copied into one buffer,
+ * the labels refer to them as static texts and their parents are re-aligned only once at the end.
+ * (Every label is still measured and invalidated one by one.)
+ * Every not registered object gets `LV_SIGNAL_LANG_CHG` with NULL `param` as before
+ * (e.g. custom objects handling the signal). Their parents are re-aligned on every change.
  * @param lang_id the id of the
  */
 void lv_lang_set(uint8_t lang_id);
 
+/**
+ * Register an object to get `LV_SIGNAL_LANG_CHG` when the language changes.
+ * @param node the current node of `obj` (returned by an earlier call) or NULL if not registered yet
+ * @param obj pointer to an object
+ * @param txt_id the ID of the text or image source of the object
+ * @param txt true: `txt_id` refers to a string which can be stored in the common text buffer.
+ *            In this case the `param` of `LV_SIGNAL_LANG_CHG` can point to the text.
+ *            It is valid until the next `lv_lang_set` or `lv_lang_obj_unreg`.
+ *            With NULL `param` the object has to stop using the text it got earlier (e.g. copy it).
+ * @return the node of the object. Should be passed to `lv_lang_obj_unreg` when `obj` is deleted
+ */
+void * lv_lang_obj_reg(void * node, lv_obj_t * obj, uint16_t txt_id, bool txt);
+
+/**
+ * Remove an object from the language registry.
+ * If there are no more registered objects the text buffer is freed too.
+ * @param node the node of the object returned by `lv_lang_obj_reg`. NULL is ignored.
+ */
+void lv_lang_obj_unreg(void * node);
+
 /**
  * Set a function to get the texts of the set languages from a `txt_id`
  * @param fp a function pointer to get the texts
@@ -10,6 +10,8 @@
 #include "lv_indev.h"
 #include "lv_refr.h"
 #include "lv_group.h"
+#include "lv_lang.h"
+#include "lv_signal.h"
 #include "../lv_themes/lv_theme.h"
 #include "../lv_draw/lv_draw.h"
 #include "../lv_draw/lv_draw_rbasic.h"
@@ -28,6 +30,7 @@
 /*********************
  *      DEFINES
  *********************/
+#define LV_OBJ_CHILD_ARR_MIN    4       /*Allocate place for this many children at first*/
 #define LV_OBJ_DEF_WIDTH  (LV_DPI)
 #define LV_OBJ_DEF_HEIGHT  (2 * LV_DPI / 3)
 
@@ -38,18 +41,26 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static void refresh_children_position(lv_obj_t * obj, lv_coord_t x_diff, lv_coord_t y_diff);
+static void child_shift_add(lv_obj_t * obj, lv_coord_t x_diff, lv_coord_t y_diff);
+static void child_shift_clear(lv_obj_t * obj);
+static void shift_child_bound(lv_obj_t * obj, lv_coord_t x_diff, lv_coord_t y_diff);
 static void report_style_mod_core(void * style_p, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
 static void delete_children(lv_obj_t * obj);
+static bool child_add(lv_obj_t * par, lv_obj_t * obj);
+static void child_rem(lv_obj_t * par, uint16_t id);
 static bool lv_obj_design(lv_obj_t * obj, const  lv_area_t * mask_p, lv_design_mode_t mode);
 static lv_res_t lv_obj_signal(lv_obj_t * obj, lv_signal_t sign, void * param);
+#if LV_OBJ_OPT_ATTR
+static lv_obj_opt_attr_t * get_opt_attr(lv_obj_t * obj);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 
 static bool _lv_initialized = false;
+static uint32_t child_shift_cnt;        /*Number of objects with not applied `child_shift`*/
 
 /**********************
  *      MACROS
@@ -91,14 +102,22 @@ void lv_init(void)
     lv_anim_init();
 #endif
 
+#if USE_LV_MULTI_LANG
+    lv_lang_init();
+#endif
+
     /*Init. the sstyles*/
     lv_style_init();
 
+    /*Tell which signals are handled by the base object (all input device signals go to the feedback)*/
+    lv_signal_reg(lv_obj_signal, NULL, LV_SIGNAL_BIT(LV_SIGNAL_CHILD_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_REFR_EXT_SIZE) |
+                  LV_SIGNAL_BIT(LV_SIGNAL_STYLE_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE) | LV_SIGNAL_MASK_FEEDBACK);
+
     /*Initialize the screen refresh system*/
     lv_refr_init();
 
     /*Create the default screen*/
-    lv_ll_init(&LV_GC_ROOT(_lv_scr_ll), sizeof(lv_obj_t));
+    lv_ll_init(&LV_GC_ROOT(_lv_scr_ll), sizeof(lv_obj_t *));
     LV_GC_ROOT(_lv_def_scr) = lv_obj_create(NULL, NULL);
 
     LV_GC_ROOT(_lv_act_scr) = LV_GC_ROOT(_lv_def_scr);
@@ -140,12 +159,24 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const  lv_obj_t * copy)
     if(parent == NULL) {
         LV_LOG_TRACE("Screen create started");
 
-        new_obj = lv_ll_ins_head(&LV_GC_ROOT(_lv_scr_ll));
+        new_obj = lv_mem_alloc(sizeof(lv_obj_t));
         lv_mem_assert(new_obj);
         if(new_obj == NULL) return NULL;
 
+        /*Save the screen in the list of the screens*/
+        lv_obj_t ** scr_p = lv_ll_ins_head(&LV_GC_ROOT(_lv_scr_ll));
+        lv_mem_assert(scr_p);
+        if(scr_p == NULL) {
+            lv_mem_free(new_obj);
+            return NULL;
+        }
+        *scr_p = new_obj;
+
         new_obj->par = NULL; /*Screens has no a parent*/
-        lv_ll_init(&(new_obj->child_ll), sizeof(lv_obj_t));
+        new_obj->child_arr = NULL;
+        new_obj->child_cnt = 0;
+        new_obj->child_arr_size = 0;
+        new_obj->child_id = 0;
 
         /*Set coordinates to full screen size*/
         new_obj->coords.x1 = 0;
@@ -153,6 +184,9 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const  lv_obj_t * copy)
         new_obj->coords.x2 = LV_HOR_RES - 1;
         new_obj->coords.y2 = LV_VER_RES - 1;
         new_obj->ext_size = 0;
+        lv_area_set(&new_obj->child_bound, LV_COORD_MAX, LV_COORD_MAX, LV_COORD_MIN, LV_COORD_MIN);
+        new_obj->child_shift.x = 0;
+        new_obj->child_shift.y = 0;
 
         /*Init realign*/
 #if LV_OBJ_REALIGN
@@ -175,16 +209,8 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const  lv_obj_t * copy)
         lv_obj_set_design_func(new_obj, lv_obj_design);
 
         /*Set free data*/
-#ifdef LV_OBJ_FREE_NUM_TYPE
-        new_obj->free_num = 0;
-#endif
-
-#if LV_OBJ_FREE_PTR != 0
-        new_obj->free_ptr = NULL;
-#endif
-
-#if USE_LV_GROUP
-        new_obj->group_p = NULL;
+#if LV_OBJ_OPT_ATTR
+        new_obj->opt_attr = NULL;
 #endif
         /*Set attributes*/
         new_obj->click = 0;
@@ -194,6 +220,9 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const  lv_obj_t * copy)
         new_obj->hidden = 0;
         new_obj->top = 0;
         new_obj->opa_scale_en = 0;
+#if USE_LV_MULTI_LANG
+        new_obj->lang_reg = 0;
+#endif
         new_obj->protect = LV_PROTECT_NONE;
         new_obj->opa_scale = LV_OPA_COVER;
 
@@ -205,13 +234,20 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const  lv_obj_t * copy)
     else {
         LV_LOG_TRACE("Object create started");
 
-        new_obj = lv_ll_ins_head(&(parent)->child_ll);
+        new_obj = lv_mem_alloc(sizeof(lv_obj_t));
         lv_mem_assert(new_obj);
         if(new_obj == NULL) return NULL;
 
+        /*Add as the youngest child*/
+        if(child_add(parent, new_obj) == false) {
+            lv_mem_free(new_obj);
+            return NULL;
+        }
 
         new_obj->par = parent; /*Set the parent*/
-        lv_ll_init(&(new_obj->child_ll), sizeof(lv_obj_t));
+        new_obj->child_arr = NULL;
+        new_obj->child_cnt = 0;
+        new_obj->child_arr_size = 0;
 
         /*Set coordinates left top corner of parent*/
         new_obj->coords.x1 = parent->coords.x1;
@@ -221,6 +257,9 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const  lv_obj_t * copy)
         new_obj->coords.y2 = parent->coords.y1 +
                              LV_OBJ_DEF_HEIGHT;
         new_obj->ext_size = 0;
+        lv_area_set(&new_obj->child_bound, LV_COORD_MAX, LV_COORD_MAX, LV_COORD_MIN, LV_COORD_MIN);
+        new_obj->child_shift.x = 0;
+        new_obj->child_shift.y = 0;
 
         /*Init realign*/
 #if LV_OBJ_REALIGN
@@ -243,14 +282,8 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const  lv_obj_t * copy)
         lv_obj_set_design_func(new_obj, lv_obj_design);
 
         /*Set free data*/
-#ifdef LV_OBJ_FREE_NUM_TYPE
-        new_obj->free_num = 0;
-#endif
-#if LV_OBJ_FREE_PTR != 0
-        new_obj->free_ptr = NULL;
-#endif
-#if USE_LV_GROUP
-        new_obj->group_p = NULL;
+#if LV_OBJ_OPT_ATTR
+        new_obj->opt_attr = NULL;
 #endif
 
         /*Set attributes*/
@@ -263,20 +296,24 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const  lv_obj_t * copy)
         new_obj->protect = LV_PROTECT_NONE;
         new_obj->opa_scale = LV_OPA_COVER;
         new_obj->opa_scale_en = 0;
+#if USE_LV_MULTI_LANG
+        new_obj->lang_reg = 0;
+#endif
 
         new_obj->ext_attr = NULL;
     }
 
     if(copy != NULL) {
+        lv_obj_update_coords(copy);
         lv_area_copy(&new_obj->coords, &copy->coords);
         new_obj->ext_size = copy->ext_size;
 
         /*Set free data*/
 #ifdef LV_OBJ_FREE_NUM_TYPE
-        new_obj->free_num = copy->free_num;
+        lv_obj_set_free_num(new_obj, lv_obj_get_free_num(copy));
 #endif
 #if LV_OBJ_FREE_PTR != 0
-        new_obj->free_ptr = copy->free_ptr;
+        lv_obj_set_free_ptr(new_obj, lv_obj_get_free_ptr(copy));
 #endif
 
         /*Copy realign*/
@@ -304,8 +341,8 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const  lv_obj_t * copy)
 
 #if USE_LV_GROUP
         /*Add to the same group*/
-        if(copy->group_p != NULL) {
-            lv_group_add_obj(copy->group_p, new_obj);
+        if(lv_obj_get_group(copy) != NULL) {
+            lv_group_add_obj(lv_obj_get_group(copy), new_obj);
         }
 #endif
 
@@ -317,7 +354,8 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const  lv_obj_t * copy)
 
     /*Send a signal to the parent to notify it about the new child*/
     if(parent != NULL) {
-        parent->signal_func(parent, LV_SIGNAL_CHILD_CHG, new_obj);
+        lv_obj_refresh_bound(new_obj);
+        lv_signal_send(parent, LV_SIGNAL_CHILD_CHG, new_obj);
 
         /*Invalidate the area if not screen created*/
         lv_obj_invalidate(new_obj);
@@ -337,7 +375,7 @@ lv_res_t lv_obj_del(lv_obj_t * obj)
 
     /*Delete from the group*/
 #if USE_LV_GROUP
-    if(obj->group_p != NULL) lv_group_remove_obj(obj);
+    if(lv_obj_get_group(obj) != NULL) lv_group_remove_obj(obj);
 #endif
 
     /*Remove the animations from this object*/
@@ -345,27 +383,24 @@ lv_res_t lv_obj_del(lv_obj_t * obj)
     lv_anim_del(obj, NULL);
 #endif
 
-    /*Recursively delete the children*/
-    lv_obj_t * i;
-    lv_obj_t * i_next;
-    i = lv_ll_get_head(&(obj->child_ll));
-    while(i != NULL) {
-        /*Get the next object before delete this*/
-        i_next = lv_ll_get_next(&(obj->child_ll), i);
-
-        /*Call the recursive del to the child too*/
-        delete_children(i);
-
-        /*Set i to the next node*/
-        i = i_next;
+    /*Recursively delete the children from the youngest. (They remove themselves from `child_arr`)*/
+    while(obj->child_cnt != 0) {
+        delete_children(obj->child_arr[obj->child_cnt - 1]);
     }
 
     /*Remove the object from parent's children list*/
     lv_obj_t * par = lv_obj_get_parent(obj);
     if(par == NULL) { /*It is a screen*/
-        lv_ll_rem(&LV_GC_ROOT(_lv_scr_ll), obj);
+        lv_obj_t ** scr_p;
+        LL_READ(LV_GC_ROOT(_lv_scr_ll), scr_p) {
+            if(*scr_p == obj) break;
+        }
+        if(scr_p != NULL) {
+            lv_ll_rem(&LV_GC_ROOT(_lv_scr_ll), scr_p);
+            lv_mem_free(scr_p);
+        }
     } else {
-        lv_ll_rem(&(par->child_ll), obj);
+        child_rem(par, obj->child_id);
     }
 
     /* Reset all input devices if
@@ -380,15 +415,20 @@ lv_res_t lv_obj_del(lv_obj_t * obj)
 
     /* All children deleted.
      * Now clean up the object specific data*/
-    obj->signal_func(obj, LV_SIGNAL_CLEANUP, NULL);
+    lv_signal_send(obj, LV_SIGNAL_CLEANUP, NULL);
 
     /*Delete the base objects*/
     if(obj->ext_attr != NULL)  lv_mem_free(obj->ext_attr);
+#if LV_OBJ_OPT_ATTR
+    if(obj->opt_attr != NULL)  lv_mem_free(obj->opt_attr);
+#endif
+    if(obj->child_arr != NULL)  lv_mem_free(obj->child_arr);
+    child_shift_clear(obj);
     lv_mem_free(obj); /*Free the object itself*/
 
     /*Send a signal to the parent to notify it about the child delete*/
     if(par != NULL) {
-        par->signal_func(par, LV_SIGNAL_CHILD_CHG, NULL);
+        lv_signal_send(par, LV_SIGNAL_CHILD_CHG, NULL);
     }
 
     return LV_RES_INV;
@@ -416,28 +456,51 @@ void lv_obj_clean(lv_obj_t * obj)
  * @param obj pointer to an object
  */
 void lv_obj_invalidate(const lv_obj_t * obj)
+{
+    lv_obj_update_coords(obj);
+
+    /*Start with the original coordinates*/
+    lv_area_t area;
+    lv_coord_t ext_size = obj->ext_size;
+    lv_area_copy(&area, &obj->coords);
+    area.x1 -= ext_size;
+    area.y1 -= ext_size;
+    area.x2 += ext_size;
+    area.y2 += ext_size;
+
+    lv_obj_invalidate_area(obj, &area);
+}
+
+/**
+ * Mark only an area of the object as invalid. Useful when only a small part of the object changes.
+ * @param obj pointer to an object
+ * @param area the area to redraw in absolute coordinates. It's truncated to the object and its parents.
+ */
+void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     if(lv_obj_get_hidden(obj)) return;
 
+    lv_obj_update_coords(obj);
+
     /*Invalidate the object only if it belongs to the 'LV_GC_ROOT(_lv_act_scr)'*/
     lv_obj_t * obj_scr = lv_obj_get_screen(obj);
     if(obj_scr == lv_scr_act() ||
             obj_scr == lv_layer_top() ||
             obj_scr == lv_layer_sys()) {
-        /*Truncate recursively to the parents*/
+        /*Truncate to the object with its extra size*/
         lv_area_t area_trunc;
-        lv_obj_t * par = lv_obj_get_parent(obj);
-        bool union_ok = true;
-        /*Start with the original coordinates*/
+        lv_area_t obj_area;
         lv_coord_t ext_size = obj->ext_size;
-        lv_area_copy(&area_trunc, &obj->coords);
-        area_trunc.x1 -= ext_size;
-        area_trunc.y1 -= ext_size;
-        area_trunc.x2 += ext_size;
-        area_trunc.y2 += ext_size;
-
-        /*Check through all parents*/
-        while(par != NULL) {
+        lv_area_copy(&obj_area, &obj->coords);
+        obj_area.x1 -= ext_size;
+        obj_area.y1 -= ext_size;
+        obj_area.x2 += ext_size;
+        obj_area.y2 += ext_size;
+        bool union_ok = lv_area_intersect(&area_trunc, area, &obj_area);
+
+        /*Truncate recursively to the parents*/
+        lv_obj_t * par = lv_obj_get_parent(obj);
+        while(par != NULL && union_ok != false) {
             union_ok = lv_area_intersect(&area_trunc, &area_trunc, &par->coords);
             if(union_ok == false) break;        /*If no common parts with parent break;*/
             if(lv_obj_get_hidden(par)) return;  /*If the parent is hidden then the child is hidden and won't be drawn*/
@@ -499,15 +562,43 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
 
     lv_obj_t * old_par = obj->par;
 
-    lv_ll_chg_list(&obj->par->child_ll, &parent->child_ll, obj);
+    /*Add as the youngest child of the new parent*/
+    uint16_t old_id = obj->child_id;
+    if(child_add(parent, obj) == false) return;
+    child_rem(old_par, old_id);
     obj->par = parent;
     lv_obj_set_pos(obj, old_pos.x, old_pos.y);
+    lv_obj_refresh_bound(obj);      /*`lv_obj_set_pos` does nothing if the position is the same*/
 
     /*Notify the original parent because one of its children is lost*/
-    old_par->signal_func(old_par, LV_SIGNAL_CHILD_CHG, NULL);
+    lv_signal_send(old_par, LV_SIGNAL_CHILD_CHG, NULL);
 
     /*Notify the new parent about the child*/
-    parent->signal_func(parent, LV_SIGNAL_CHILD_CHG, obj);
+    lv_signal_send(parent, LV_SIGNAL_CHILD_CHG, obj);
+
+    lv_obj_invalidate(obj);
+}
+
+/**
+ * Move an object to the foreground. It will be the youngest child of its parent.
+ * @param obj pointer to an object. Can't be a screen.
+ */
+void lv_obj_move_foreground(lv_obj_t * obj)
+{
+    lv_obj_t * par = obj->par;
+    if(par == NULL) return;
+
+    /*Already in the foreground*/
+    if(obj->child_id == par->child_cnt - 1) return;
+
+    /*Shift the younger siblings back and put `obj` to the end*/
+    uint16_t i;
+    for(i = obj->child_id; i < par->child_cnt - 1; i++) {
+        par->child_arr[i] = par->child_arr[i + 1];
+        par->child_arr[i]->child_id = i;
+    }
+    par->child_arr[i] = obj;
+    obj->child_id = i;
 
     lv_obj_invalidate(obj);
 }
@@ -517,13 +608,16 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
  * ------------------*/
 
 /**
- * Set relative the position of an object (relative to the parent)
+ * Set relative the position of an object (relative to the parent).
+ * The descendants are moved only when they are used (see `lv_obj_update_coords`), so the time doesn't depend on their number.
  * @param obj pointer to an object
  * @param x new distance from the left side of the parent
  * @param y new distance from the top of the parent
  */
 void lv_obj_set_pos(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
 {
+    lv_obj_update_coords(obj);
+
     /*Convert x and y to absolute coordinates*/
     lv_obj_t * par = obj->par;
     x = x + par->coords.x1;
@@ -551,13 +645,16 @@ void lv_obj_set_pos(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
     obj->coords.x2 += diff.x;
     obj->coords.y2 += diff.y;
 
-    refresh_children_position(obj, diff.x, diff.y);
+    /*Don't touch the descendants now, only save the movement for them*/
+    shift_child_bound(obj, diff.x, diff.y);
+    if(obj->child_cnt != 0) child_shift_add(obj, diff.x, diff.y);
 
     /*Inform the object about its new coordinates*/
-    obj->signal_func(obj, LV_SIGNAL_CORD_CHG, &ori);
+    lv_signal_send(obj, LV_SIGNAL_CORD_CHG, &ori);
+    lv_obj_refresh_bound(obj);
 
     /*Send a signal to the parent too*/
-    par->signal_func(par, LV_SIGNAL_CHILD_CHG, obj);
+    lv_signal_send(par, LV_SIGNAL_CHILD_CHG, obj);
 
     /*Invalidate the new area*/
     lv_obj_invalidate(obj);
@@ -593,6 +690,7 @@ void lv_obj_set_y(lv_obj_t * obj, lv_coord_t y)
  */
 void lv_obj_set_size(lv_obj_t * obj, lv_coord_t w, lv_coord_t h)
 {
+    lv_obj_update_coords(obj);
 
     /* Do nothing if the size is not changed */
     /* It is very important else recursive resizing can
@@ -614,11 +712,12 @@ void lv_obj_set_size(lv_obj_t * obj, lv_coord_t w, lv_coord_t h)
 
 
     /*Send a signal to the object with its new coordinates*/
-    obj->signal_func(obj, LV_SIGNAL_CORD_CHG, &ori);
+    lv_signal_send(obj, LV_SIGNAL_CORD_CHG, &ori);
+    lv_obj_refresh_bound(obj);
 
     /*Send a signal to the parent too*/
     lv_obj_t * par = lv_obj_get_parent(obj);
-    if(par != NULL) par->signal_func(par, LV_SIGNAL_CHILD_CHG, obj);
+    if(par != NULL) lv_signal_send(par, LV_SIGNAL_CHILD_CHG, obj);
 
     /*Invalidate the new area*/
     lv_obj_invalidate(obj);
@@ -773,6 +872,8 @@ void lv_obj_align(lv_obj_t * obj, const lv_obj_t * base, lv_align_t align, lv_co
 
     /*Bring together the coordination system of base and obj*/
     lv_obj_t * par = lv_obj_get_parent(obj);
+    lv_obj_update_coords(obj);
+    lv_obj_update_coords(base);
     lv_coord_t base_abs_x = base->coords.x1;
     lv_coord_t base_abs_y = base->coords.y1;
     lv_coord_t par_abs_x = par->coords.x1;
@@ -921,6 +1022,8 @@ void lv_obj_align_origo(lv_obj_t * obj, const lv_obj_t * base, lv_align_t align,
 
     /*Bring together the coordination system of base and obj*/
     lv_obj_t * par = lv_obj_get_parent(obj);
+    lv_obj_update_coords(obj);
+    lv_obj_update_coords(base);
     lv_coord_t base_abs_x = base->coords.x1;
     lv_coord_t base_abs_y = base->coords.y1;
     lv_coord_t par_abs_x = par->coords.x1;
@@ -1000,7 +1103,7 @@ void lv_obj_set_style(lv_obj_t * obj, lv_style_t * style)
 void lv_obj_refresh_style(lv_obj_t * obj)
 {
     lv_obj_invalidate(obj);
-    obj->signal_func(obj, LV_SIGNAL_STYLE_CHG, NULL);
+    lv_signal_send(obj, LV_SIGNAL_STYLE_CHG, NULL);
     lv_obj_invalidate(obj);
 
 }
@@ -1012,8 +1115,9 @@ void lv_obj_refresh_style(lv_obj_t * obj)
  */
 void lv_obj_report_style_mod(lv_style_t * style)
 {
-    lv_obj_t * i;
-    LL_READ(LV_GC_ROOT(_lv_scr_ll), i) {
+    lv_obj_t ** scr_p;
+    LL_READ(LV_GC_ROOT(_lv_scr_ll), scr_p) {
+        lv_obj_t * i = *scr_p;
         if(i->style_p == style || style == NULL) {
             lv_obj_refresh_style(i);
         }
@@ -1040,7 +1144,7 @@ void lv_obj_set_hidden(lv_obj_t * obj, bool en)
     if(!obj->hidden) lv_obj_invalidate(obj);    /*Invalidate when not hidden (hidden objects are ignored) */
 
     lv_obj_t * par = lv_obj_get_parent(obj);
-    par->signal_func(par, LV_SIGNAL_CHILD_CHG, obj);
+    lv_signal_send(par, LV_SIGNAL_CHILD_CHG, obj);
 
 }
 
@@ -1184,21 +1288,103 @@ void * lv_obj_allocate_ext_attr(lv_obj_t * obj, uint16_t ext_size)
 void lv_obj_refresh_ext_size(lv_obj_t * obj)
 {
     obj->ext_size = 0;
-    obj->signal_func(obj, LV_SIGNAL_REFR_EXT_SIZE, NULL);
+    lv_signal_send(obj, LV_SIGNAL_REFR_EXT_SIZE, NULL);
+    lv_obj_refresh_bound(obj);
 
     lv_obj_invalidate(obj);
 }
 
+/**
+ * Add the area of an object (with its ext. size) to the children bounding box of its parent.
+ * Called automatically when the coordinates or the ext. size is set.
+ * Needs to be called only if the coordinates are modified directly.
+ * @param obj pointer to an object
+ */
+void lv_obj_refresh_bound(lv_obj_t * obj)
+{
+    lv_obj_t * par = obj->par;
+    if(par == NULL) return;
+
+    lv_obj_update_coords(obj);
+
+    /*The bounding box only grows here. It's made exact again when the children are redrawn.*/
+    lv_area_t ext_area;
+    ext_area.x1 = obj->coords.x1 - obj->ext_size;
+    ext_area.y1 = obj->coords.y1 - obj->ext_size;
+    ext_area.x2 = obj->coords.x2 + obj->ext_size;
+    ext_area.y2 = obj->coords.y2 + obj->ext_size;
+    lv_area_join(&par->child_bound, &par->child_bound, &ext_area);
+}
+
+/**
+ * Apply the not yet applied movements of the ancestors of an object to make its `coords` up to date.
+ * Moving an object changes only its own coordinates and the descendants are moved when they are used.
+ * The library's functions call it, it's required only to read `obj->coords` directly.
+ * @param obj pointer to an object
+ */
+void lv_obj_update_coords(const lv_obj_t * obj)
+{
+    /*Nothing to do if no object was moved since the last update*/
+    if(child_shift_cnt == 0) return;
+
+    /*Apply the movements from the top-most ancestor with a saved movement.
+     *It can give a movement to the next ancestor so search again until there is none.*/
+    while(1) {
+        const lv_obj_t * top = NULL;
+        const lv_obj_t * i;
+        for(i = obj->par; i != NULL; i = i->par) {
+            if(i->child_shift.x != 0 || i->child_shift.y != 0) top = i;
+        }
+
+        if(top == NULL) break;
+        lv_obj_update_children_coords(top);
+    }
+}
+
+/**
+ * Apply the not yet applied movement of an object to its children (but not to their descendants).
+ * The coordinates of the object itself have to be up to date.
+ * Used when the children are traversed from the parent, e.g. by the drawing.
+ * @param obj pointer to an object
+ */
+void lv_obj_update_children_coords(const lv_obj_t * obj)
+{
+    if(obj->child_shift.x == 0 && obj->child_shift.y == 0) return;
+
+    lv_obj_t * par = (lv_obj_t *)obj;      /*Only the cached coordinates change*/
+    lv_coord_t x_diff = par->child_shift.x;
+    lv_coord_t y_diff = par->child_shift.y;
+    child_shift_clear(par);
+
+    /*Move the children and pass the movement to their children*/
+    uint16_t id;
+    for(id = 0; id < par->child_cnt; id++) {
+        lv_obj_t * child = par->child_arr[id];
+        child->coords.x1 += x_diff;
+        child->coords.y1 += y_diff;
+        child->coords.x2 += x_diff;
+        child->coords.y2 += y_diff;
+        shift_child_bound(child, x_diff, y_diff);
+        if(child->child_cnt != 0) child_shift_add(child, x_diff, y_diff);
+    }
+}
+
 #ifdef LV_OBJ_FREE_NUM_TYPE
 /**
  * Set an application specific number for an object.
  * It can help to identify objects in the application.
+ * The first non-zero value allocates the optional attributes of the object (see `lv_obj_opt_attr_t`).
  * @param obj pointer to an object
  * @param free_num the new free number
  */
 void lv_obj_set_free_num(lv_obj_t * obj, LV_OBJ_FREE_NUM_TYPE free_num)
 {
-    obj->free_num = free_num;
+    if(obj->opt_attr == NULL && free_num == 0) return;     /*Don't allocate for the default value*/
+
+    lv_obj_opt_attr_t * opt = get_opt_attr(obj);
+    if(opt == NULL) return;
+
+    opt->free_num = free_num;
 }
 #endif
 
@@ -1206,12 +1392,35 @@ void lv_obj_set_free_num(lv_obj_t * obj, LV_OBJ_FREE_NUM_TYPE free_num)
 /**
  * Set an application specific  pointer for an object.
  * It can help to identify objects in the application.
+ * The first non-NULL value allocates the optional attributes of the object (see `lv_obj_opt_attr_t`).
  * @param obj pointer to an object
  * @param free_p the new free pinter
  */
 void lv_obj_set_free_ptr(lv_obj_t * obj, void * free_p)
 {
-    obj->free_ptr = free_p;
+    if(obj->opt_attr == NULL && free_p == NULL) return;     /*Don't allocate for the default value*/
+
+    lv_obj_opt_attr_t * opt = get_opt_attr(obj);
+    if(opt == NULL) return;
+
+    opt->free_ptr = free_p;
+}
+#endif
+
+#if USE_LV_GROUP
+/**
+ * Set the group of the object. Used by the library, use `lv_group_add_obj` instead.
+ * @param obj pointer to an object
+ * @param group pointer to a group or NULL
+ */
+void lv_obj_set_group(lv_obj_t * obj, void * group)
+{
+    if(obj->opt_attr == NULL && group == NULL) return;     /*Don't allocate for the default value*/
+
+    lv_obj_opt_attr_t * opt = get_opt_attr(obj);
+    if(opt == NULL) return;
+
+    opt->group_p = group;
 }
 #endif
 
@@ -1376,9 +1585,9 @@ lv_obj_t * lv_obj_get_child(const lv_obj_t * obj, const lv_obj_t * child)
     lv_obj_t * result = NULL;
 
     if(child == NULL) {
-        result = lv_ll_get_head(&obj->child_ll);
+        if(obj->child_cnt != 0) result = obj->child_arr[obj->child_cnt - 1];
     } else {
-        result = lv_ll_get_next(&obj->child_ll, child);
+        if(child->child_id != 0) result = obj->child_arr[child->child_id - 1];
     }
 
     return result;
@@ -1396,14 +1605,27 @@ lv_obj_t * lv_obj_get_child_back(const lv_obj_t * obj, const lv_obj_t * child)
     lv_obj_t * result = NULL;
 
     if(child == NULL) {
-        result = lv_ll_get_tail(&obj->child_ll);
+        if(obj->child_cnt != 0) result = obj->child_arr[0];
     } else {
-        result = lv_ll_get_prev(&obj->child_ll, child);
+        if(child->child_id + 1 < obj->child_cnt) result = obj->child_arr[child->child_id + 1];
     }
 
     return result;
 }
 
+/**
+ * Get a child of an object by its index
+ * @param obj pointer to an object
+ * @param id index of the child. 0: the oldest, `lv_obj_count_children(obj) - 1`: the youngest
+ * @return pointer to the child or NULL if `id` is invalid
+ */
+lv_obj_t * lv_obj_get_child_by_id(const lv_obj_t * obj, uint16_t id)
+{
+    if(id >= obj->child_cnt) return NULL;
+
+    return obj->child_arr[id];
+}
+
 /**
  * Count the children of an object (only children directly on 'obj')
  * @param obj pointer to an object
@@ -1411,12 +1633,7 @@ lv_obj_t * lv_obj_get_child_back(const lv_obj_t * obj, const lv_obj_t * child)
  */
 uint16_t lv_obj_count_children(const lv_obj_t * obj)
 {
-    lv_obj_t * i;
-    uint16_t cnt = 0;
-
-    LL_READ(obj->child_ll, i) cnt++;
-
-    return cnt;
+    return obj->child_cnt;
 }
 
 /*---------------------
@@ -1430,6 +1647,7 @@ uint16_t lv_obj_count_children(const lv_obj_t * obj)
  */
 void lv_obj_get_coords(const lv_obj_t * obj, lv_area_t * cords_p)
 {
+    lv_obj_update_coords(obj);
     lv_area_copy(cords_p, &obj->coords);
 }
 
@@ -1443,6 +1661,7 @@ lv_coord_t lv_obj_get_x(const lv_obj_t * obj)
 {
     lv_coord_t rel_x;
     lv_obj_t * parent = lv_obj_get_parent(obj);
+    lv_obj_update_coords(obj);
     rel_x = obj->coords.x1 - parent->coords.x1;
 
     return rel_x;
@@ -1457,6 +1676,7 @@ lv_coord_t lv_obj_get_y(const lv_obj_t * obj)
 {
     lv_coord_t rel_y;
     lv_obj_t * parent = lv_obj_get_parent(obj);
+    lv_obj_update_coords(obj);
     rel_y = obj->coords.y1 - parent->coords.y1;
 
     return rel_y;
@@ -1543,9 +1763,10 @@ lv_style_t * lv_obj_get_style(const lv_obj_t * obj)
         }
     }
 #if USE_LV_GROUP
-    if(obj->group_p) {
-        if(lv_group_get_focused(obj->group_p) == obj) {
-            style_act = lv_group_mod_style(obj->group_p, style_act);
+    lv_group_t * g = lv_obj_get_group(obj);
+    if(g) {
+        if(lv_group_get_focused(g) == obj) {
+            style_act = lv_group_mod_style(g, style_act);
         }
     }
 #endif
@@ -1715,7 +1936,7 @@ void lv_obj_get_type(lv_obj_t * obj, lv_obj_type_t * buf)
     memset(buf, 0, sizeof(lv_obj_type_t));
     memset(&tmp, 0, sizeof(lv_obj_type_t));
 
-    obj->signal_func(obj, LV_SIGNAL_GET_TYPE, &tmp);
+    lv_signal_send(obj, LV_SIGNAL_GET_TYPE, &tmp);
 
     uint8_t cnt;
     for(cnt = 0; cnt < LV_MAX_ANCESTOR_NUM; cnt++) {
@@ -1738,7 +1959,8 @@ void lv_obj_get_type(lv_obj_t * obj, lv_obj_type_t * buf)
  */
 LV_OBJ_FREE_NUM_TYPE lv_obj_get_free_num(const lv_obj_t * obj)
 {
-    return obj->free_num;
+    if(obj->opt_attr == NULL) return 0;
+    return obj->opt_attr->free_num;
 }
 #endif
 
@@ -1750,7 +1972,8 @@ LV_OBJ_FREE_NUM_TYPE lv_obj_get_free_num(const lv_obj_t * obj)
  */
 void * lv_obj_get_free_ptr(const lv_obj_t * obj)
 {
-    return obj->free_ptr;
+    if(obj->opt_attr == NULL) return NULL;
+    return obj->opt_attr->free_ptr;
 }
 #endif
 
@@ -1763,7 +1986,8 @@ void * lv_obj_get_free_ptr(const lv_obj_t * obj)
  */
 void * lv_obj_get_group(const lv_obj_t * obj)
 {
-    return obj->group_p;
+    if(obj->opt_attr == NULL) return NULL;
+    return obj->opt_attr->group_p;
 }
 
 /**
@@ -1773,8 +1997,9 @@ void * lv_obj_get_group(const lv_obj_t * obj)
  */
 bool lv_obj_is_focused(const lv_obj_t * obj)
 {
-    if(obj->group_p) {
-        if(lv_group_get_focused(obj->group_p) == obj) return true;
+    lv_group_t * g = lv_obj_get_group(obj);
+    if(g) {
+        if(lv_group_get_focused(g) == obj) return true;
     }
 
     return false;
@@ -1867,24 +2092,53 @@ static lv_res_t lv_obj_signal(lv_obj_t * obj, lv_signal_t sign, void * param)
 }
 
 /**
- * Reposition the children of an object. (Called recursively)
- * @param obj pointer to an object which children will be repositioned
+ * Add a movement to the not yet applied movement of the descendants of an object
+ * @param obj pointer to an object
  * @param x_diff x coordinate shift
  * @param y_diff y coordinate shift
  */
-static void refresh_children_position(lv_obj_t * obj, lv_coord_t x_diff, lv_coord_t y_diff)
+static void child_shift_add(lv_obj_t * obj, lv_coord_t x_diff, lv_coord_t y_diff)
 {
-    lv_obj_t * i;
-    LL_READ(obj->child_ll, i) {
-        i->coords.x1 += x_diff;
-        i->coords.y1 += y_diff;
-        i->coords.x2 += x_diff;
-        i->coords.y2 += y_diff;
+    bool pending_ori = obj->child_shift.x != 0 || obj->child_shift.y != 0;
+
+    obj->child_shift.x += x_diff;
+    obj->child_shift.y += y_diff;
 
-        refresh_children_position(i, x_diff, y_diff);
+    bool pending = obj->child_shift.x != 0 || obj->child_shift.y != 0;
+    if(pending_ori == false && pending != false) child_shift_cnt++;
+    else if(pending_ori != false && pending == false) child_shift_cnt--;
+}
+
+/**
+ * Forget the not yet applied movement of the descendants of an object (e.g. before deleting it)
+ * @param obj pointer to an object
+ */
+static void child_shift_clear(lv_obj_t * obj)
+{
+    if(obj->child_shift.x != 0 || obj->child_shift.y != 0) {
+        obj->child_shift.x = 0;
+        obj->child_shift.y = 0;
+        child_shift_cnt--;
     }
 }
 
+/**
+ * Move the children bounding box of an object
+ * @param obj pointer to an object
+ * @param x_diff x coordinate shift
+ * @param y_diff y coordinate shift
+ */
+static void shift_child_bound(lv_obj_t * obj, lv_coord_t x_diff, lv_coord_t y_diff)
+{
+    /*Leave the empty bounding box unchanged*/
+    if(obj->child_bound.x1 > obj->child_bound.x2) return;
+
+    obj->child_bound.x1 += x_diff;
+    obj->child_bound.y1 += y_diff;
+    obj->child_bound.x2 += x_diff;
+    obj->child_bound.y2 += y_diff;
+}
+
 /**
  * Refresh the style of all children of an object. (Called recursively)
  * @param style_p refresh objects only with this style.
@@ -1892,8 +2146,9 @@ static void refresh_children_position(lv_obj_t * obj, lv_coord_t x_diff, lv_coor
  */
 static void report_style_mod_core(void * style_p, lv_obj_t * obj)
 {
-    lv_obj_t * i;
-    LL_READ(obj->child_ll, i) {
+    uint16_t id;
+    for(id = obj->child_cnt; id > 0; id--) {
+        lv_obj_t * i = obj->child_arr[id - 1];
         if(i->style_p == style_p || style_p == NULL) {
             refresh_children_style(i);
             lv_obj_refresh_style(i);
@@ -1929,26 +2184,16 @@ static void refresh_children_style(lv_obj_t * obj)
  */
 static void delete_children(lv_obj_t * obj)
 {
-    lv_obj_t * i;
-    lv_obj_t * i_next;
-    i = lv_ll_get_head(&(obj->child_ll));
-
     /*Remove from the group; remove before transversing children so that 
      * the object still has access to all children during the 
      * LV_SIGNAL_DEFOCUS call*/
 #if USE_LV_GROUP
-    if(obj->group_p != NULL) lv_group_remove_obj(obj);
+    if(lv_obj_get_group(obj) != NULL) lv_group_remove_obj(obj);
 #endif
 
-    while(i != NULL) {
-        /*Get the next object before delete this*/
-        i_next = lv_ll_get_next(&(obj->child_ll), i);
-
-        /*Call the recursive del to the child too*/
-        delete_children(i);
-
-        /*Set i to the next node*/
-        i = i_next;
+    /*Delete the children from the youngest. (They remove themselves from `child_arr`)*/
+    while(obj->child_cnt != 0) {
+        delete_children(obj->child_arr[obj->child_cnt - 1]);
     }
 
     /*Remove the animations from this object*/
@@ -1969,13 +2214,97 @@ static void delete_children(lv_obj_t * obj)
 
     /*Remove the object from parent's children list*/
     lv_obj_t * par = lv_obj_get_parent(obj);
-    lv_ll_rem(&(par->child_ll), obj);
+    child_rem(par, obj->child_id);
 
     /* Clean up the object specific data*/
-    obj->signal_func(obj, LV_SIGNAL_CLEANUP, NULL);
+    lv_signal_send(obj, LV_SIGNAL_CLEANUP, NULL);
 
     /*Delete the base objects*/
     if(obj->ext_attr != NULL)  lv_mem_free(obj->ext_attr);
+#if LV_OBJ_OPT_ATTR
+    if(obj->opt_attr != NULL)  lv_mem_free(obj->opt_attr);
+#endif
+    if(obj->child_arr != NULL)  lv_mem_free(obj->child_arr);
+    child_shift_clear(obj);
     lv_mem_free(obj); /*Free the object itself*/
 
 }
+
+/**
+ * Add an object to the end of the `child_arr` of a parent (as the youngest child).
+ * The array is enlarged by doubling its size when it's full (up to `UINT16_MAX` children).
+ * @param par pointer to the parent
+ * @param obj pointer to the new child
+ * @return true: added; false: out of memory or the parent has too many children
+ */
+static bool child_add(lv_obj_t * par, lv_obj_t * obj)
+{
+    /*The new child is already at its absolute position so it mustn't get the saved movement of the others*/
+    lv_obj_update_coords(par);
+    lv_obj_update_children_coords(par);
+
+    if(par->child_cnt >= par->child_arr_size) {
+        if(par->child_arr_size == UINT16_MAX) {
+            LV_LOG_WARN("child_add: the parent can't have more children");
+            return false;
+        }
+
+        /*Compute in 32 bit to not overflow and clamp to the max. number of children*/
+        uint32_t new_size = par->child_arr_size ? (uint32_t)par->child_arr_size * 2 : LV_OBJ_CHILD_ARR_MIN;
+        if(new_size > UINT16_MAX) new_size = UINT16_MAX;
+        lv_obj_t ** new_arr = lv_mem_realloc(par->child_arr, new_size * sizeof(lv_obj_t *));
+        lv_mem_assert(new_arr);
+        if(new_arr == NULL) return false;
+
+        par->child_arr = new_arr;
+        par->child_arr_size = new_size;
+    }
+
+    obj->child_id = par->child_cnt;
+    par->child_arr[par->child_cnt] = obj;
+    par->child_cnt++;
+
+    return true;
+}
+
+/**
+ * Remove a child from the `child_arr` of its parent and keep the order of the others.
+ * @param par pointer to the parent
+ * @param id index of the child to remove
+ */
+static void child_rem(lv_obj_t * par, uint16_t id)
+{
+    uint16_t i;
+    for(i = id; i < par->child_cnt - 1; i++) {
+        par->child_arr[i] = par->child_arr[i + 1];
+        par->child_arr[i]->child_id = i;
+    }
+    par->child_cnt--;
+
+    /*Free the array if there are no more children*/
+    if(par->child_cnt == 0) {
+        lv_mem_free(par->child_arr);
+        par->child_arr = NULL;
+        par->child_arr_size = 0;
+    }
+}
+
+#if LV_OBJ_OPT_ATTR
+/**
+ * Get the optional attributes of an object. Allocate them if not allocated yet.
+ * @param obj pointer to an object
+ * @return pointer to the optional attributes or NULL if the allocation failed
+ */
+static lv_obj_opt_attr_t * get_opt_attr(lv_obj_t * obj)
+{
+    if(obj->opt_attr) return obj->opt_attr;
+
+    obj->opt_attr = lv_mem_alloc(sizeof(lv_obj_opt_attr_t));
+    lv_mem_assert(obj->opt_attr);
+    if(obj->opt_attr == NULL) return NULL;
+
+    memset(obj->opt_attr, 0, sizeof(lv_obj_opt_attr_t));
+
+    return obj->opt_attr;
+}
+#endif
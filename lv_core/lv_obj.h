@@ -54,6 +54,13 @@ extern "C" {
 #endif
 
 
+/*The rarely used attributes are stored out of line in `lv_obj_opt_attr_t`*/
+#if LV_OBJ_FREE_PTR != 0 || USE_LV_GROUP != 0 || defined(LV_OBJ_FREE_NUM_TYPE)
+#define LV_OBJ_OPT_ATTR         1
+#else
+#define LV_OBJ_OPT_ATTR         0
+#endif
+
 #define LV_ANIM_IN              0x00    /*Animation to show an object. 'OR' it with lv_anim_builtin_t*/
 #define LV_ANIM_OUT             0x80    /*Animation to hide an object. 'OR' it with lv_anim_builtin_t*/
 #define LV_ANIM_DIR_MASK        0x80    /*ANIM_IN/ANIM_OUT mask*/
@@ -153,13 +160,39 @@ typedef struct {
 }lv_reailgn_t;
 #endif
 
+#if LV_OBJ_OPT_ATTR
+/* Rarely used attributes of an object. Allocated only when one of them gets a non-default value,
+ * so it costs an extra heap allocation for every such object.
+ * They are not fields of `lv_obj_t` anymore (e.g. `obj->free_ptr` doesn't compile):
+ * use `lv_obj_set/get_free_ptr`, `lv_obj_set/get_free_num` and `lv_obj_get_group`.
+ * `realign` remains in `lv_obj_t`: `lv_obj_align` saves its parameters in almost every object
+ * (for `lv_obj_realign`) so it would allocate this struct for them too.*/
+typedef struct
+{
+#if LV_OBJ_FREE_PTR != 0
+    void * free_ptr;              /*Application specific pointer (set it freely)*/
+#endif
+
+#if USE_LV_GROUP != 0
+    void * group_p;                 /*Pointer to the group of the object*/
+#endif
+
+#ifdef LV_OBJ_FREE_NUM_TYPE
+    LV_OBJ_FREE_NUM_TYPE free_num;          /*Application specific identifier (set it freely)*/
+#endif
+} lv_obj_opt_attr_t;
+#endif
 
 typedef struct _lv_obj_t
 {
     struct _lv_obj_t * par;    /*Pointer to the parent object*/
-    lv_ll_t child_ll;          /*Linked list to store the children objects*/
+    struct _lv_obj_t ** child_arr; /*The children from the oldest (bottom) to the youngest (top)*/
+    uint16_t child_cnt;         /*Number of children in `child_arr`*/
+    uint16_t child_arr_size;    /*Number of allocated places in `child_arr`*/
 
-    lv_area_t coords;               /*Coordinates of the object (x1, y1, x2, y2)*/
+    lv_area_t coords;               /*Absolute coordinates of the object (x1, y1, x2, y2). Read them with `lv_obj_get_coords`*/
+    lv_area_t child_bound;          /*Contains the children with their ext. size (maybe larger). x1 > x2 if empty*/
+    lv_point_t child_shift;         /*Movement of the object not applied to its descendants yet*/
 
     lv_signal_func_t signal_func;     /*Object type specific signal function*/
     lv_design_func_t design_func;     /*Object type specific design function*/
@@ -167,13 +200,10 @@ typedef struct _lv_obj_t
     void * ext_attr;                 /*Object type specific extended data*/
     lv_style_t * style_p;       /*Pointer to the object's style*/
 
-#if LV_OBJ_FREE_PTR != 0
-    void * free_ptr;              /*Application specific pointer (set it freely)*/
+#if LV_OBJ_OPT_ATTR
+    lv_obj_opt_attr_t * opt_attr;   /*Rarely used attributes. NULL if all of them have the default value*/
 #endif
 
-#if USE_LV_GROUP != 0
-    void * group_p;                 /*Pointer to the group of the object*/
-#endif
     /*Attributes and states*/
     uint8_t click         :1;    /*1: Can be pressed by an input device*/
     uint8_t drag          :1;    /*1: Enable the dragging*/
@@ -182,17 +212,17 @@ typedef struct _lv_obj_t
     uint8_t hidden        :1;    /*1: Object is hidden*/
     uint8_t top           :1;    /*1: If the object or its children is clicked it goes to the foreground*/
     uint8_t opa_scale_en  :1;    /*1: opa_scale is set*/
+#if USE_LV_MULTI_LANG
+    uint8_t lang_reg      :1;    /*1: Registered in the language registry (see `lv_lang_obj_reg`)*/
+#endif
     uint8_t protect;            /*Automatically happening actions can be prevented. 'OR'ed values from `lv_protect_t`*/
     lv_opa_t opa_scale;         /*Scale down the opacity by this factor. Effects all children as well*/
 
     lv_coord_t ext_size;        /*EXTtend the size of the object in every direction. E.g. for shadow drawing*/
+    uint16_t child_id;          /*Index in the `child_arr` of the parent*/
 #if LV_OBJ_REALIGN
     lv_reailgn_t realign;
 #endif
-
-#ifdef LV_OBJ_FREE_NUM_TYPE
-    LV_OBJ_FREE_NUM_TYPE free_num;          /*Application specific identifier (set it freely)*/
-#endif
 } lv_obj_t;
 
 typedef lv_res_t (*lv_action_t) (struct _lv_obj_t * obj);
@@ -269,6 +299,13 @@ void lv_obj_clean(lv_obj_t *obj);
  */
 void lv_obj_invalidate(const lv_obj_t * obj);
 
+/**
+ * Mark only an area of the object as invalid. Useful when only a small part of the object changes.
+ * @param obj pointer to an object
+ * @param area the area to redraw in absolute coordinates. It's truncated to the object and its parents.
+ */
+void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area);
+
 /*=====================
  * Setter functions
  *====================*/
@@ -294,12 +331,19 @@ void lv_scr_load(lv_obj_t * scr);
  */
 void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent);
 
+/**
+ * Move an object to the foreground. It will be the youngest child of its parent.
+ * @param obj pointer to an object. Can't be a screen.
+ */
+void lv_obj_move_foreground(lv_obj_t * obj);
+
 /*--------------------
  * Coordinate set
  * ------------------*/
 
 /**
- * Set relative the position of an object (relative to the parent)
+ * Set relative the position of an object (relative to the parent).
+ * The descendants are moved only when they are used (see `lv_obj_update_coords`), so the time doesn't depend on their number.
  * @param obj pointer to an object
  * @param x new distance from the left side of the parent
  * @param y new distance from the top of the parent
@@ -516,10 +560,35 @@ void * lv_obj_allocate_ext_attr(lv_obj_t * obj, uint16_t ext_size);
  */
 void lv_obj_refresh_ext_size(lv_obj_t * obj);
 
+/**
+ * Add the area of an object (with its ext. size) to the children bounding box of its parent.
+ * Called automatically when the coordinates or the ext. size is set.
+ * Needs to be called only if the coordinates are modified directly.
+ * @param obj pointer to an object
+ */
+void lv_obj_refresh_bound(lv_obj_t * obj);
+
+/**
+ * Apply the not yet applied movements of the ancestors of an object to make its `coords` up to date.
+ * Moving an object changes only its own coordinates and the descendants are moved when they are used.
+ * The library's functions call it, it's required only to read `obj->coords` directly.
+ * @param obj pointer to an object
+ */
+void lv_obj_update_coords(const lv_obj_t * obj);
+
+/**
+ * Apply the not yet applied movement of an object to its children (but not to their descendants).
+ * The coordinates of the object itself have to be up to date.
+ * Used when the children are traversed from the parent, e.g. by the drawing.
+ * @param obj pointer to an object
+ */
+void lv_obj_update_children_coords(const lv_obj_t * obj);
+
 #ifdef LV_OBJ_FREE_NUM_TYPE
 /**
  * Set an application specific number for an object.
  * It can help to identify objects in the application.
+ * The first non-zero value allocates the optional attributes of the object (see `lv_obj_opt_attr_t`).
  * @param obj pointer to an object
  * @param free_num the new free number
  */
@@ -530,12 +599,22 @@ void lv_obj_set_free_num(lv_obj_t * obj, LV_OBJ_FREE_NUM_TYPE free_num);
 /**
  * Set an application specific  pointer for an object.
  * It can help to identify objects in the application.
+ * The first non-NULL value allocates the optional attributes of the object (see `lv_obj_opt_attr_t`).
  * @param obj pointer to an object
  * @param free_p the new free pinter
  */
 void lv_obj_set_free_ptr(lv_obj_t * obj, void * free_p);
 #endif
 
+#if USE_LV_GROUP
+/**
+ * Set the group of the object. Used by the library, use `lv_group_add_obj` instead.
+ * @param obj pointer to an object
+ * @param group pointer to a group or NULL
+ */
+void lv_obj_set_group(lv_obj_t * obj, void * group);
+#endif
+
 #if USE_LV_ANIMATION
 /**
  * Animate an object
@@ -611,6 +690,14 @@ lv_obj_t * lv_obj_get_child(const lv_obj_t * obj, const lv_obj_t * child);
  */
 lv_obj_t * lv_obj_get_child_back(const lv_obj_t * obj, const lv_obj_t * child);
 
+/**
+ * Get a child of an object by its index
+ * @param obj pointer to an object
+ * @param id index of the child. 0: the oldest, `lv_obj_count_children(obj) - 1`: the youngest
+ * @return pointer to the child or NULL if `id` is invalid
+ */
+lv_obj_t * lv_obj_get_child_by_id(const lv_obj_t * obj, uint16_t id);
+
 /**
  * Count the children of an object (only children directly on 'obj')
  * @param obj pointer to an object
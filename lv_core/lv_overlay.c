@@ -0,0 +1,335 @@
+/**
+ * @file lv_overlay.c
+ * Cursor overlay: an image composited into the VDB at flush time instead of being an object
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_overlay.h"
+#if USE_LV_OVERLAY
+
+#include <string.h>
+#include "lv_refr.h"
+#include "../lv_hal/lv_hal_disp.h"
+#include "../lv_misc/lv_mem.h"
+#include "../lv_misc/lv_log.h"
+#include "../lv_misc/lv_math.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef LV_OVERLAY_MARGIN
+#define LV_OVERLAY_MARGIN   16      /*Save this many pixels around the image*/
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void win_center(void);
+static bool win_get_scr_area(lv_area_t * area);
+static void flush_saved(const lv_area_t * area);
+static void draw_img(lv_vdb_t * vdb, const lv_area_t * area);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const lv_img_dsc_t * img;
+static lv_area_t img_area;      /*Where the image should be on the screen*/
+static lv_area_t drawn_area;    /*Where the image is on the display now*/
+static bool drawn;
+static lv_color_t * win_buf;    /*The pixels of the objects around the image*/
+static lv_area_t win_area;      /*The area of the saved pixels on the screen*/
+static uint8_t * win_saved;     /*1 bit for every row of `win_area`: 1 if the row is saved*/
+static lv_coord_t win_saved_cnt;
+static bool win_valid;          /*Every row of `win_area` on the screen is saved*/
+static bool restoring;          /*Flushing the saved pixels, so no need to save them again*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Set the image of the overlay. The pixels around the image are saved so moving it
+ * only flushes the old and new area again without redrawing the objects.
+ * @param new_img pointer to an image descriptor (`LV_IMG_CF_TRUE_COLOR`, `LV_IMG_CF_TRUE_COLOR_ALPHA` or
+ *                `LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED`). Only its pointer is saved. NULL to remove the overlay.
+ */
+void lv_overlay_set_img(const lv_img_dsc_t * new_img)
+{
+    /*Redraw the objects where the old image was*/
+    if(img && drawn) lv_inv_area(&drawn_area);
+
+    if(win_buf) {
+        lv_mem_free(win_buf);
+        win_buf = NULL;
+    }
+    win_valid = false;
+    drawn = false;
+    img = NULL;
+
+    if(new_img == NULL) return;
+
+    if(new_img->header.cf != LV_IMG_CF_TRUE_COLOR &&
+            new_img->header.cf != LV_IMG_CF_TRUE_COLOR_ALPHA &&
+            new_img->header.cf != LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED) {
+        LV_LOG_WARN("lv_overlay_set_img: not supported color format");
+        return;
+    }
+
+    img = new_img;
+    img_area.x2 = img_area.x1 + img->header.w - 1;
+    img_area.y2 = img_area.y1 + img->header.h - 1;
+
+    /*Without saved pixels the overlay still works but the objects are redrawn on every move.
+     *The saved pixels are flushed through the VDB so at least one row of them (on the screen) has to fit into it.
+     *The flags of the saved rows are stored after the pixels.*/
+    uint32_t win_w = img->header.w + 2 * LV_OVERLAY_MARGIN;
+    uint32_t win_h = img->header.h + 2 * LV_OVERLAY_MARGIN;
+    uint32_t win_size = win_w * win_h;
+    if(LV_MATH_MIN(win_w, LV_HOR_RES) <= LV_VDB_SIZE) {
+        win_buf = lv_mem_alloc(win_size * sizeof(lv_color_t) + ((win_h + 7) >> 3));
+        if(win_buf) win_saved = (uint8_t *)&win_buf[win_size];
+    } else {
+        LV_LOG_WARN("lv_overlay_set_img: the image is too wide to save the pixels around it");
+    }
+
+    if(win_buf) win_center();
+    else lv_inv_area(&img_area);
+
+    drawn_area = img_area;
+    drawn = true;
+}
+
+/**
+ * Set the position of the overlay image
+ * @param x x coordinate of the top left corner of the image on the screen
+ * @param y y coordinate of the top left corner of the image on the screen
+ */
+void lv_overlay_set_pos(lv_coord_t x, lv_coord_t y)
+{
+    lv_coord_t w = lv_area_get_width(&img_area);
+    lv_coord_t h = lv_area_get_height(&img_area);
+    img_area.x1 = x;
+    img_area.y1 = y;
+    img_area.x2 = x + w - 1;
+    img_area.y2 = y + h - 1;
+}
+
+/**
+ * Get the image of the overlay
+ * @return pointer to the image descriptor or NULL if there is no overlay
+ */
+const lv_img_dsc_t * lv_overlay_get_img(void)
+{
+    return img;
+}
+
+/**
+ * Move the overlay on the display if its position has changed. Called by the refresh task
+ * before the invalid areas are refreshed.
+ * @param round_cb the rounding function of the refresh module (to round the flushed area). Can be NULL.
+ */
+void lv_overlay_refr(void (*round_cb)(lv_area_t *))
+{
+    if(img == NULL) return;
+    if(drawn && drawn_area.x1 == img_area.x1 && drawn_area.y1 == img_area.y1) return;
+
+    lv_area_t scr_area;
+    scr_area.x1 = 0;
+    scr_area.y1 = 0;
+    scr_area.x2 = LV_HOR_RES - 1;
+    scr_area.y2 = LV_VER_RES - 1;
+
+    /*The area to flush: the old and the new image*/
+    lv_area_t flush_area;
+    if(drawn) lv_area_join(&flush_area, &drawn_area, &img_area);
+    else lv_area_copy(&flush_area, &img_area);
+    if(round_cb) round_cb(&flush_area);
+    bool on_scr = lv_area_intersect(&flush_area, &flush_area, &scr_area);
+
+    if(on_scr == false) {
+        /*Nothing to do*/
+    }
+    /*If the pixels around are saved simply flush them with the image on its new position*/
+    else if(win_buf && win_valid && lv_area_is_in(&flush_area, &win_area)) {
+        flush_saved(&flush_area);
+    }
+    /*Else the pixels around the new position need to be saved. Redraw the objects there.*/
+    else {
+        if(drawn) lv_inv_area(&drawn_area);
+        if(win_buf) win_center();
+        else lv_inv_area(&img_area);
+    }
+
+    drawn_area = img_area;
+    drawn = true;
+}
+
+/**
+ * Save the pixels under the overlay and draw the overlay image into the VDB.
+ * Called by `lv_vdb_flush` before the VDB is sent to the display.
+ * @param vdb pointer to the VDB to flush
+ */
+void lv_overlay_flush_prep(lv_vdb_t * vdb)
+{
+    if(img == NULL) return;
+
+    /*With custom pixel format the pixels can't be read and written*/
+    lv_disp_t * disp = lv_disp_get_active();
+    if(disp && disp->driver.vdb_wr) return;
+
+    lv_area_t com;
+
+    /*Save the pixels of the objects around the image*/
+    if(win_buf && restoring == false && lv_area_intersect(&com, &vdb->area, &win_area)) {
+        lv_coord_t vdb_w = lv_area_get_width(&vdb->area);
+        lv_coord_t win_w = lv_area_get_width(&win_area);
+        uint32_t line_size = lv_area_get_width(&com) * sizeof(lv_color_t);
+        lv_coord_t y;
+        for(y = com.y1; y <= com.y2; y++) {
+            memcpy(&win_buf[(uint32_t)(y - win_area.y1) * win_w + com.x1 - win_area.x1],
+                   &vdb->buf[(uint32_t)(y - vdb->area.y1) * vdb_w + com.x1 - vdb->area.x1], line_size);
+        }
+
+        /*Count the rows which are saved in their whole (visible) width*/
+        lv_area_t win_scr;
+        if(win_valid == false && win_get_scr_area(&win_scr) && com.x1 <= win_scr.x1 && com.x2 >= win_scr.x2) {
+            for(y = com.y1; y <= com.y2; y++) {
+                uint32_t row = y - win_area.y1;
+                if((win_saved[row >> 3] & (1 << (row & 0x7))) == 0) {
+                    win_saved[row >> 3] |= 1 << (row & 0x7);
+                    win_saved_cnt++;
+                }
+            }
+            if(win_saved_cnt >= lv_area_get_height(&win_scr)) win_valid = true;
+        }
+    }
+
+    if(lv_area_intersect(&com, &vdb->area, &img_area)) draw_img(vdb, &com);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Put the area of the saved pixels around the image and redraw the objects there to save them
+ */
+static void win_center(void)
+{
+    win_area.x1 = img_area.x1 - LV_OVERLAY_MARGIN;
+    win_area.y1 = img_area.y1 - LV_OVERLAY_MARGIN;
+    win_area.x2 = img_area.x2 + LV_OVERLAY_MARGIN;
+    win_area.y2 = img_area.y2 + LV_OVERLAY_MARGIN;
+
+    /*The pixels are saved in `lv_overlay_flush_prep` when this area is refreshed.
+     *They are valid only when all the rows are saved (the refresh might be split or postponed).*/
+    memset(win_saved, 0, (lv_area_get_height(&win_area) + 7) >> 3);
+    win_saved_cnt = 0;
+    win_valid = false;
+    lv_inv_area(&win_area);
+}
+
+/**
+ * Get the part of the saved area which is on the screen
+ * @param area store the result area here
+ * @return false: the saved area is out of the screen
+ */
+static bool win_get_scr_area(lv_area_t * area)
+{
+    lv_area_t scr_area;
+    scr_area.x1 = 0;
+    scr_area.y1 = 0;
+    scr_area.x2 = LV_HOR_RES - 1;
+    scr_area.y2 = LV_VER_RES - 1;
+
+    return lv_area_intersect(area, &win_area, &scr_area);
+}
+
+/**
+ * Flush the saved pixels of an area with the image on its actual position
+ * @param area the area to flush. Should be on the screen and in the saved area.
+ */
+static void flush_saved(const lv_area_t * area)
+{
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t win_w = lv_area_get_width(&win_area);
+    lv_coord_t max_row = LV_VDB_SIZE / w;
+    uint32_t line_size = w * sizeof(lv_color_t);
+    lv_coord_t row;
+    lv_coord_t y;
+
+    restoring = true;
+    for(row = area->y1; row <= area->y2; row += max_row) {
+        lv_vdb_t * vdb = lv_vdb_get();
+        vdb->area.x1 = area->x1;
+        vdb->area.x2 = area->x2;
+        vdb->area.y1 = row;
+        vdb->area.y2 = row + max_row - 1;
+        if(vdb->area.y2 > area->y2) vdb->area.y2 = area->y2;
+
+        for(y = vdb->area.y1; y <= vdb->area.y2; y++) {
+            memcpy(&vdb->buf[(uint32_t)(y - vdb->area.y1) * w],
+                   &win_buf[(uint32_t)(y - win_area.y1) * win_w + area->x1 - win_area.x1], line_size);
+        }
+
+        /*The image is drawn in `lv_overlay_flush_prep`*/
+        lv_vdb_flush();
+    }
+    restoring = false;
+}
+
+/**
+ * Draw the image into the VDB
+ * @param vdb pointer to a VDB
+ * @param area the common area of the image and the VDB
+ */
+static void draw_img(lv_vdb_t * vdb, const lv_area_t * area)
+{
+    bool alpha_byte = img->header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA ? true : false;
+    bool chroma_key = img->header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED ? true : false;
+    uint8_t px_size_byte = alpha_byte ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+    lv_color_t chroma_key_color = LV_COLOR_TRANSP;
+    lv_coord_t vdb_w = lv_area_get_width(&vdb->area);
+    lv_coord_t img_w = img->header.w;
+    lv_coord_t x;
+    lv_coord_t y;
+
+    for(y = area->y1; y <= area->y2; y++) {
+        const uint8_t * px_color_p = &img->data[((uint32_t)(y - img_area.y1) * img_w + area->x1 - img_area.x1) * px_size_byte];
+        lv_color_t * dest = &vdb->buf[(uint32_t)(y - vdb->area.y1) * vdb_w + area->x1 - vdb->area.x1];
+        for(x = area->x1; x <= area->x2; x++, px_color_p += px_size_byte, dest++) {
+            lv_color_t px_color;
+            lv_opa_t px_opa = LV_OPA_COVER;
+            if(alpha_byte) {
+#if LV_COLOR_DEPTH == 8 || LV_COLOR_DEPTH == 1
+                px_color.full = px_color_p[0];
+#elif LV_COLOR_DEPTH == 16
+                /*Because of Alpha byte 16 bit color can start on odd address which can cause crash*/
+                px_color.full = px_color_p[0] + (px_color_p[1] << 8);
+#elif LV_COLOR_DEPTH == 24 || LV_COLOR_DEPTH == 32
+                px_color = *((lv_color_t *)px_color_p);
+#endif
+                px_opa = px_color_p[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+            } else {
+                px_color = *((lv_color_t *)px_color_p);
+            }
+
+            if(chroma_key && px_color.full == chroma_key_color.full) continue;
+
+            if(px_opa == LV_OPA_COVER) *dest = px_color;
+            else if(px_opa != LV_OPA_TRANSP) *dest = lv_color_mix(px_color, *dest, px_opa);
+        }
+    }
+}
+
+#endif /*USE_LV_OVERLAY*/
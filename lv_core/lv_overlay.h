@@ -0,0 +1,92 @@
+/**
+ * @file lv_overlay.h
+ * Cursor overlay: an image composited into the VDB at flush time instead of being an object
+ */
+
+#ifndef LV_OVERLAY_H
+#define LV_OVERLAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifdef LV_CONF_INCLUDE_SIMPLE
+#include "lv_conf.h"
+#else
+#include "../../lv_conf.h"
+#endif
+
+#if USE_LV_OVERLAY
+
+#if LV_VDB_SIZE == 0 || LV_VDB_TRUE_DOUBLE_BUFFERED
+#error "lv_overlay: VDB is required and LV_VDB_TRUE_DOUBLE_BUFFERED is not supported (LV_VDB_SIZE > 0, LV_VDB_TRUE_DOUBLE_BUFFERED  0)"
+#endif
+
+#include "lv_vdb.h"
+
+#if LV_VDB_PACKED
+#error "lv_overlay: packed VDB is not supported (LV_VDB_PX_BPP = 1, 2 or 4)"
+#endif
+#include "../lv_draw/lv_draw_img.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Set the image of the overlay. The pixels around the image are saved so moving it
+ * only flushes the old and new area again without redrawing the objects.
+ * @param img pointer to an image descriptor (`LV_IMG_CF_TRUE_COLOR`, `LV_IMG_CF_TRUE_COLOR_ALPHA` or
+ *            `LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED`). Only its pointer is saved. NULL to remove the overlay.
+ */
+void lv_overlay_set_img(const lv_img_dsc_t * img);
+
+/**
+ * Set the position of the overlay image
+ * @param x x coordinate of the top left corner of the image on the screen
+ * @param y y coordinate of the top left corner of the image on the screen
+ */
+void lv_overlay_set_pos(lv_coord_t x, lv_coord_t y);
+
+/**
+ * Get the image of the overlay
+ * @return pointer to the image descriptor or NULL if there is no overlay
+ */
+const lv_img_dsc_t * lv_overlay_get_img(void);
+
+/**
+ * Move the overlay on the display if its position has changed. Called by the refresh task
+ * before the invalid areas are refreshed.
+ * @param round_cb the rounding function of the refresh module (to round the flushed area). Can be NULL.
+ */
+void lv_overlay_refr(void (*round_cb)(lv_area_t *));
+
+/**
+ * Save the pixels under the overlay and draw the overlay image into the VDB.
+ * Called by `lv_vdb_flush` before the VDB is sent to the display.
+ * @param vdb pointer to the VDB to flush
+ */
+void lv_overlay_flush_prep(lv_vdb_t * vdb);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*USE_LV_OVERLAY*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_OVERLAY_H*/
@@ -0,0 +1,195 @@
+/**
+ * @file lv_quality.c
+ * Reduce the drawing quality while animating or dragging if the frames are too slow
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_quality.h"
+#if USE_LV_QUALITY_GOV
+
+#include <string.h>
+#include "lv_refr.h"
+#include "../lv_hal/lv_hal_indev.h"
+#include "../lv_hal/lv_hal_tick.h"
+#include "../lv_misc/lv_anim.h"
+#include "../lv_misc/lv_gc.h"
+#include "../lv_misc/lv_log.h"
+#include "../lv_misc/lv_math.h"
+
+#if defined(LV_GC_INCLUDE)
+#   include LV_GC_INCLUDE
+#endif /* LV_ENABLE_GC */
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_QUALITY_DELAY_MAX    (LV_QUALITY_RESTORE_DELAY * 8)  /*Max. quiet period after premature restores*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool is_active(void);
+static void quality_change(lv_quality_t q);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_quality_t quality = LV_QUALITY_FULL;
+static uint32_t target_us = LV_QUALITY_FRAME_TIME * 1000;
+static lv_quality_cb_t quality_cb;
+static lv_quality_stat_t stat;
+static uint32_t quiet_start;    /*Tick when nothing moved last time*/
+static uint32_t restore_tick;   /*Tick of the last restore of the full quality*/
+static uint32_t restore_delay = LV_QUALITY_RESTORE_DELAY;   /*Required quiet period before restoring*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Called by the display refresh task in every run to decide about the quality
+ * @param refr true: a frame was refreshed in this run
+ * @param time_us the time of the refreshed frame in microseconds
+ */
+void lv_quality_update(bool refr, uint32_t time_us)
+{
+    bool slow = false;
+
+    if(refr) {
+        stat.frame_cnt++;
+        if(quality == LV_QUALITY_LOW) stat.low_frame_cnt++;
+        if(target_us != 0 && time_us > target_us) {
+            stat.slow_cnt++;
+            slow = true;
+        }
+    }
+
+    if(quality == LV_QUALITY_FULL) {
+        /*Reduce the quality only for the moving things. A slow static screen is refreshed once anyway.*/
+        if(slow && is_active()) {
+            quality_change(LV_QUALITY_LOW);
+            if(quality == LV_QUALITY_LOW) {
+                /*Reduced again soon after a restore: wait longer before the next restore.
+                 *The frames in low quality are fast only because of the low quality, so they tell nothing.*/
+                if(stat.restore_cnt != 0 && lv_tick_elaps(restore_tick) < restore_delay) {
+                    restore_delay = LV_MATH_MIN(restore_delay * 2, LV_QUALITY_DELAY_MAX);
+                } else {
+                    restore_delay = LV_QUALITY_RESTORE_DELAY;
+                }
+                quiet_start = lv_tick_get();
+            }
+        }
+    } else {
+        /*Redraw in full quality (the whole screen) only when nothing has moved for a while*/
+        if(is_active()) {
+            quiet_start = lv_tick_get();
+        } else if(lv_tick_elaps(quiet_start) >= restore_delay) {
+            quality_change(LV_QUALITY_FULL);
+            if(quality == LV_QUALITY_FULL) restore_tick = lv_tick_get();
+        }
+    }
+}
+
+/**
+ * Get the actual drawing quality
+ * @return `LV_QUALITY_FULL` or `LV_QUALITY_LOW`
+ */
+lv_quality_t lv_quality_get(void)
+{
+    return quality;
+}
+
+/**
+ * Set the target frame time. Slower frames reduce the quality while animating or dragging.
+ * @param ms the target frame time in milliseconds. 0 to keep the full quality.
+ */
+void lv_quality_set_target(uint32_t ms)
+{
+    target_us = ms * 1000;
+}
+
+/**
+ * Set a function to call when the governor changes the quality
+ * @param cb the callback. It can reject the change. NULL to accept every change.
+ */
+void lv_quality_set_cb(lv_quality_cb_t cb)
+{
+    quality_cb = cb;
+}
+
+/**
+ * Get the statistics of the governor's decisions
+ * @param stat_p pointer to a variable to store the statistics
+ */
+void lv_quality_get_stat(lv_quality_stat_t * stat_p)
+{
+    memcpy(stat_p, &stat, sizeof(lv_quality_stat_t));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Check whether something moves on the screen: an animation is running or an object is dragged.
+ * The repeating animations (e.g. preloaders, rolling labels) never end so they are not considered.
+ * @return true: something moves
+ */
+static bool is_active(void)
+{
+#if USE_LV_ANIMATION
+    lv_anim_t * a;
+    LL_READ(LV_GC_ROOT(_lv_anim_ll), a) {
+        if(a->repeat == 0) return true;
+    }
+#endif
+
+    lv_indev_t * indev = NULL;
+    while((indev = lv_indev_next(indev)) != NULL) {
+        if(indev->driver.type == LV_INDEV_TYPE_POINTER && indev->proc.drag_in_prog) return true;
+    }
+
+    return false;
+}
+
+/**
+ * Change the quality if the callback accepts it
+ * @param q the new quality
+ */
+static void quality_change(lv_quality_t q)
+{
+    if(quality_cb && quality_cb(q) == false) {
+        stat.reject_cnt++;
+        return;
+    }
+
+    quality = q;
+
+    if(q == LV_QUALITY_LOW) {
+        LV_LOG_TRACE("lv_quality: reduce the quality");
+        stat.reduce_cnt++;
+    } else {
+        LV_LOG_TRACE("lv_quality: restore the full quality");
+        stat.restore_cnt++;
+
+        /*Redraw everything which was drawn in low quality*/
+        lv_area_t scr_area;
+        scr_area.x1 = 0;
+        scr_area.y1 = 0;
+        scr_area.x2 = LV_HOR_RES - 1;
+        scr_area.y2 = LV_VER_RES - 1;
+        lv_inv_area(&scr_area);
+    }
+}
+
+#endif /*USE_LV_QUALITY_GOV*/
@@ -0,0 +1,103 @@
+/**
+ * @file lv_quality.h
+ * Reduce the drawing quality while animating or dragging if the frames are too slow
+ */
+
+#ifndef LV_QUALITY_H
+#define LV_QUALITY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifdef LV_CONF_INCLUDE_SIMPLE
+#include "lv_conf.h"
+#else
+#include "../../lv_conf.h"
+#endif
+
+#if USE_LV_QUALITY_GOV
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+enum {
+    LV_QUALITY_FULL = 0,        /*Draw everything*/
+    LV_QUALITY_LOW,             /*Skip the shadows and draw the rectangles without rounded (anti-aliased) corners*/
+};
+typedef uint8_t lv_quality_t;
+
+/**
+ * Called when the governor changes the quality
+ * @param quality the new quality
+ * @return true: accept the change; false: keep the current quality
+ */
+typedef bool (*lv_quality_cb_t)(lv_quality_t quality);
+
+/*Decisions of the governor*/
+typedef struct {
+    uint32_t frame_cnt;         /*Number of refreshed frames*/
+    uint32_t slow_cnt;          /*Frames slower than the target frame time*/
+    uint32_t low_frame_cnt;     /*Frames drawn with `LV_QUALITY_LOW`*/
+    uint32_t reduce_cnt;        /*Number of changes to `LV_QUALITY_LOW`*/
+    uint32_t restore_cnt;       /*Number of changes back to `LV_QUALITY_FULL`*/
+    uint32_t reject_cnt;        /*Changes rejected by the callback*/
+} lv_quality_stat_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Called by the display refresh task in every run to decide about the quality
+ * @param refr true: a frame was refreshed in this run
+ * @param time_us the time of the refreshed frame in microseconds
+ */
+void lv_quality_update(bool refr, uint32_t time_us);
+
+/**
+ * Get the actual drawing quality
+ * @return `LV_QUALITY_FULL` or `LV_QUALITY_LOW`
+ */
+lv_quality_t lv_quality_get(void);
+
+/**
+ * Set the target frame time. Slower frames reduce the quality while animating or dragging.
+ * @param ms the target frame time in milliseconds. 0 to keep the full quality.
+ */
+void lv_quality_set_target(uint32_t ms);
+
+/**
+ * Set a function to call when the governor changes the quality
+ * @param cb the callback. It can reject the change. NULL to accept every change.
+ */
+void lv_quality_set_cb(lv_quality_cb_t cb);
+
+/**
+ * Get the statistics of the governor's decisions
+ * @param stat_p pointer to a variable to store the statistics
+ */
+void lv_quality_get_stat(lv_quality_stat_t * stat_p);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*USE_LV_QUALITY_GOV*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_QUALITY_H*/
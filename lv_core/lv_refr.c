@@ -13,6 +13,15 @@
 #include "../lv_hal/lv_hal_disp.h"
 #include "../lv_misc/lv_task.h"
 #include "../lv_misc/lv_mem.h"
+#include "../lv_misc/lv_trace.h"
+#include "../lv_draw/lv_draw_dl.h"
+#include "../lv_draw/lv_draw_vpacked.h"
+#include "../lv_draw/lv_draw_rbasic.h"
+#include "../lv_hal/lv_hal_indev.h"
+#include "lv_signal.h"
+#include "lv_overlay.h"
+#include "lv_group.h"
+#include "lv_quality.h"
 
 /*********************
  *      DEFINES
@@ -21,6 +30,22 @@
 #define LV_INV_FIFO_SIZE    32    /*The average count of objects on a screen */
 #endif
 
+/*Join the areas by the cost of refreshing them only if they are refreshed and flushed in parts*/
+#if LV_REFR_FLUSH_COST && LV_VDB_SIZE != 0 && LV_VDB_TRUE_DOUBLE_BUFFERED == 0
+#define LV_REFR_JOIN_COST   1
+#else
+#define LV_REFR_JOIN_COST   0
+#endif
+
+#define LV_REFR_REPAINT_PREV    (LV_VDB_SIZE != 0 && LV_VDB_TRUE_DOUBLE_BUFFERED && LV_VDB_TRUE_DOUBLE_REPAINT)
+
+/*Interrupt the refreshing by the time budget only if the areas are flushed separately*/
+#if LV_REFR_BUDGET && LV_VDB_TRUE_DOUBLE_BUFFERED == 0
+#define LV_REFR_YIELD       1
+#else
+#define LV_REFR_YIELD       0
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -34,16 +59,36 @@ typedef struct {
  **********************/
 static void lv_refr_task(void * param);
 static void lv_refr_join_area(void);
+#if LV_REFR_YIELD == 0
 static void lv_refr_areas(void);
+#endif
 #if LV_VDB_SIZE == 0
 static void lv_refr_area_no_vdb(const lv_area_t * area_p);
 #else
-static void lv_refr_area_with_vdb(const lv_area_t * area_p);
+static lv_coord_t lv_refr_area_with_vdb(const lv_area_t * area_p);
 static void lv_refr_area_part_vdb(const lv_area_t * area_p);
 #endif
+static void lv_refr_draw(const lv_area_t * mask_p);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void lv_refr_obj_and_children(lv_obj_t * top_p, const lv_area_t * mask_p);
 static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p);
+static void lv_refr_round_area(lv_area_t * area_p);
+#if LV_REFR_JOIN_COST
+static uint32_t lv_refr_get_cost(const lv_area_t * area_p);
+#endif
+#if LV_REFR_REPAINT_PREV
+static void lv_refr_add_prev_area(void);
+#endif
+#if USE_LV_VSYNC
+static void lv_refr_vsync_task(void * param);
+#endif
+#if LV_REFR_YIELD
+static bool lv_refr_areas_budget(uint32_t start);
+static bool lv_refr_budget_over(void);
+static uint16_t lv_refr_get_next_area(const lv_point_t * p);
+static bool lv_refr_get_input_point(lv_point_t * p);
+static void lv_refr_keep_pending(void);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -53,6 +98,31 @@ static uint16_t inv_buf_p;
 static void (*monitor_cb)(uint32_t, uint32_t); /*Monitor the rendering time*/
 static void (*round_cb)(lv_area_t *);          /*If set then called to modify invalidated areas for special display controllers*/
 static uint32_t px_num;
+static uint32_t refr_time_us;                  /*Duration of the last refresh*/
+static lv_task_t * refr_task;
+#if LV_VDB_SIZE != 0 && LV_REFR_DISP_LIST
+static bool dl_valid;                          /*The display list contains the drawings of the actual area*/
+#endif
+#if LV_REFR_REPAINT_PREV
+static lv_area_t inv_prev[LV_INV_FIFO_SIZE];   /*The invalid areas of the previous frame. The new VDB doesn't contain them yet.*/
+static uint16_t inv_prev_p;
+#endif
+#if USE_LV_VSYNC
+static volatile uint32_t vsync_cnt;            /*Number of `lv_refr_vsync` calls*/
+static volatile uint32_t vsync_time_us;        /*Time of the last vsync*/
+static uint32_t vsync_cnt_refr;                /*`vsync_cnt` at the last refresh*/
+static uint32_t vsync_cnt_reset;               /*`vsync_cnt` at the last reset of the statistics*/
+static lv_refr_vsync_stat_t vsync_stat;
+static uint32_t frame_prev_us;                 /*Start of the previous frame*/
+static uint32_t period_prev_us;                /*Period of the previous frame. 0: unknown*/
+static bool frame_prev_valid;                  /*The previous vsync started a frame*/
+static bool refr_done;                         /*Set when the refresh task has refreshed something*/
+#endif
+#if LV_REFR_YIELD
+static bool refr_pending;                      /*The time budget was used up before all areas were refreshed*/
+static uint32_t refr_time_pending_us;          /*Duration of the already refreshed parts of the pending frame*/
+static uint32_t budget_start_us;               /*Start time of the actual refresh task call*/
+#endif
 
 /**********************
  *      MACROS
@@ -71,8 +141,15 @@ void lv_refr_init(void)
     memset(inv_buf, 0, sizeof(inv_buf));
 
     lv_task_t * task;
+#if USE_LV_VSYNC
+    /*Run the refreshing on vsync. The periodic calls only check whether a vsync was missed.*/
+    lv_refr_reset_vsync_stat();
+    task = lv_task_create(lv_refr_vsync_task, LV_REFR_PERIOD, LV_TASK_PRIO_MID, NULL);
+#else
     task = lv_task_create(lv_refr_task, LV_REFR_PERIOD, LV_TASK_PRIO_MID, NULL);
+#endif
     lv_task_ready(task);        /*Be sure the screen will be refreshed immediately on start up*/
+    refr_task = task;
 }
 
 /**
@@ -83,7 +160,14 @@ void lv_refr_init(void)
  */
 void lv_refr_now(void)
 {
+#if LV_REFR_YIELD
+    /*Refresh all areas regardless the time budget*/
+    do {
+        lv_refr_task(NULL);
+    } while(refr_pending);
+#else
     lv_refr_task(NULL);
+#endif
 }
 
 
@@ -112,7 +196,7 @@ void lv_inv_area(const lv_area_t * area_p)
 
     /*The area is truncated to the screen*/
     if(suc != false) {
-        if(round_cb) round_cb(&com_area);
+        if(round_cb) lv_refr_round_area(&com_area);
 
         /*Save only if this area is not in one of the saved areas*/
         uint16_t i;
@@ -143,6 +227,16 @@ void lv_refr_set_monitor_cb(void (*cb)(uint32_t, uint32_t))
     monitor_cb = cb;
 }
 
+/**
+ * Get the duration of the last refresh with microsecond resolution (if `LV_TICK_US_CUSTOM` is enabled).
+ * Can be called from the monitor callback to get a more precise time than `time_ms`
+ * @return the duration of the last refresh in microseconds
+ */
+uint32_t lv_refr_get_time_us(void)
+{
+    return refr_time_us;
+}
+
 /**
  * Called when an area is invalidated to modify the coordinates of the area.
  * Special display controllers may require special coordinate rounding
@@ -172,6 +266,43 @@ void lv_refr_pop_from_buf(uint16_t num)
     else inv_buf_p -= num;
 }
 
+#if USE_LV_VSYNC
+/**
+ * Signal the vertical sync or tearing effect of the display. The screen is refreshed right after it
+ * if there are invalid areas. Can be called from an interrupt.
+ */
+void lv_refr_vsync(void)
+{
+    vsync_time_us = lv_tick_get_us();
+    vsync_cnt++;
+
+    if(refr_task) lv_task_ready(refr_task);
+}
+
+/**
+ * Get the frame timing statistics since the last `lv_refr_reset_vsync_stat()`
+ * @param stat pointer to a variable to store the statistics
+ */
+void lv_refr_get_vsync_stat(lv_refr_vsync_stat_t * stat)
+{
+    memcpy(stat, &vsync_stat, sizeof(lv_refr_vsync_stat_t));
+    stat->vsync_cnt = vsync_cnt - vsync_cnt_reset;
+    if(stat->period_max_us == 0) stat->period_min_us = 0;
+}
+
+/**
+ * Reset the frame timing statistics
+ */
+void lv_refr_reset_vsync_stat(void)
+{
+    memset(&vsync_stat, 0, sizeof(lv_refr_vsync_stat_t));
+    vsync_stat.period_min_us = UINT32_MAX;
+    vsync_cnt_reset = vsync_cnt;
+    frame_prev_valid = false;
+    period_prev_us = 0;
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -186,16 +317,59 @@ static void lv_refr_task(void * param)
 
     LV_LOG_TRACE("display refresh task started");
 
-    uint32_t start = lv_tick_get();
+    uint32_t start = lv_tick_get_us();
 
     if(lv_disp_get_active() == NULL) {
         LV_LOG_TRACE("No display is registered");
         return;
     }
 
+    LV_TRACE_BEGIN(LV_TRACE_EVT_REFR, inv_buf_p);
+
+#if USE_LV_OVERLAY
+    /*Move the cursor image first. It might invalidate areas to save the pixels around it.
+     *Not while a frame is continued: its areas (maybe with the pixels to save) are drawn only partially.*/
+#if LV_REFR_YIELD
+    if(refr_pending == false)
+#endif
+    {
+        lv_overlay_refr(round_cb ? lv_refr_round_area : NULL);
+    }
+#endif
+
+#if LV_REFR_REPAINT_PREV
+    if(inv_buf_p != 0) {
+        /*Don't draw into the new VDB while the display might still show it*/
+        while(lv_vdb_is_flushing());
+
+        lv_refr_add_prev_area();
+    }
+#endif
+
     lv_refr_join_area();
 
+#if USE_LV_VSYNC
+    if(inv_buf_p != 0) refr_done = true;
+#endif
+
+#if LV_REFR_YIELD
+    refr_pending = lv_refr_areas_budget(start) == false ? true : false;
+    if(refr_pending) {
+        /*The time budget is used up. Keep the remaining areas and continue after the other tasks.*/
+        lv_refr_keep_pending();
+        refr_time_pending_us += lv_tick_elaps_us(start);
+        lv_task_ready(refr_task);
+
+        LV_TRACE_END(LV_TRACE_EVT_REFR, 0);
+        return;
+    }
+#else
     lv_refr_areas();
+#endif
+
+#if USE_LV_QUALITY_GOV
+    bool refr = inv_buf_p != 0 ? true : false;
+#endif
 
     /*If refresh happened ...*/
     if(inv_buf_p != 0) {
@@ -211,6 +385,7 @@ static void lv_refr_task(void * param)
         /*Flush the content of the VDB*/
         lv_vdb_flush();
 
+#if LV_VDB_TRUE_DOUBLE_REPAINT == 0
         /* With true double buffering the flushing should be only the address change of the current frame buffer
          * Wait until the address change is ready and copy the active content to the other frame buffer (new active VDB)
          * The changes will be written to the new VDB.*/
@@ -233,6 +408,7 @@ static void lv_refr_task(void * param)
                 }
             }
         }
+#endif
 
 #endif
 
@@ -240,55 +416,216 @@ static void lv_refr_task(void * param)
         memset(inv_buf, 0, sizeof(inv_buf));
         inv_buf_p = 0;
 
+        refr_time_us = lv_tick_elaps_us(start);
+
+#if LV_REFR_YIELD
+        refr_time_us += refr_time_pending_us;
+        refr_time_pending_us = 0;
+#endif
+
+        /*Close the statistics of this frame. The idle calls of the task don't start a new frame.*/
+#if LV_SIGNAL_STAT
+        lv_signal_stat_frame();
+#endif
+
+#if LV_VDB_SIZE != 0 && LV_VDB_FLUSH_STAT
+        lv_vdb_flush_stat_frame();
+#endif
+
         /*Call monitor cb if present*/
         if(monitor_cb != NULL) {
-            monitor_cb(lv_tick_elaps(start), px_num);
+            monitor_cb(refr_time_us / 1000, px_num);
         }
+
+#if LV_REFR_YIELD
+        px_num = 0;
+#endif
     }
 
+    LV_TRACE_END(LV_TRACE_EVT_REFR, 0);
+
+#if USE_LV_QUALITY_GOV
+    /*Decide about the quality of the next frames*/
+    lv_quality_update(refr, refr_time_us);
+#endif
+
     LV_LOG_TRACE("display refresh task finished");
 }
 
 
+#if USE_LV_VSYNC
+/**
+ * Called periodically and on vsync. Refresh the screen only once after every vsync and measure the frame timing.
+ * @param param unused
+ */
+static void lv_refr_vsync_task(void * param)
+{
+    uint32_t cnt = vsync_cnt;
+    uint32_t vsync_us = vsync_time_us;
+
+#if LV_REFR_YIELD
+    /*Continue the frame which didn't fit into the time budget*/
+    if(refr_pending) {
+        lv_refr_task(param);
+        if(refr_pending == false && vsync_cnt != vsync_cnt_refr) vsync_stat.late_cnt++;
+        return;
+    }
+#endif
+
+    /*Refresh only once per vsync*/
+    if(cnt == vsync_cnt_refr) return;
+    vsync_cnt_refr = cnt;
+
+    uint32_t start = lv_tick_get_us();
+    refr_done = false;
+    lv_refr_task(param);
+
+    /*If nothing was refreshed the next frame doesn't follow this one*/
+    if(refr_done == false) {
+        frame_prev_valid = false;
+        period_prev_us = 0;
+        return;
+    }
+
+    vsync_stat.frame_cnt++;
+
+    uint32_t latency = start - vsync_us;
+    if(latency > vsync_stat.latency_max_us) vsync_stat.latency_max_us = latency;
+
+    /*If an other vsync came during the rendering the frame is late*/
+#if LV_REFR_YIELD
+    if(vsync_cnt != cnt && refr_pending == false) vsync_stat.late_cnt++;
+#else
+    if(vsync_cnt != cnt) vsync_stat.late_cnt++;
+#endif
+
+    if(frame_prev_valid) {
+        uint32_t period = start - frame_prev_us;
+        if(period < vsync_stat.period_min_us) vsync_stat.period_min_us = period;
+        if(period > vsync_stat.period_max_us) vsync_stat.period_max_us = period;
+
+        /*Running averages with 1/16 gain*/
+        if(vsync_stat.period_avg_us == 0) vsync_stat.period_avg_us = period;
+        else vsync_stat.period_avg_us += ((int32_t)period - (int32_t)vsync_stat.period_avg_us) / 16;
+
+        if(period_prev_us != 0) {
+            int32_t d = (int32_t)period - (int32_t)period_prev_us;
+            if(d < 0) d = -d;
+            vsync_stat.jitter_us += (d - (int32_t)vsync_stat.jitter_us) / 16;
+        }
+        period_prev_us = period;
+    }
+
+    frame_prev_us = start;
+    frame_prev_valid = true;
+}
+#endif
+
+#if LV_REFR_REPAINT_PREV
+/**
+ * Add the invalid areas of the previous frame to the current ones and save the current ones for the next frame.
+ * The new VDB has the image of two frames ago so it needs to be repainted where the previous frame has changed too.
+ */
+static void lv_refr_add_prev_area(void)
+{
+    uint16_t cur_p = inv_buf_p;
+    uint16_t i;
+    uint16_t j;
+    bool full = false;
+
+    for(i = 0; i < inv_prev_p; i++) {
+        /*Skip the areas which are repainted anyway*/
+        for(j = 0; j < cur_p; j++) {
+            if(lv_area_is_in(&inv_prev[i], &inv_buf[j].area)) break;
+        }
+        if(j < cur_p) continue;
+
+        if(inv_buf_p >= LV_INV_FIFO_SIZE) {
+            full = true;
+            break;
+        }
+
+        lv_area_copy(&inv_buf[inv_buf_p].area, &inv_prev[i]);
+        inv_buf_p++;
+    }
+
+    /*The current areas will be missing from the next VDB*/
+    for(i = 0; i < cur_p; i++) {
+        lv_area_copy(&inv_prev[i], &inv_buf[i].area);
+    }
+    inv_prev_p = cur_p;
+
+    /*If no place for the areas refresh the screen*/
+    if(full) {
+        inv_buf[0].area.x1 = 0;
+        inv_buf[0].area.y1 = 0;
+        inv_buf[0].area.x2 = LV_HOR_RES - 1;
+        inv_buf[0].area.y2 = LV_VER_RES - 1;
+        inv_buf_p = 1;
+    }
+}
+#endif
+
 /**
- * Join the areas which has got common parts
+ * Join the areas which has got common parts.
+ * With `LV_REFR_FLUSH_COST` join any areas if refreshing them together is cheaper.
  */
 static void lv_refr_join_area(void)
 {
     uint32_t join_from;
     uint32_t join_in;
     lv_area_t joined_area;
+    bool repeat;
     for(join_in = 0; join_in < inv_buf_p; join_in++) {
         if(inv_buf[join_in].joined != 0) continue;
 
         /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < inv_buf_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(inv_buf[join_from].joined != 0 || join_in == join_from) {
-                continue;
-            }
+        do {
+            repeat = false;
+            for(join_from = 0; join_from < inv_buf_p; join_from++) {
+                /*Handle only unjoined areas and ignore itself*/
+                if(inv_buf[join_from].joined != 0 || join_in == join_from) {
+                    continue;
+                }
 
-            /*Check if the areas are on each other*/
-            if(lv_area_is_on(&inv_buf[join_in].area,
-                             &inv_buf[join_from].area) == false) {
-                continue;
-            }
+#if LV_REFR_JOIN_COST == 0
+                /*Check if the areas are on each other*/
+                if(lv_area_is_on(&inv_buf[join_in].area,
+                                 &inv_buf[join_from].area) == false) {
+                    continue;
+                }
+
+                lv_area_join(&joined_area, &inv_buf[join_in].area,
+                             &inv_buf[join_from].area);
 
-            lv_area_join(&joined_area, &inv_buf[join_in].area,
-                         &inv_buf[join_from].area);
+                /*Join two area only if the joined area size is smaller*/
+                if(lv_area_get_size(&joined_area) >=
+                        (lv_area_get_size(&inv_buf[join_in].area) + lv_area_get_size(&inv_buf[join_from].area))) {
+                    continue;
+                }
+#else
+                lv_area_join(&joined_area, &inv_buf[join_in].area,
+                             &inv_buf[join_from].area);
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) <
-                    (lv_area_get_size(&inv_buf[join_in].area) + lv_area_get_size(&inv_buf[join_from].area))) {
+                /*Join two area if refreshing the extra pixels is cheaper than the flushes saved by joining*/
+                if(lv_refr_get_cost(&joined_area) >=
+                        (lv_refr_get_cost(&inv_buf[join_in].area) + lv_refr_get_cost(&inv_buf[join_from].area))) {
+                    continue;
+                }
+
+                /*The grown area might be worth to join with an already checked area too*/
+                repeat = true;
+#endif
                 lv_area_copy(&inv_buf[join_in].area, &joined_area);
 
                 /*Mark 'join_form' is joined into 'join_in'*/
                 inv_buf[join_from].joined = 1;
             }
-        }
+        } while(repeat);
     }
 }
 
+#if LV_REFR_YIELD == 0
 /**
  * Refresh the joined areas
  */
@@ -300,6 +637,7 @@ static void lv_refr_areas(void)
     for(i = 0; i < inv_buf_p; i++) {
         /*Refresh the unjoined areas*/
         if(inv_buf[i].joined == 0) {
+            LV_TRACE_BEGIN(LV_TRACE_EVT_REFR_AREA, lv_area_get_size(&inv_buf[i].area));
             /*If there is no VDB do simple drawing*/
 #if LV_VDB_SIZE == 0
             lv_refr_area_no_vdb(&inv_buf[i].area);
@@ -307,11 +645,51 @@ static void lv_refr_areas(void)
             /*If VDB is used...*/
             lv_refr_area_with_vdb(&inv_buf[i].area);
 #endif
+            LV_TRACE_END(LV_TRACE_EVT_REFR_AREA, 0);
             if(monitor_cb != NULL) px_num += lv_area_get_size(&inv_buf[i].area);
         }
     }
 
 }
+#endif
+
+#if LV_REFR_YIELD
+/**
+ * Refresh the joined areas until the time budget (`LV_REFR_BUDGET`) is used up.
+ * The areas closest to the last input are refreshed first.
+ * @param start start time of the refresh task (`lv_tick_get_us()`)
+ * @return true: all areas are refreshed; false: the time budget is used up
+ */
+static bool lv_refr_areas_budget(uint32_t start)
+{
+    lv_point_t p;
+    const lv_point_t * prio_p = lv_refr_get_input_point(&p) ? &p : NULL;
+    uint16_t i;
+
+    budget_start_us = start;
+
+    for(i = lv_refr_get_next_area(prio_p); i < inv_buf_p; i = lv_refr_get_next_area(prio_p)) {
+        lv_area_t * area_p = &inv_buf[i].area;
+        LV_TRACE_BEGIN(LV_TRACE_EVT_REFR_AREA, lv_area_get_size(area_p));
+#if LV_VDB_SIZE == 0
+        lv_refr_area_no_vdb(area_p);
+        lv_coord_t y_next = area_p->y2 + 1;
+#else
+        lv_coord_t y_next = lv_refr_area_with_vdb(area_p);
+#endif
+        LV_TRACE_END(LV_TRACE_EVT_REFR_AREA, 0);
+        if(monitor_cb != NULL) px_num += (uint32_t)lv_area_get_width(area_p) * (y_next - area_p->y1);
+
+        /*Skip the ready areas like the joined ones or continue from the first not refreshed row*/
+        if(y_next > area_p->y2) inv_buf[i].joined = 1;
+        else area_p->y1 = y_next;
+
+        if(lv_refr_budget_over()) break;
+    }
+
+    return lv_refr_get_next_area(NULL) >= inv_buf_p ? true : false;
+}
+#endif
 
 #if LV_VDB_SIZE == 0
 /**
@@ -320,17 +698,8 @@ static void lv_refr_areas(void)
  */
 static void lv_refr_area_no_vdb(const lv_area_t * area_p)
 {
-    lv_obj_t * top_p;
-
-    /*Get top object which is not covered by others*/
-    top_p = lv_refr_get_top_obj(area_p, lv_scr_act());
-
-    /*Do the refreshing*/
-    lv_refr_obj_and_children(top_p, area_p);
-
-    /*Also refresh top and sys layer unconditionally*/
-    lv_refr_obj_and_children(lv_layer_top(), area_p);
-    lv_refr_obj_and_children(lv_layer_sys(), area_p);
+    lv_refr_draw(area_p);
+    lv_rflush();
 }
 
 #else
@@ -338,8 +707,10 @@ static void lv_refr_area_no_vdb(const lv_area_t * area_p)
 /**
  * Refresh an area if there is Virtual Display Buffer
  * @param area_p  pointer to an area to refresh
+ * @return the first row which is not refreshed because the time budget is used up (`LV_REFR_BUDGET`)
+ *         or `area_p->y2 + 1` if the whole area is refreshed
  */
-static void lv_refr_area_with_vdb(const lv_area_t * area_p)
+static lv_coord_t lv_refr_area_with_vdb(const lv_area_t * area_p)
 {
 
 #if LV_VDB_TRUE_DOUBLE_BUFFERED == 0
@@ -350,6 +721,11 @@ static void lv_refr_area_with_vdb(const lv_area_t * area_p)
 
     int32_t max_row = (uint32_t) LV_VDB_SIZE / w;
 
+#if LV_VDB_PACKED
+    /*The packed rows start on byte boundary so less might fit*/
+    if(lv_disp_get_active()->driver.vdb_wr == NULL) max_row = lv_vpacked_get_max_row(w);
+#endif
+
     if(max_row > h) max_row = h;
 
 
@@ -364,18 +740,29 @@ static void lv_refr_area_with_vdb(const lv_area_t * area_p)
         lv_coord_t y_tmp = max_row;
         do {
             tmp.y2 = y_tmp;
-            round_cb(&tmp);
+            lv_refr_round_area(&tmp);
             y_tmp --;       /*Decrement the number of line until it is rounded to a smaller (or equal) value then the original. */
         } while(lv_area_get_height(&tmp) > max_row && y_tmp != 0);
 
         if(y_tmp == 0) {
             LV_LOG_WARN("Can't set VDB height using the round function. (Wrong round_cb or to small VDB)");
-            return;
+            return area_p->y2 + 1;
         } else {
             max_row = tmp.y2 + 1;
         }
     }
 
+#if LV_REFR_DISP_LIST
+    /*If the area is refreshed in more parts record the drawings only once and replay them on every part*/
+    dl_valid = false;
+    if(max_row < h) {
+        lv_draw_dl_start();
+        lv_refr_draw(area_p);
+        dl_valid = lv_draw_dl_stop();
+        if(dl_valid == false) LV_LOG_TRACE("Display list is full. Refresh the area in the normal way");
+    }
+#endif
+
     /*Always use the full row*/
     lv_coord_t row;
     lv_coord_t row_last = 0;
@@ -383,7 +770,7 @@ static void lv_refr_area_with_vdb(const lv_area_t * area_p)
         lv_vdb_t * vdb_p = lv_vdb_get();
         if(!vdb_p) {
             LV_LOG_WARN("Invalid VDB pointer");
-            return;
+            return area_p->y2 + 1;
         }
 
         /*Calc. the next y coordinates of VDB*/
@@ -394,6 +781,16 @@ static void lv_refr_area_with_vdb(const lv_area_t * area_p)
         if(vdb_p->area.y2 > y2) vdb_p->area.y2 = y2;
         row_last = vdb_p->area.y2;
         lv_refr_area_part_vdb(area_p);
+
+#if LV_REFR_YIELD
+        /*Continue from the next row later if the time budget is used up*/
+        if(row + max_row <= y2 && lv_refr_budget_over()) {
+#if LV_REFR_DISP_LIST
+            dl_valid = false;
+#endif
+            return row + max_row;
+        }
+#endif
     }
 
     /*If the last y coordinates are not handled yet ...*/
@@ -401,7 +798,7 @@ static void lv_refr_area_with_vdb(const lv_area_t * area_p)
         lv_vdb_t * vdb_p = lv_vdb_get();
         if(!vdb_p) {
             LV_LOG_WARN("Invalid VDB pointer");
-            return;
+            return area_p->y2 + 1;
         }
 
         /*Calc. the next y coordinates of VDB*/
@@ -413,6 +810,10 @@ static void lv_refr_area_with_vdb(const lv_area_t * area_p)
         /*Refresh this part too*/
         lv_refr_area_part_vdb(area_p);
     }
+
+#if LV_REFR_DISP_LIST
+    dl_valid = false;
+#endif
 #else
     lv_vdb_t * vdb_p = lv_vdb_get();
     vdb_p->area.x1 = 0;
@@ -421,6 +822,8 @@ static void lv_refr_area_with_vdb(const lv_area_t * area_p)
     vdb_p->area.y2 = LV_VER_RES - 1;
     lv_refr_area_part_vdb(area_p);
 #endif
+
+    return area_p->y2 + 1;
 }
 
 /**
@@ -434,22 +837,23 @@ static void lv_refr_area_part_vdb(const lv_area_t * area_p)
         LV_LOG_WARN("Invalid VDB pointer");
         return;
     }
-    lv_obj_t * top_p;
 
     /*Get the new mask from the original area and the act. VDB
      It will be a part of 'area_p'*/
     lv_area_t start_mask;
     lv_area_intersect(&start_mask, area_p, &vdb_p->area);
 
-    /*Get the most top object which is not covered by others*/
-    top_p = lv_refr_get_top_obj(&start_mask, lv_scr_act());
-
-    /*Do the refreshing from the top object*/
-    lv_refr_obj_and_children(top_p, &start_mask);
-
-    /*Also refresh top and sys layer unconditionally*/
-    lv_refr_obj_and_children(lv_layer_top(), &start_mask);
-    lv_refr_obj_and_children(lv_layer_sys(), &start_mask);
+#if LV_REFR_DISP_LIST
+    if(dl_valid) {
+        /*Replay the recorded drawings from the top object of this part like `lv_refr_draw` would start*/
+        lv_obj_t * top_p = lv_refr_get_top_obj(&start_mask, lv_scr_act());
+        if(lv_draw_dl_replay(&start_mask, top_p) == false) lv_refr_draw(&start_mask);
+    } else {
+        lv_refr_draw(&start_mask);
+    }
+#else
+    lv_refr_draw(&start_mask);
+#endif
 
     /* In true double buffered mode flush only once when all areas were rendered.
      * In normal mode flush after every area */
@@ -461,6 +865,23 @@ static void lv_refr_area_part_vdb(const lv_area_t * area_p)
 
 #endif /*LV_VDB_SIZE == 0*/
 
+/**
+ * Draw the objects of the active screen and the layers on an area
+ * @param mask_p pointer to an area, the objects will be drawn only here
+ */
+static void lv_refr_draw(const lv_area_t * mask_p)
+{
+    /*Get the most top object which is not covered by others*/
+    lv_obj_t * top_p = lv_refr_get_top_obj(mask_p, lv_scr_act());
+
+    /*Do the refreshing from the top object*/
+    lv_refr_obj_and_children(top_p, mask_p);
+
+    /*Also refresh top and sys layer unconditionally*/
+    lv_refr_obj_and_children(lv_layer_top(), mask_p);
+    lv_refr_obj_and_children(lv_layer_sys(), mask_p);
+}
+
 /**
  * Search the most top object which fully covers an area
  * @param area_p pointer to an area
@@ -469,17 +890,23 @@ static void lv_refr_area_part_vdb(const lv_area_t * area_p)
  */
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj)
 {
-    lv_obj_t * i;
     lv_obj_t * found_p = NULL;
 
     /*If this object is fully cover the draw area check the children too */
     if(lv_area_is_in(area_p, &obj->coords) && obj->hidden == 0) {
-        LL_READ(obj->child_ll, i)        {
-            found_p = lv_refr_get_top_obj(area_p, i);
-
-            /*If a children is ok then break*/
-            if(found_p != NULL) {
-                break;
+        /*The search goes from the parents to the children so it's enough to move the children*/
+        lv_obj_update_children_coords(obj);
+
+        /*No child can cover the area if it's not in the bounding box of the children*/
+        if(lv_area_is_in(area_p, &obj->child_bound)) {
+            uint16_t id;
+            for(id = obj->child_cnt; id > 0; id--) {    /*From the youngest*/
+                found_p = lv_refr_get_top_obj(area_p, obj->child_arr[id - 1]);
+
+                /*If a children is ok then break*/
+                if(found_p != NULL) {
+                    break;
+                }
             }
         }
 
@@ -514,20 +941,17 @@ static void lv_refr_obj_and_children(lv_obj_t * top_p, const lv_area_t * mask_p)
 
     /*Draw the 'younger' sibling objects because they can be on top_obj */
     lv_obj_t * par;
-    lv_obj_t * i;
+    uint16_t id;
     lv_obj_t * border_p = top_p;
 
     par = lv_obj_get_parent(top_p);
 
     /*Do until not reach the screen*/
     while(par != NULL) {
-        /*object before border_p has to be redrawn*/
-        i = lv_ll_get_prev(&(par->child_ll), border_p);
-
-        while(i != NULL) {
+        /*objects after border_p has to be redrawn*/
+        for(id = border_p->child_id + 1; id < par->child_cnt; id++) {
             /*Refresh the objects*/
-            lv_refr_obj(i, mask_p);
-            i = lv_ll_get_prev(&(par->child_ll), i);
+            lv_refr_obj(par->child_arr[id], mask_p);
         }
 
         /*The new border will be there last parents,
@@ -562,7 +986,7 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
     lv_area_t obj_ext_mask;
     lv_area_t obj_area;
     lv_coord_t ext_size = obj->ext_size;
-    lv_obj_get_coords(obj, &obj_area);
+    lv_area_copy(&obj_area, &obj->coords);     /*Up to date because the parent has moved its children*/
     obj_area.x1 -= ext_size;
     obj_area.y1 -= ext_size;
     obj_area.x2 += ext_size;
@@ -572,25 +996,45 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
     /*Draw the parent and its children only if they ore on 'mask_parent'*/
     if(union_ok != false) {
 
+#if LV_REFR_DISP_LIST
+        /*Mark the drawings of the object to replay the list from here if it's the top object of a part*/
+        if(lv_draw_dl_is_rec()) lv_draw_dl_add_mark(obj);
+#endif
+
+        /*Apply the saved movement to the children as they are drawn (and maybe used by the design function) too*/
+        lv_obj_update_children_coords(obj);
+
         /* Redraw the object */
+        LV_TRACE_BEGIN(LV_TRACE_EVT_DESIGN, LV_DESIGN_DRAW_MAIN);
         obj->design_func(obj, &obj_ext_mask, LV_DESIGN_DRAW_MAIN);
+        LV_TRACE_END(LV_TRACE_EVT_DESIGN, LV_DESIGN_DRAW_MAIN);
         //usleep(5 * 1000);  /*DEBUG: Wait after every object draw to see the order of drawing*/
 
 
         /*Create a new 'obj_mask' without 'ext_size' because the children can't be visible there*/
-        lv_obj_get_coords(obj, &obj_area);
+        lv_area_copy(&obj_area, &obj->coords);
         union_ok = lv_area_intersect(&obj_mask, mask_ori_p, &obj_area);
+
+        /*Skip all the children with one test if none of them is on the mask*/
+        if(union_ok != false) union_ok = lv_area_is_on(&obj_mask, &obj->child_bound);
+
         if(union_ok != false) {
             lv_area_t mask_child; /*Mask from obj and its child*/
             lv_obj_t * child_p;
             lv_area_t child_area;
-            LL_READ_BACK(obj->child_ll, child_p) {
-                lv_obj_get_coords(child_p, &child_area);
+            lv_area_t bound;      /*Calculate the exact bounding box of the children again*/
+            uint16_t id;
+            lv_area_set(&bound, LV_COORD_MAX, LV_COORD_MAX, LV_COORD_MIN, LV_COORD_MIN);
+            for(id = 0; id < obj->child_cnt; id++) {   /*From the oldest*/
+                child_p = obj->child_arr[id];
+                lv_area_copy(&child_area, &child_p->coords);
                 ext_size = child_p->ext_size;
                 child_area.x1 -= ext_size;
                 child_area.y1 -= ext_size;
                 child_area.x2 += ext_size;
                 child_area.y2 += ext_size;
+                lv_area_join(&bound, &bound, &child_area);
+
                 /* Get the union (common parts) of original mask (from obj)
                  * and its child */
                 union_ok = lv_area_intersect(&mask_child, &obj_mask, &child_area);
@@ -601,10 +1045,156 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
                     lv_refr_obj(child_p, &mask_child);
                 }
             }
+            lv_area_copy(&obj->child_bound, &bound);
         }
 
         /* If all the children are redrawn make 'post draw' design */
+        LV_TRACE_BEGIN(LV_TRACE_EVT_DESIGN, LV_DESIGN_DRAW_POST);
         obj->design_func(obj, &obj_ext_mask, LV_DESIGN_DRAW_POST);
+        LV_TRACE_END(LV_TRACE_EVT_DESIGN, LV_DESIGN_DRAW_POST);
+
+    }
+}
+
+/**
+ * Round an area with `round_cb`. If the display is rotated `round_cb` gets the coordinates of the display.
+ * @param area_p pointer to an area to round
+ */
+static void lv_refr_round_area(lv_area_t * area_p)
+{
+#if LV_VDB_SIZE != 0 && USE_LV_DISP_ROT
+    lv_disp_t * disp = lv_disp_get_active();
+    lv_rot_t rot = disp ? disp->driver.rotated : LV_ROT_NONE;
+
+    lv_rot_area(area_p, LV_HOR_RES, LV_VER_RES, rot);
+    round_cb(area_p);
+    lv_rot_area_inv(area_p, LV_HOR_RES, LV_VER_RES, rot);
+#else
+    round_cb(area_p);
+#endif
+}
+
+#if LV_REFR_JOIN_COST
+/**
+ * Estimate the cost of refreshing an area: its pixels plus `LV_REFR_FLUSH_COST` for every flush
+ * @param area_p pointer to an area
+ * @return the cost in pixels
+ */
+static uint32_t lv_refr_get_cost(const lv_area_t * area_p)
+{
+    lv_coord_t w = lv_area_get_width(area_p);
+    lv_coord_t h = lv_area_get_height(area_p);
+    uint32_t max_row = (uint32_t) LV_VDB_SIZE / w;
+
+#if LV_VDB_PACKED
+    if(lv_disp_get_active()->driver.vdb_wr == NULL) max_row = lv_vpacked_get_max_row(w);
+#endif
+
+    if(max_row == 0) max_row = 1;
+
+    uint32_t flush_num = (h + max_row - 1) / max_row;
+
+    return lv_area_get_size(area_p) + flush_num * LV_REFR_FLUSH_COST;
+}
+#endif
+
+#if LV_REFR_YIELD
+/**
+ * Check whether the time budget of the actual refresh task call is used up
+ * @return true: the time budget is used up
+ */
+static bool lv_refr_budget_over(void)
+{
+    return lv_tick_elaps_us(budget_start_us) >= (uint32_t)LV_REFR_BUDGET * 1000 ? true : false;
+}
+
+/**
+ * Get the next area to refresh
+ * @param p the area closest to this point comes first. NULL: the next area in the buffer.
+ * @return index of an unjoined area in `inv_buf` or `inv_buf_p` if there are no more areas
+ */
+static uint16_t lv_refr_get_next_area(const lv_point_t * p)
+{
+    uint16_t next = inv_buf_p;
+    uint32_t dist_min = UINT32_MAX;
+    uint16_t i;
 
+    for(i = 0; i < inv_buf_p; i++) {
+        if(inv_buf[i].joined != 0) continue;
+        if(p == NULL) return i;
+
+        /*Distance of the point from the area (0 if it's on the area)*/
+        const lv_area_t * a = &inv_buf[i].area;
+        uint32_t dx = p->x < a->x1 ? a->x1 - p->x : (p->x > a->x2 ? p->x - a->x2 : 0);
+        uint32_t dy = p->y < a->y1 ? a->y1 - p->y : (p->y > a->y2 ? p->y - a->y2 : 0);
+        if(dx + dy < dist_min) {
+            dist_min = dx + dy;
+            next = i;
+        }
     }
+
+    return next;
 }
+
+/**
+ * Get the point of the last input: the point of the last used pointer or the center of the focused object
+ * @param p pointer to a point to store the result
+ * @return true: `p` is set; false: there is no such point
+ */
+static bool lv_refr_get_input_point(lv_point_t * p)
+{
+    lv_indev_t * indev = NULL;
+    lv_indev_t * last = NULL;
+
+    /*Find the last used input device*/
+    while((indev = lv_indev_next(indev)) != NULL) {
+        if(indev->proc.disabled) continue;
+        if(last == NULL || lv_tick_elaps(indev->last_activity_time) < lv_tick_elaps(last->last_activity_time)) {
+            last = indev;
+        }
+    }
+
+    if(last == NULL) return false;
+
+    if(last->driver.type == LV_INDEV_TYPE_POINTER || last->driver.type == LV_INDEV_TYPE_BUTTON) {
+        p->x = last->proc.act_point.x;
+        p->y = last->proc.act_point.y;
+        return true;
+    }
+
+#if USE_LV_GROUP
+    if((last->driver.type == LV_INDEV_TYPE_KEYPAD || last->driver.type == LV_INDEV_TYPE_ENCODER) && last->group) {
+        lv_obj_t * focused = lv_group_get_focused(last->group);
+        if(focused) {
+            lv_obj_update_coords(focused);
+            p->x = (focused->coords.x1 + focused->coords.x2) / 2;
+            p->y = (focused->coords.y1 + focused->coords.y2) / 2;
+            return true;
+        }
+    }
+#endif
+
+    return false;
+}
+
+/**
+ * Remove the refreshed and joined areas from the buffer and keep the remaining ones for the next call
+ */
+static void lv_refr_keep_pending(void)
+{
+    uint16_t i;
+    uint16_t n = 0;
+
+    for(i = 0; i < inv_buf_p; i++) {
+        if(inv_buf[i].joined != 0) continue;
+
+        lv_area_copy(&inv_buf[n].area, &inv_buf[i].area);
+        inv_buf[n].joined = 0;
+        n++;
+    }
+
+    /*Clear the freed places as the new areas are added without clearing the `joined` flag*/
+    memset(&inv_buf[n], 0, (inv_buf_p - n) * sizeof(lv_join_t));
+    inv_buf_p = n;
+}
+#endif
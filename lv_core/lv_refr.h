@@ -24,6 +24,20 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if USE_LV_VSYNC
+/*Frame timing statistics of the vsync synchronized refreshing*/
+typedef struct {
+    uint32_t vsync_cnt;         /*Number of vsync signals*/
+    uint32_t frame_cnt;         /*Number of refreshed frames*/
+    uint32_t late_cnt;          /*Frames not rendered until the next vsync*/
+    uint32_t latency_max_us;    /*Longest delay from a vsync to the start of the refreshing*/
+    uint32_t period_min_us;     /*Shortest time between the start of two consecutive frames*/
+    uint32_t period_max_us;     /*Longest time between the start of two consecutive frames*/
+    uint32_t period_avg_us;     /*Running average of the frame period*/
+    uint32_t jitter_us;         /*Running average of the change of the frame period (like RFC 3550 jitter)*/
+} lv_refr_vsync_stat_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -65,6 +79,13 @@ void lv_inv_area(const lv_area_t * area_p);
  */
 void lv_refr_set_monitor_cb(void (*cb)(uint32_t, uint32_t));
 
+/**
+ * Get the duration of the last refresh with microsecond resolution (if `LV_TICK_US_CUSTOM` is enabled).
+ * Can be called from the monitor callback to get a more precise time than `time_ms`
+ * @return the duration of the last refresh in microseconds
+ */
+uint32_t lv_refr_get_time_us(void);
+
 /**
  * Called when an area is invalidated to modify the coordinates of the area.
  * Special display controllers may require special coordinate rounding
@@ -83,6 +104,25 @@ uint16_t lv_refr_get_buf_size(void);
  * @param num number of areas to delete
  */
 void lv_refr_pop_from_buf(uint16_t num);
+
+#if USE_LV_VSYNC
+/**
+ * Signal the vertical sync or tearing effect of the display. The screen is refreshed right after it
+ * if there are invalid areas. Can be called from an interrupt.
+ */
+void lv_refr_vsync(void);
+
+/**
+ * Get the frame timing statistics since the last `lv_refr_reset_vsync_stat()`
+ * @param stat pointer to a variable to store the statistics
+ */
+void lv_refr_get_vsync_stat(lv_refr_vsync_stat_t * stat);
+
+/**
+ * Reset the frame timing statistics
+ */
+void lv_refr_reset_vsync_stat(void);
+#endif
 /**********************
  *   STATIC FUNCTIONS
  **********************/
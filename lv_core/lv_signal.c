@@ -0,0 +1,294 @@
+/**
+ * @file lv_signal.c
+ * Dispatch the signals only to the signal functions which handle them
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_signal.h"
+#include "../lv_misc/lv_log.h"
+#include <stddef.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_SIGNAL_REG_SIZE      64      /*Max. number of registered signal functions. Must be power of 2*/
+#define LV_SIGNAL_STAT_NUM      32      /*Signals counted one by one. The greater ones are counted on the last*/
+#define LV_SIGNAL_STAT_TYPE_NUM 32      /*Max. number of object types (signal functions) counted one by one. Must be power of 2*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct
+{
+    lv_signal_func_t func;
+    lv_signal_func_t ancestor;
+    uint32_t mask;
+} lv_signal_reg_t;
+
+#if LV_SIGNAL_STAT
+/*The sent signals of an object type*/
+typedef struct
+{
+    lv_signal_func_t type;                      /*The signal function of the objects*/
+    uint32_t sent_cnt[LV_SIGNAL_STAT_NUM];
+    uint32_t sent_cnt_last[LV_SIGNAL_STAT_NUM];
+} lv_signal_type_stat_t;
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_signal_reg_t * reg_find(lv_signal_func_t func);
+static uint32_t reg_hash(lv_signal_func_t func);
+#if LV_SIGNAL_STAT
+static lv_signal_type_stat_t * type_stat_find(lv_signal_func_t type, bool add);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_signal_reg_t reg_tbl[LV_SIGNAL_REG_SIZE];
+#if LV_SIGNAL_STAT
+static uint32_t sent_cnt[LV_SIGNAL_STAT_NUM];
+static uint32_t call_cnt[LV_SIGNAL_STAT_NUM];
+static uint32_t sent_cnt_last[LV_SIGNAL_STAT_NUM];
+static uint32_t call_cnt_last[LV_SIGNAL_STAT_NUM];
+static lv_signal_type_stat_t type_stat[LV_SIGNAL_STAT_TYPE_NUM];
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+#if LV_SIGNAL_STAT
+#define STAT_ID(sign)   ((sign) < LV_SIGNAL_STAT_NUM ? (sign) : LV_SIGNAL_STAT_NUM - 1)
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Tell which signals are handled by a signal function. The not handled signals are passed
+ * directly to the first interested ancestor, without calling `func`.
+ * Not registered signal functions are called with every signal.
+ * @param func pointer to a signal function
+ * @param ancestor the signal function called by `func` as ancestor (NULL if none)
+ * @param mask the handled signals OR-ed with `LV_SIGNAL_BIT(...)`
+ */
+void lv_signal_reg(lv_signal_func_t func, lv_signal_func_t ancestor, uint32_t mask)
+{
+    if(func == NULL) return;
+
+    uint32_t h = reg_hash(func);
+    uint32_t i;
+    for(i = 0; i < LV_SIGNAL_REG_SIZE; i++) {
+        lv_signal_reg_t * r = &reg_tbl[(h + i) & (LV_SIGNAL_REG_SIZE - 1)];
+        if(r->func == NULL || r->func == func) {
+            r->func = func;
+            r->ancestor = ancestor;
+            r->mask = mask;
+            return;
+        }
+    }
+
+    /*Not a problem: a not registered function simply gets every signal*/
+    LV_LOG_WARN("lv_signal_reg: the register is full");
+}
+
+/**
+ * Call a signal function or its first ancestor which handles the signal.
+ * Use it in the signal functions to call the ancestor's signal function.
+ * @param func pointer to a signal function
+ * @param obj pointer to an object
+ * @param sign the signal (`LV_SIGNAL_...`)
+ * @param param parameter of the signal
+ * @return the result of the called signal function or `LV_RES_OK` if no one handles the signal
+ */
+lv_res_t lv_signal_call(lv_signal_func_t func, lv_obj_t * obj, lv_signal_t sign, void * param)
+{
+    /*Custom (greater) signals can't be masked so they always go through the whole chain*/
+    if(sign < 32) {
+        lv_signal_reg_t * r = reg_find(func);
+        while(r != NULL && (r->mask & LV_SIGNAL_BIT(sign)) == 0) {
+            func = r->ancestor;
+            if(func == NULL) return LV_RES_OK;
+            r = reg_find(func);
+        }
+    }
+
+    if(func == NULL) return LV_RES_OK;
+
+#if LV_SIGNAL_STAT
+    call_cnt[STAT_ID(sign)]++;
+#endif
+
+    return func(obj, sign, param);
+}
+
+/**
+ * Send a signal to an object.
+ * @param obj pointer to an object
+ * @param sign the signal (`LV_SIGNAL_...`)
+ * @param param parameter of the signal
+ * @return the result of the signal function
+ */
+lv_res_t lv_signal_send(lv_obj_t * obj, lv_signal_t sign, void * param)
+{
+#if LV_SIGNAL_STAT
+    sent_cnt[STAT_ID(sign)]++;
+
+    /*If there are too many types only the totals are counted*/
+    lv_signal_type_stat_t * ts = type_stat_find(obj->signal_func, true);
+    if(ts) ts->sent_cnt[STAT_ID(sign)]++;
+#endif
+
+    /*The signal functions read the coordinates of the object (and of its parents) directly*/
+    lv_obj_update_coords(obj);
+
+    return lv_signal_call(obj->signal_func, obj, sign, param);
+}
+
+#if LV_SIGNAL_STAT
+/**
+ * Called by the display refresh task at the end of every refreshed frame (before the monitor callback)
+ * to save and reset the counters
+ */
+void lv_signal_stat_frame(void)
+{
+    uint32_t i;
+    for(i = 0; i < LV_SIGNAL_STAT_NUM; i++) {
+        sent_cnt_last[i] = sent_cnt[i];
+        call_cnt_last[i] = call_cnt[i];
+        sent_cnt[i] = 0;
+        call_cnt[i] = 0;
+    }
+
+    uint32_t t;
+    for(t = 0; t < LV_SIGNAL_STAT_TYPE_NUM; t++) {
+        lv_signal_type_stat_t * ts = &type_stat[t];
+        if(ts->type == NULL) continue;
+        for(i = 0; i < LV_SIGNAL_STAT_NUM; i++) {
+            ts->sent_cnt_last[i] = ts->sent_cnt[i];
+            ts->sent_cnt[i] = 0;
+        }
+    }
+}
+
+/**
+ * Get the number of signals sent to the objects in the last frame
+ * @param sign the signal (`LV_SIGNAL_...`)
+ * @return number of `lv_signal_send` calls with `sign`
+ */
+uint32_t lv_signal_get_sent_cnt(lv_signal_t sign)
+{
+    return sent_cnt_last[STAT_ID(sign)];
+}
+
+/**
+ * Get the number of signal function calls in the last frame (including the ancestors)
+ * @param sign the signal (`LV_SIGNAL_...`)
+ * @return number of signal functions called with `sign`
+ */
+uint32_t lv_signal_get_call_cnt(lv_signal_t sign)
+{
+    return call_cnt_last[STAT_ID(sign)];
+}
+
+/**
+ * Get the number of signals sent to the objects of a type in the last frame
+ * @param type the signal function of the objects (see `lv_obj_get_signal_func`)
+ * @param sign the signal (`LV_SIGNAL_...`)
+ * @return number of `lv_signal_send` calls with `sign` to objects of `type`
+ */
+uint32_t lv_signal_get_type_sent_cnt(lv_signal_func_t type, lv_signal_t sign)
+{
+    lv_signal_type_stat_t * ts = type_stat_find(type, false);
+    if(ts == NULL) return 0;
+
+    return ts->sent_cnt_last[STAT_ID(sign)];
+}
+
+/**
+ * Get the object types which got signals since the start.
+ * E.g. to find the type getting the most signals iterate `id` from 0 until NULL is returned
+ * and use `lv_signal_get_type_sent_cnt`.
+ * @param id index of the type (0, 1, ...)
+ * @return the signal function of the `id`th type or NULL if there are less types
+ */
+lv_signal_func_t lv_signal_get_stat_type(uint32_t id)
+{
+    uint32_t t;
+    for(t = 0; t < LV_SIGNAL_STAT_TYPE_NUM; t++) {
+        if(type_stat[t].type == NULL) continue;
+        if(id == 0) return type_stat[t].type;
+        id--;
+    }
+
+    return NULL;
+}
+#endif
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Find a signal function in the register
+ * @param func pointer to a signal function
+ * @return pointer to the register entry or NULL if `func` is not registered
+ */
+static lv_signal_reg_t * reg_find(lv_signal_func_t func)
+{
+    uint32_t h = reg_hash(func);
+    uint32_t i;
+    for(i = 0; i < LV_SIGNAL_REG_SIZE; i++) {
+        lv_signal_reg_t * r = &reg_tbl[(h + i) & (LV_SIGNAL_REG_SIZE - 1)];
+        if(r->func == func) return r;
+        if(r->func == NULL) return NULL;
+    }
+
+    return NULL;
+}
+
+/**
+ * Get the start index of a signal function in the register
+ * @param func pointer to a signal function
+ * @return the hash of the function's address
+ */
+static uint32_t reg_hash(lv_signal_func_t func)
+{
+    uintptr_t a = (uintptr_t) func;
+    a ^= a >> 16;
+    a *= 0x45D9F3B;
+    a ^= a >> 16;
+    return (uint32_t) a & (LV_SIGNAL_REG_SIZE - 1);
+}
+
+#if LV_SIGNAL_STAT
+/**
+ * Find the statistics of an object type
+ * @param type the signal function of the objects
+ * @param add true: add `type` if not found
+ * @return pointer to the statistics or NULL if not found (or no more free place with `add`)
+ */
+static lv_signal_type_stat_t * type_stat_find(lv_signal_func_t type, bool add)
+{
+    if(type == NULL) return NULL;
+
+    uint32_t h = reg_hash(type);
+    uint32_t i;
+    for(i = 0; i < LV_SIGNAL_STAT_TYPE_NUM; i++) {
+        lv_signal_type_stat_t * ts = &type_stat[(h + i) & (LV_SIGNAL_STAT_TYPE_NUM - 1)];
+        if(ts->type == type) return ts;
+        if(ts->type == NULL) {
+            if(add == false) return NULL;
+            ts->type = type;
+            return ts;
+        }
+    }
+
+    return NULL;
+}
+#endif
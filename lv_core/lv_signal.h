@@ -0,0 +1,120 @@
+/**
+ * @file lv_signal.h
+ * Dispatch the signals only to the signal functions which handle them
+ */
+
+#ifndef LV_SIGNAL_H
+#define LV_SIGNAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifdef LV_CONF_INCLUDE_SIMPLE
+#include "lv_conf.h"
+#else
+#include "../../lv_conf.h"
+#endif
+
+#include <stdint.h>
+#include "lv_obj.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_SIGNAL_MASK_ALL      0xFFFFFFFF
+
+/*Every input device and group signal (the range where `lv_obj_signal` calls the feedback of the input device)*/
+#define LV_SIGNAL_MASK_FEEDBACK  (((uint32_t)1 << _LV_SIGNAL_FEEDBACK_SECTION_END) - ((uint32_t)1 << (_LV_SIGNAL_FEEDBACK_SECTION_START + 1)))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Tell which signals are handled by a signal function. The not handled signals are passed
+ * directly to the first interested ancestor, without calling `func`.
+ * Not registered signal functions are called with every signal.
+ * @param func pointer to a signal function
+ * @param ancestor the signal function called by `func` as ancestor (NULL if none)
+ * @param mask the handled signals OR-ed with `LV_SIGNAL_BIT(...)`
+ */
+void lv_signal_reg(lv_signal_func_t func, lv_signal_func_t ancestor, uint32_t mask);
+
+/**
+ * Call a signal function or its first ancestor which handles the signal.
+ * Use it in the signal functions to call the ancestor's signal function.
+ * @param func pointer to a signal function
+ * @param obj pointer to an object
+ * @param sign the signal (`LV_SIGNAL_...`)
+ * @param param parameter of the signal
+ * @return the result of the called signal function or `LV_RES_OK` if no one handles the signal
+ */
+lv_res_t lv_signal_call(lv_signal_func_t func, lv_obj_t * obj, lv_signal_t sign, void * param);
+
+/**
+ * Send a signal to an object.
+ * @param obj pointer to an object
+ * @param sign the signal (`LV_SIGNAL_...`)
+ * @param param parameter of the signal
+ * @return the result of the signal function
+ */
+lv_res_t lv_signal_send(lv_obj_t * obj, lv_signal_t sign, void * param);
+
+#if LV_SIGNAL_STAT
+/**
+ * Called by the display refresh task at the end of every refreshed frame (before the monitor callback)
+ * to save and reset the counters
+ */
+void lv_signal_stat_frame(void);
+
+/**
+ * Get the number of signals sent to the objects in the last frame
+ * @param sign the signal (`LV_SIGNAL_...`)
+ * @return number of `lv_signal_send` calls with `sign`
+ */
+uint32_t lv_signal_get_sent_cnt(lv_signal_t sign);
+
+/**
+ * Get the number of signal function calls in the last frame (including the ancestors)
+ * @param sign the signal (`LV_SIGNAL_...`)
+ * @return number of signal functions called with `sign`
+ */
+uint32_t lv_signal_get_call_cnt(lv_signal_t sign);
+
+/**
+ * Get the number of signals sent to the objects of a type in the last frame
+ * @param type the signal function of the objects (see `lv_obj_get_signal_func`)
+ * @param sign the signal (`LV_SIGNAL_...`)
+ * @return number of `lv_signal_send` calls with `sign` to objects of `type`
+ */
+uint32_t lv_signal_get_type_sent_cnt(lv_signal_func_t type, lv_signal_t sign);
+
+/**
+ * Get the object types which got signals since the start.
+ * E.g. to find the type getting the most signals iterate `id` from 0 until NULL is returned
+ * and use `lv_signal_get_type_sent_cnt`.
+ * @param id index of the type (0, 1, ...)
+ * @return the signal function of the `id`th type or NULL if there are less types
+ */
+lv_signal_func_t lv_signal_get_stat_type(uint32_t id);
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define LV_SIGNAL_BIT(sign)     ((uint32_t)1 << (sign))
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_SIGNAL_H*/
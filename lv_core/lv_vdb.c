@@ -9,6 +9,7 @@
 #include "lv_vdb.h"
 #if LV_VDB_SIZE != 0
 
+#include "lv_overlay.h"
 #include "../lv_hal/lv_hal_disp.h"
 #include "../lv_misc/lv_log.h"
 #include <stddef.h>
@@ -31,6 +32,12 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if USE_LV_FLUSH_CONV || USE_LV_DISP_ROT
+static bool flush_copy(lv_vdb_t * vdb_p);
+#endif
+#if LV_VDB_FLUSH_STAT
+static void flush_stat_add(const lv_vdb_t * vdb_p);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -64,6 +71,19 @@ static lv_vdb_t vdb[2] = {{.buf = (lv_color_t *)LV_VDB_ADR}, {.buf = (lv_color_t
 
 static volatile bool vdb_flushing = false;
 
+#if USE_LV_FLUSH_CONV || USE_LV_DISP_ROT
+static volatile bool copy_flushing = false;     /*A rotated or converted copy of the VDB is being flushed (the VDB is free)*/
+#endif
+
+#if LV_VDB_FLUSH_STAT
+static uint32_t flush_cnt;
+static uint32_t flush_px;
+static uint32_t flush_bytes;
+static uint32_t flush_cnt_last;
+static uint32_t flush_px_last;
+static uint32_t flush_bytes_last;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -106,10 +126,27 @@ void lv_vdb_flush(void)
     while(vdb_flushing);
 #endif  /*LV_VDB_DOUBLE*/
 
+#if USE_LV_OVERLAY
+    /*Draw the cursor image just before flushing*/
+    lv_overlay_flush_prep(vdb_act);
+#endif
+
+#if LV_VDB_FLUSH_STAT
+    flush_stat_add(vdb_act);
+#endif
+
+#if USE_LV_FLUSH_CONV || USE_LV_DISP_ROT
+    /*Flush a rotated or converted copy if the display requires it*/
+    if(flush_copy(vdb_act) == false) {
+        vdb_flushing = true;
+        lv_disp_flush(vdb_act->area.x1, vdb_act->area.y1, vdb_act->area.x2, vdb_act->area.y2, vdb_act->buf);
+    }
+#else
     vdb_flushing = true;
 
     /*Flush the rendered content to the display*/
     lv_disp_flush(vdb_act->area.x1, vdb_act->area.y1, vdb_act->area.x2, vdb_act->area.y2, vdb_act->buf);
+#endif
 
 
 #if LV_VDB_DOUBLE
@@ -149,6 +186,9 @@ void lv_vdb_set_adr(void * buf1, void * buf2)
 LV_ATTRIBUTE_FLUSH_READY void lv_flush_ready(void)
 {
     vdb_flushing = false;
+#if USE_LV_FLUSH_CONV || USE_LV_DISP_ROT
+    copy_flushing = false;
+#endif
 
     /*If the screen is transparent initialize it when the flushing is ready*/
 #if LV_VDB_DOUBLE == 0 && LV_COLOR_SCREEN_TRANSP
@@ -188,13 +228,145 @@ lv_vdb_t * lv_vdb_get_inactive(void)
  */
 bool lv_vdb_is_flushing(void)
 {
+#if USE_LV_FLUSH_CONV || USE_LV_DISP_ROT
+    return vdb_flushing || copy_flushing;
+#else
     return vdb_flushing;
+#endif
+}
+
+#if LV_VDB_FLUSH_STAT
+/**
+ * Called by the display refresh task at the end of every refreshed frame (before the monitor callback)
+ * to save and reset the counters
+ */
+void lv_vdb_flush_stat_frame(void)
+{
+    flush_cnt_last = flush_cnt;
+    flush_px_last = flush_px;
+    flush_bytes_last = flush_bytes;
+    flush_cnt = 0;
+    flush_px = 0;
+    flush_bytes = 0;
+}
+
+/**
+ * Get the number of `disp_flush` calls in the last frame
+ * @return number of flushes
+ */
+uint32_t lv_vdb_get_flush_cnt(void)
+{
+    return flush_cnt_last;
+}
+
+/**
+ * Get the number of flushed pixels in the last frame
+ * @return number of pixels sent to the display
+ */
+uint32_t lv_vdb_get_flush_px(void)
+{
+    return flush_px_last;
 }
 
+/**
+ * Get the number of flushed bytes in the last frame in the pixel format of the display
+ * (e.g. after `USE_LV_FLUSH_CONV`). It doesn't contain the commands of the display controller.
+ * @return number of bytes sent to the display
+ */
+uint32_t lv_vdb_get_flush_bytes(void)
+{
+    return flush_bytes_last;
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+#if USE_LV_FLUSH_CONV || USE_LV_DISP_ROT
+/**
+ * Flush a rotated and/or converted copy of the VDB if the active display requires it.
+ * The VDB can be drawn again right after the copy is made.
+ * @param vdb_p pointer to the VDB to flush
+ * @return true: a copy was flushed; false: the VDB should be flushed as it is
+ */
+static bool flush_copy(lv_vdb_t * vdb_p)
+{
+    lv_disp_t * disp = lv_disp_get_active();
+    if(disp == NULL || disp->driver.vdb_wr) return false;
+
+    bool rot = false;
+    bool conv = false;
+#if USE_LV_DISP_ROT
+    rot = disp->driver.rotated != LV_ROT_NONE ? true : false;
+#endif
+#if USE_LV_FLUSH_CONV
+    conv = disp->driver.conv_fmt != LV_COLOR_CONV_NONE ? true : false;
+#endif
+    if(rot == false && conv == false) return false;
+
+    /*Wait until the copy of the previous flush is sent*/
+    while(copy_flushing);
+    copy_flushing = true;
+
+    lv_area_t area;
+    lv_area_copy(&area, &vdb_p->area);
+    lv_color_t * buf = vdb_p->buf;
+
+#if USE_LV_DISP_ROT
+    /*Rotate to the orientation of the display. The driver gets the rotated coordinates.*/
+    if(rot) {
+        lv_rot_map(disp->driver.rot_buf, buf, lv_area_get_width(&area), lv_area_get_height(&area), disp->driver.rotated);
+        lv_rot_area(&area, LV_HOR_RES, LV_VER_RES, disp->driver.rotated);
+        buf = disp->driver.rot_buf;
+    }
+#endif
+
+#if USE_LV_FLUSH_CONV
+    /*Convert to the pixel format of the display*/
+    if(conv) {
+        lv_color_conv(disp->driver.conv_fmt, disp->driver.conv_buf, buf, lv_area_get_size(&area));
+        buf = disp->driver.conv_buf;
+    }
+#endif
+
+    lv_disp_flush(area.x1, area.y1, area.x2, area.y2, buf);
+
+    return true;
+}
+#endif
+
+#if LV_VDB_FLUSH_STAT
+/**
+ * Count a flush of a VDB in the statistics
+ * @param vdb_p pointer to the VDB to flush
+ */
+static void flush_stat_add(const lv_vdb_t * vdb_p)
+{
+    uint32_t w = lv_area_get_width(&vdb_p->area);
+    uint32_t h = lv_area_get_height(&vdb_p->area);
+    uint32_t px = w * h;
+    uint32_t bytes = (px * LV_VDB_PX_BPP + 7) >> 3;
+
+#if USE_LV_FLUSH_CONV
+    lv_disp_t * disp = lv_disp_get_active();
+    if(disp && disp->driver.vdb_wr == NULL) bytes = px * lv_color_conv_get_px_size(disp->driver.conv_fmt);
+#elif LV_VDB_PACKED
+    /*The rows (or columns) of the packed VDB start on byte boundary*/
+    lv_disp_t * disp = lv_disp_get_active();
+#  if LV_VDB_PX_VERTICAL
+    if(disp && disp->driver.vdb_wr == NULL) bytes = w * ((h * LV_VDB_PX_BPP + 7) >> 3);
+#  else
+    if(disp && disp->driver.vdb_wr == NULL) bytes = h * ((w * LV_VDB_PX_BPP + 7) >> 3);
+#  endif
+#endif
+
+    flush_cnt++;
+    flush_px += px;
+    flush_bytes += bytes;
+}
+#endif
+
 #else
 
 /**
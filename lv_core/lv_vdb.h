@@ -34,6 +34,29 @@ extern "C" {
 #define LV_VDB_PX_BPP LV_COLOR_SIZE     /* Default is LV_COLOR_SIZE */
 #endif
 
+/*With 1, 2 or 4 bit per pixel the VDB stores packed gray levels (if `disp_drv.vdb_wr` is not set)*/
+#define LV_VDB_PACKED   (LV_VDB_PX_BPP == 1 || LV_VDB_PX_BPP == 2 || LV_VDB_PX_BPP == 4)
+
+#ifndef LV_VDB_PX_MSB_FIRST
+#define LV_VDB_PX_MSB_FIRST 1
+#endif
+
+#ifndef LV_VDB_PX_VERTICAL
+#define LV_VDB_PX_VERTICAL  0
+#endif
+
+#if LV_VDB_PACKED && (LV_COLOR_SCREEN_TRANSP || LV_VDB_TRUE_DOUBLE_BUFFERED)
+#error "LV_VDB_PX_BPP = 1, 2 or 4 can't be used with LV_COLOR_SCREEN_TRANSP or LV_VDB_TRUE_DOUBLE_BUFFERED"
+#endif
+
+
+#if USE_LV_FLUSH_CONV && (LV_VDB_PACKED || LV_COLOR_SCREEN_TRANSP)
+#error "USE_LV_FLUSH_CONV can't be used with LV_VDB_PX_BPP = 1, 2 or 4 or with LV_COLOR_SCREEN_TRANSP"
+#endif
+
+#if USE_LV_DISP_ROT && (LV_VDB_PACKED || LV_COLOR_SCREEN_TRANSP)
+#error "USE_LV_DISP_ROT can't be used with LV_VDB_PX_BPP = 1, 2 or 4 or with LV_COLOR_SCREEN_TRANSP"
+#endif
 
 #if LV_VDB_TRUE_DOUBLE_BUFFERED && (LV_VDB_SIZE != LV_HOR_RES * LV_VER_RES || LV_VDB_DOUBLE == 0)
 #error "With LV_VDB_TRUE_DOUBLE_BUFFERED: (LV_VDB_SIZE = LV_HOR_RES * LV_VER_RES and LV_VDB_DOUBLE = 1 is required"
@@ -102,6 +125,33 @@ lv_vdb_t * lv_vdb_get_inactive(void);
  */
 bool lv_vdb_is_flushing(void);
 
+#if LV_VDB_FLUSH_STAT
+/**
+ * Called by the display refresh task at the end of every refreshed frame (before the monitor callback)
+ * to save and reset the counters
+ */
+void lv_vdb_flush_stat_frame(void);
+
+/**
+ * Get the number of `disp_flush` calls in the last frame
+ * @return number of flushes
+ */
+uint32_t lv_vdb_get_flush_cnt(void);
+
+/**
+ * Get the number of flushed pixels in the last frame
+ * @return number of pixels sent to the display
+ */
+uint32_t lv_vdb_get_flush_px(void);
+
+/**
+ * Get the number of flushed bytes in the last frame in the pixel format of the display
+ * (e.g. after `USE_LV_FLUSH_CONV`). It doesn't contain the commands of the display controller.
+ * @return number of bytes sent to the display
+ */
+uint32_t lv_vdb_get_flush_bytes(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -30,7 +30,7 @@ extern "C" {
 # define LV_IMG_PX_SIZE_ALPHA_BYTE   2
 #elif LV_COLOR_DEPTH == 16
 # define LV_IMG_PX_SIZE_ALPHA_BYTE   3
-#elif LV_COLOR_DEPTH == 32
+#elif LV_COLOR_DEPTH == 24 || LV_COLOR_DEPTH == 32
 # define LV_IMG_PX_SIZE_ALPHA_BYTE   4
 #endif
 
@@ -46,6 +46,10 @@ enum {
 };
 typedef uint8_t lv_img_src_t;
 
+/*Functions to draw a pixel and to fill an area (like `px_fp` and `fill_fp`)*/
+typedef void (*lv_draw_px_func_t)(lv_coord_t x, lv_coord_t y, const lv_area_t * mask, lv_color_t color, lv_opa_t opa);
+typedef void (*lv_draw_fill_func_t)(const lv_area_t * coords, const lv_area_t * mask, lv_color_t color, lv_opa_t opa);
+
 
 /**********************
  * GLOBAL PROTOTYPES
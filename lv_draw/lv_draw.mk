@@ -1,4 +1,5 @@
 CSRCS += lv_draw_vbasic.c
+CSRCS += lv_draw_vpacked.c
 CSRCS += lv_draw_rbasic.c
 CSRCS += lv_draw.c
 CSRCS += lv_draw_rect.c
@@ -7,6 +8,8 @@ CSRCS += lv_draw_line.c
 CSRCS += lv_draw_img.c
 CSRCS += lv_draw_arc.c
 CSRCS += lv_draw_triangle.c
+CSRCS += lv_draw_dl.c
+CSRCS += lv_draw_acc.c
 
 DEPPATH += --dep-path $(LVGL_DIR)/lvgl/lv_draw
 VPATH += :$(LVGL_DIR)/lvgl/lv_draw
@@ -0,0 +1,415 @@
+/**
+ * @file lv_draw_acc.c
+ * Interface of 2D accelerators drawing into the VDB and its software implementation
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_acc.h"
+#if USE_LV_GPU_2D && LV_VDB_SIZE != 0
+
+#include <stddef.h>
+#include <string.h>
+#include "lv_draw.h"
+#include "lv_draw_rect.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void sw_fill(const lv_acc_buf_t * dest, lv_color_t color, lv_opa_t opa);
+static void sw_blit(const lv_acc_buf_t * dest, const uint8_t * src, uint32_t src_stride, const lv_acc_blit_dsc_t * dsc);
+static void sw_mask(const lv_acc_buf_t * dest, const uint8_t * mask, uint32_t mask_stride, lv_coord_t mask_x, uint8_t bpp,
+                    lv_color_t color, lv_opa_t opa);
+static void sw_fill_round(const lv_acc_buf_t * dest, const lv_area_t * rect, lv_coord_t radius, lv_color_t color, lv_opa_t opa);
+static void round_fill(const lv_area_t * coords, const lv_area_t * mask, lv_color_t color, lv_opa_t opa);
+static void round_px(lv_coord_t x, lv_coord_t y, const lv_area_t * mask, lv_color_t color, lv_opa_t opa);
+static void fill_span(lv_color_t * d, lv_coord_t len, lv_color_t color, lv_opa_t opa);
+static inline lv_color_t map_get_px(const uint8_t * px_p, bool alpha_byte);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const lv_acc_t acc_sw = {
+    .caps = LV_ACC_CAP_FILL | LV_ACC_CAP_FILL_OPA |
+    LV_ACC_CAP_BLIT | LV_ACC_CAP_BLIT_OPA | LV_ACC_CAP_BLIT_ALPHA | LV_ACC_CAP_BLIT_RECOLOR | LV_ACC_CAP_BLIT_CHROMA |
+    LV_ACC_CAP_MASK_A1 | LV_ACC_CAP_MASK_A2 | LV_ACC_CAP_MASK_A4 | LV_ACC_CAP_MASK_A8 |
+    LV_ACC_CAP_FILL_ROUND,
+    .fill_min_px = 0,
+    .blit_min_px = 0,
+    .mask_min_px = 0,
+    .fill_round_min_px = 0,
+    .fill = sw_fill,
+    .blit = sw_blit,
+    .mask = sw_mask,
+    .fill_round = sw_fill_round,
+};
+
+/*Opacity mapping of the masks with 1, 2 and 4 bpp (the same as with the letters)*/
+static const uint8_t bpp1_opa_table[2] =  {0, 255};
+static const uint8_t bpp2_opa_table[4] =  {0, 85, 170, 255};
+static const uint8_t bpp4_opa_table[16] = {0,   17,  34,  51,
+                                           68,  85,  102, 119,
+                                           136, 153, 170, 187,
+                                           204, 221, 238, 255
+                                          };
+
+static const lv_acc_buf_t * round_dest;     /*The window of `sw_fill_round`*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Get the software implementation of the 2D accelerator interface. It supports everything without
+ * size limits and can be used as a reference or a fallback of a hardware accelerator.
+ * @return pointer to a constant accelerator description. Set it as `lv_disp_drv_t.acc`.
+ */
+const lv_acc_t * lv_acc_sw_get(void)
+{
+    return &acc_sw;
+}
+
+/**
+ * Get the capabilities a `blit` requires
+ * @param dsc pointer to the parameters of the `blit`
+ * @return the required `LV_ACC_CAP_...` flags
+ */
+lv_acc_cap_t lv_acc_blit_caps(const lv_acc_blit_dsc_t * dsc)
+{
+    lv_acc_cap_t caps = LV_ACC_CAP_BLIT;
+    if(dsc->opa != LV_OPA_COVER) caps |= LV_ACC_CAP_BLIT_OPA;
+    if(dsc->alpha_byte) caps |= LV_ACC_CAP_BLIT_ALPHA;
+    if(dsc->recolor_opa != LV_OPA_TRANSP) caps |= LV_ACC_CAP_BLIT_RECOLOR;
+    if(dsc->chroma_key) caps |= LV_ACC_CAP_BLIT_CHROMA;
+
+    return caps;
+}
+
+/**
+ * Get the capability of a `mask` operation
+ * @param bpp bit per pixel of the mask (1, 2, 4 or 8)
+ * @return `LV_ACC_CAP_MASK_A...` or 0 with an invalid `bpp`
+ */
+lv_acc_cap_t lv_acc_mask_caps(uint8_t bpp)
+{
+    switch(bpp) {
+        case 1:
+            return LV_ACC_CAP_MASK_A1;
+        case 2:
+            return LV_ACC_CAP_MASK_A2;
+        case 4:
+            return LV_ACC_CAP_MASK_A4;
+        case 8:
+            return LV_ACC_CAP_MASK_A8;
+        default:
+            return 0;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Fill a window with a color
+ * @param dest pointer to the window to fill
+ * @param color fill color
+ * @param opa opacity (0, LV_OPA_TRANSP: transparent ... 255, LV_OPA_COVER, fully cover)
+ */
+static void sw_fill(const lv_acc_buf_t * dest, lv_color_t color, lv_opa_t opa)
+{
+    lv_color_t * d = dest->buf;
+    lv_coord_t row;
+
+    if(opa == LV_OPA_COVER) {
+        /*Fill the first row and copy it to the others*/
+        fill_span(d, dest->w, color, opa);
+        uint32_t row_size = (uint32_t)dest->w * sizeof(lv_color_t);
+        for(row = 1; row < dest->h; row++) {
+            memcpy(d + dest->stride, d, row_size);
+            d += dest->stride;
+        }
+    } else {
+        for(row = 0; row < dest->h; row++) {
+            fill_span(d, dest->w, color, opa);
+            d += dest->stride;
+        }
+    }
+}
+
+/**
+ * Draw a color map to a window
+ * @param dest pointer to the window to draw
+ * @param src the pixel of the map for the top left pixel of the window
+ * @param src_stride distance of the rows of the map in bytes
+ * @param dsc pointer to the parameters of the drawing
+ */
+static void sw_blit(const lv_acc_buf_t * dest, const uint8_t * src, uint32_t src_stride, const lv_acc_blit_dsc_t * dsc)
+{
+    lv_color_t * d = dest->buf;
+    lv_opa_t opa = dsc->opa;
+    lv_coord_t row;
+    lv_coord_t col;
+
+    /*The simplest case: copy or mix the rows*/
+    if(dsc->alpha_byte == 0 && dsc->chroma_key == 0 && dsc->recolor_opa == LV_OPA_TRANSP) {
+        for(row = 0; row < dest->h; row++) {
+            const lv_color_t * s = (const lv_color_t *)src;
+            if(opa == LV_OPA_COVER) {
+                memcpy(d, s, (uint32_t)dest->w * sizeof(lv_color_t));
+            } else {
+                for(col = 0; col < dest->w; col++) d[col] = lv_color_mix(s[col], d[col], opa);
+            }
+            src += src_stride;
+            d += dest->stride;
+        }
+        return;
+    }
+
+    uint8_t px_size = dsc->alpha_byte ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+    lv_color_t chroma_key_color = LV_COLOR_TRANSP;
+    lv_color_t last_img_px = LV_COLOR_BLACK;
+    lv_color_t recolored_px = lv_color_mix(dsc->recolor, last_img_px, dsc->recolor_opa);
+
+    for(row = 0; row < dest->h; row++) {
+        const uint8_t * px_p = src;
+        for(col = 0; col < dest->w; col++, px_p += px_size) {
+            lv_opa_t opa_result = opa;
+            lv_color_t px_color = map_get_px(px_p, dsc->alpha_byte);
+
+            /*Calculate with the pixel level alpha*/
+            if(dsc->alpha_byte) {
+                lv_opa_t px_opa = px_p[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+                if(px_opa == LV_OPA_TRANSP) continue;
+                else if(px_opa != LV_OPA_COVER) opa_result = (uint32_t)((uint32_t)px_opa * opa_result) >> 8;
+            }
+
+            if(dsc->chroma_key && px_color.full == chroma_key_color.full) continue;
+
+            if(dsc->recolor_opa != LV_OPA_TRANSP) {
+                /*Calculate only for new colors*/
+                if(last_img_px.full != px_color.full) {
+                    last_img_px = px_color;
+                    recolored_px = lv_color_mix(dsc->recolor, last_img_px, dsc->recolor_opa);
+                }
+                px_color = recolored_px;
+            }
+
+            if(opa_result == LV_OPA_COVER) d[col] = px_color;
+            else d[col] = lv_color_mix(px_color, d[col], opa_result);
+        }
+        src += src_stride;
+        d += dest->stride;
+    }
+}
+
+/**
+ * Fill a window with a color using an opacity map
+ * @param dest pointer to the window to fill
+ * @param mask the first row of the opacity map
+ * @param mask_stride length of the rows of the map in bytes
+ * @param mask_x the pixel of the rows for the first column of the window
+ * @param bpp bit per pixel of the map (1, 2, 4 or 8)
+ * @param color fill color
+ * @param opa opacity of the whole map (scales the map's opacity)
+ */
+static void sw_mask(const lv_acc_buf_t * dest, const uint8_t * mask, uint32_t mask_stride, lv_coord_t mask_x, uint8_t bpp,
+                    lv_color_t color, lv_opa_t opa)
+{
+    const uint8_t * opa_table;
+    switch(bpp) {
+        case 1:
+            opa_table = bpp1_opa_table;
+            break;
+        case 2:
+            opa_table = bpp2_opa_table;
+            break;
+        case 4:
+            opa_table = bpp4_opa_table;
+            break;
+        case 8:
+            opa_table = NULL;
+            break;
+        default:
+            return;
+    }
+
+    uint8_t px_mask = (1 << bpp) - 1;
+    uint32_t bit_start = (uint32_t)mask_x * bpp;
+    lv_color_t * d = dest->buf;
+    lv_coord_t row;
+    lv_coord_t col;
+
+    for(row = 0; row < dest->h; row++) {
+        const uint8_t * m = mask + (bit_start >> 3);
+        uint8_t bit = bit_start & 0x7;
+        col = 0;
+        while(col < dest->w) {
+            /*Skip the empty bytes at once*/
+            if(bit == 0 && *m == 0 && col + (8 / bpp) <= dest->w) {
+                col += 8 / bpp;
+                m++;
+                continue;
+            }
+
+            uint8_t v = (*m >> (8 - bit - bpp)) & px_mask;
+            if(v != 0) {
+                lv_opa_t px_opa = opa_table ? opa_table[v] : v;
+                if(opa != LV_OPA_COVER) px_opa = (uint16_t)((uint16_t)px_opa * opa) >> 8;
+                d[col] = lv_color_mix(color, d[col], px_opa);
+            }
+
+            col++;
+            bit += bpp;
+            if(bit >= 8) {
+                bit = 0;
+                m++;
+            }
+        }
+        mask += mask_stride;
+        d += dest->stride;
+    }
+}
+
+/**
+ * Fill the part of a rectangle with rounded corners which is in a window
+ * @param dest pointer to the window to fill
+ * @param rect coordinates of the rectangle relative to the top left pixel of the window
+ * @param radius radius of the corners
+ * @param color fill color
+ * @param opa opacity (0, LV_OPA_TRANSP: transparent ... 255, LV_OPA_COVER, fully cover)
+ */
+static void sw_fill_round(const lv_acc_buf_t * dest, const lv_area_t * rect, lv_coord_t radius, lv_color_t color, lv_opa_t opa)
+{
+    /*Draw with the same algorithm as `lv_draw_rect` to get exactly the same pixels*/
+    lv_area_t win;
+    lv_area_set(&win, 0, 0, dest->w - 1, dest->h - 1);
+
+    round_dest = dest;
+    lv_draw_rect_body_round(rect, &win, radius, color, opa, round_fill, round_px);
+    round_dest = NULL;
+}
+
+/**
+ * Fill an area of the window of `sw_fill_round` (works like `lv_vfill`)
+ * @param coords coordinates of the area relative to the window
+ * @param mask fill only on this area
+ * @param color fill color
+ * @param opa opacity (0, LV_OPA_TRANSP: transparent ... 255, LV_OPA_COVER, fully cover)
+ */
+static void round_fill(const lv_area_t * coords, const lv_area_t * mask, lv_color_t color, lv_opa_t opa)
+{
+    if(opa < LV_OPA_MIN) return;
+    if(opa > LV_OPA_MAX) opa = LV_OPA_COVER;
+
+    lv_area_t res_a;
+    if(lv_area_intersect(&res_a, coords, mask) == false) return;
+
+    lv_color_t * d = round_dest->buf + (int32_t)res_a.y1 * round_dest->stride + res_a.x1;
+    lv_coord_t w = lv_area_get_width(&res_a);
+    lv_coord_t row;
+    for(row = res_a.y1; row <= res_a.y2; row++) {
+        fill_span(d, w, color, opa);
+        d += round_dest->stride;
+    }
+}
+
+/**
+ * Draw a pixel in the window of `sw_fill_round` (works like `lv_vpx`)
+ * @param x x coordinate of the pixel relative to the window
+ * @param y y coordinate of the pixel relative to the window
+ * @param mask draw only on this area
+ * @param color pixel color
+ * @param opa opacity (0, LV_OPA_TRANSP: transparent ... 255, LV_OPA_COVER, fully cover)
+ */
+static void round_px(lv_coord_t x, lv_coord_t y, const lv_area_t * mask, lv_color_t color, lv_opa_t opa)
+{
+    if(opa < LV_OPA_MIN) return;
+    if(opa > LV_OPA_MAX) opa = LV_OPA_COVER;
+
+    if(x < mask->x1 || x > mask->x2 || y < mask->y1 || y > mask->y2) return;
+
+    lv_color_t * d = round_dest->buf + (int32_t)y * round_dest->stride + x;
+    if(opa == LV_OPA_COVER) *d = color;
+    else *d = lv_color_mix(color, *d, opa);
+}
+
+/**
+ * Fill a row of pixels
+ * @param d pointer to the first pixel
+ * @param len number of pixels
+ * @param color fill color
+ * @param opa opacity (0, LV_OPA_TRANSP: transparent ... 255, LV_OPA_COVER, fully cover)
+ */
+static void fill_span(lv_color_t * d, lv_coord_t len, lv_color_t color, lv_opa_t opa)
+{
+    lv_coord_t i;
+
+    if(opa == LV_OPA_COVER) {
+#if LV_COLOR_DEPTH == 16
+        /*Write two pixels at once from a word aligned address*/
+        if(((uintptr_t)d & 0x3) && len > 0) {
+            *d = color;
+            d++;
+            len--;
+        }
+        uint32_t c32 = ((uint32_t)color.full << 16) | color.full;
+        uint32_t * d32 = (uint32_t *)d;
+        for(i = 0; i < (len >> 1); i++) d32[i] = c32;
+        if(len & 0x1) d[len - 1] = color;
+#else
+        for(i = 0; i < len; i++) d[i] = color;
+#endif
+    } else {
+        /*Mix only when the background changes (typically it's the same for many pixels)*/
+        lv_color_t bg_tmp = LV_COLOR_BLACK;
+        lv_color_t opa_tmp = lv_color_mix(color, bg_tmp, opa);
+        for(i = 0; i < len; i++) {
+            if(d[i].full != bg_tmp.full) {
+                bg_tmp = d[i];
+                opa_tmp = lv_color_mix(color, bg_tmp, opa);
+            }
+            d[i] = opa_tmp;
+        }
+    }
+}
+
+/**
+ * Read a pixel of a color map
+ * @param px_p pointer to the pixel
+ * @param alpha_byte true: an alpha byte follows the pixels so they can be unaligned
+ * @return the color of the pixel
+ */
+static inline lv_color_t map_get_px(const uint8_t * px_p, bool alpha_byte)
+{
+    lv_color_t px_color;
+    if(alpha_byte) {
+#if LV_COLOR_DEPTH == 8 || LV_COLOR_DEPTH == 1
+        px_color.full = px_p[0];
+#elif LV_COLOR_DEPTH == 16
+        /*Because of Alpha byte 16 bit color can start on odd address which can cause crash*/
+        px_color.full = px_p[0] + (px_p[1] << 8);
+#elif LV_COLOR_DEPTH == 24 || LV_COLOR_DEPTH == 32
+        px_color = *((const lv_color_t *)px_p);
+#endif
+    } else {
+        px_color = *((const lv_color_t *)px_p);
+    }
+
+    return px_color;
+}
+
+#endif /*USE_LV_GPU_2D && LV_VDB_SIZE != 0*/
@@ -0,0 +1,138 @@
+/**
+ * @file lv_draw_acc.h
+ * Interface of 2D accelerators drawing into the VDB and its software implementation
+ */
+
+#ifndef LV_DRAW_ACC_H
+#define LV_DRAW_ACC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifdef LV_CONF_INCLUDE_SIMPLE
+#include "lv_conf.h"
+#else
+#include "../../lv_conf.h"
+#endif
+
+#if USE_LV_GPU_2D && LV_VDB_SIZE != 0
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../lv_misc/lv_color.h"
+#include "../lv_misc/lv_area.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#if LV_COLOR_SCREEN_TRANSP
+#error "LittlevGL: USE_LV_GPU_2D requires LV_COLOR_SCREEN_TRANSP 0"
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Capabilities of an accelerator. An operation is used only if all the required capabilities are set.*/
+enum {
+    LV_ACC_CAP_FILL         = 0x0001,   /*`fill` with LV_OPA_COVER*/
+    LV_ACC_CAP_FILL_OPA     = 0x0002,   /*`fill` with opacity*/
+    LV_ACC_CAP_BLIT         = 0x0004,   /*`blit` a color map with LV_OPA_COVER*/
+    LV_ACC_CAP_BLIT_OPA     = 0x0008,   /*`blit` with opacity*/
+    LV_ACC_CAP_BLIT_ALPHA   = 0x0010,   /*`blit` a map with an alpha byte for every pixel (LV_IMG_PX_SIZE_ALPHA_BYTE)*/
+    LV_ACC_CAP_BLIT_RECOLOR = 0x0020,   /*`blit` with recoloring*/
+    LV_ACC_CAP_BLIT_CHROMA  = 0x0040,   /*`blit` skipping the LV_COLOR_TRANSP pixels*/
+    LV_ACC_CAP_MASK_A1      = 0x0080,   /*`mask` with 1 bit per pixel (e.g. glyphs)*/
+    LV_ACC_CAP_MASK_A2      = 0x0100,   /*`mask` with 2 bit per pixel*/
+    LV_ACC_CAP_MASK_A4      = 0x0200,   /*`mask` with 4 bit per pixel*/
+    LV_ACC_CAP_MASK_A8      = 0x0400,   /*`mask` with 8 bit per pixel*/
+    LV_ACC_CAP_FILL_ROUND   = 0x0800,   /*`fill_round` a rectangle with rounded corners*/
+};
+typedef uint16_t lv_acc_cap_t;
+
+/*A rectangular window in a buffer to draw*/
+typedef struct {
+    lv_color_t * buf;           /*The top left pixel of the window*/
+    lv_coord_t stride;          /*Pixels from the start of a row to the start of the next row*/
+    lv_coord_t w;               /*Width of the window*/
+    lv_coord_t h;               /*Height of the window*/
+} lv_acc_buf_t;
+
+/*Parameters of `blit`*/
+typedef struct {
+    lv_opa_t opa;               /*Opacity of the whole map*/
+    lv_color_t recolor;         /*Mix the pixels with this color...*/
+    lv_opa_t recolor_opa;       /*...with this intensity (LV_OPA_TRANSP: no recoloring)*/
+    uint8_t alpha_byte  :1;     /*1: an alpha byte follows every pixel of the map*/
+    uint8_t chroma_key  :1;     /*1: skip the LV_COLOR_TRANSP pixels*/
+} lv_acc_blit_dsc_t;
+
+/**
+ * Description of a 2D accelerator. The operations draw into a window of the VDB and
+ * have to be ready when they return. An operation can be NULL if its capabilities are not set.
+ * Smaller areas than the `..._min_px` thresholds are drawn by software because of the set up overhead.
+ */
+typedef struct {
+    lv_acc_cap_t caps;          /*`LV_ACC_CAP_...` flags*/
+    uint32_t fill_min_px;
+    uint32_t blit_min_px;
+    uint32_t mask_min_px;
+    uint32_t fill_round_min_px;
+
+    /*Fill the window with a color*/
+    void (*fill)(const lv_acc_buf_t * dest, lv_color_t color, lv_opa_t opa);
+
+    /*Draw a color map to the window. `src` is the pixel for the top left corner of the window,
+     *`src_stride` is the distance of the rows in bytes.*/
+    void (*blit)(const lv_acc_buf_t * dest, const uint8_t * src, uint32_t src_stride, const lv_acc_blit_dsc_t * dsc);
+
+    /*Fill the window with a color using the opacity map `mask` with `bpp` bit per pixel (1, 2, 4 or 8).
+     *The rows of `mask` are `mask_stride` bytes and the window starts from the `mask_x`th pixel of the first row.*/
+    void (*mask)(const lv_acc_buf_t * dest, const uint8_t * mask, uint32_t mask_stride, lv_coord_t mask_x, uint8_t bpp,
+                 lv_color_t color, lv_opa_t opa);
+
+    /*Fill the part of a rectangle with rounded corners which is in the window. `rect` is relative
+     *to the top left pixel of the window and can be larger than the window. The corners are anti-aliased if LV_ANTIALIAS.*/
+    void (*fill_round)(const lv_acc_buf_t * dest, const lv_area_t * rect, lv_coord_t radius, lv_color_t color, lv_opa_t opa);
+} lv_acc_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get the software implementation of the 2D accelerator interface. It supports everything without
+ * size limits and can be used as a reference or a fallback of a hardware accelerator.
+ * @return pointer to a constant accelerator description. Set it as `lv_disp_drv_t.acc`.
+ */
+const lv_acc_t * lv_acc_sw_get(void);
+
+/**
+ * Get the capabilities a `blit` requires
+ * @param dsc pointer to the parameters of the `blit`
+ * @return the required `LV_ACC_CAP_...` flags
+ */
+lv_acc_cap_t lv_acc_blit_caps(const lv_acc_blit_dsc_t * dsc);
+
+/**
+ * Get the capability of a `mask` operation
+ * @param bpp bit per pixel of the mask (1, 2, 4 or 8)
+ * @return `LV_ACC_CAP_MASK_A...` or 0 with an invalid `bpp`
+ */
+lv_acc_cap_t lv_acc_mask_caps(uint8_t bpp);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*USE_LV_GPU_2D && LV_VDB_SIZE != 0*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_DRAW_ACC_H*/
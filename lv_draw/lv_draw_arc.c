@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_draw_arc.h"
+#include "lv_draw_dl.h"
 #include "../lv_misc/lv_math.h"
 
 /*********************
@@ -20,6 +21,9 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void draw_arc(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius, const lv_area_t * mask,
+                     uint16_t start_angle, uint16_t end_angle, const lv_style_t * style, lv_opa_t opa_scale,
+                     const uint8_t * angle_map);
 static uint16_t fast_atan2(int x, int y);
 static void ver_line(lv_coord_t x, lv_coord_t y, const lv_area_t * mask, lv_coord_t len, lv_color_t color, lv_opa_t opa);
 static void hor_line(lv_coord_t x, lv_coord_t y, const lv_area_t * mask, lv_coord_t len, lv_color_t color, lv_opa_t opa);
@@ -51,6 +55,74 @@ static bool deg_test_inv(uint16_t deg, uint16_t start, uint16_t end);
  */
 void lv_draw_arc(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius, const lv_area_t * mask,
                  uint16_t start_angle, uint16_t end_angle, const lv_style_t * style, lv_opa_t opa_scale)
+{
+#if LV_REFR_DISP_LIST
+    if(lv_draw_dl_is_rec()) {
+        lv_draw_dl_add_arc(center_x, center_y, radius, mask, start_angle, end_angle, style, opa_scale);
+        return;
+    }
+#endif
+
+    draw_arc(center_x, center_y, radius, mask, start_angle, end_angle, style, opa_scale, NULL);
+}
+
+/**
+ * Draw an arc using the pre-calculated angles of its pixels. Looks the same as `lv_draw_arc`
+ * but skips the angle calculation of every pixel.
+ * @param center_x the x coordinate of the center of the arc
+ * @param center_y the y coordinate of the center of the arc
+ * @param radius the radius of the arc
+ * @param mask the arc will be drawn only in this mask
+ * @param start_angle the start angle of the arc (0 deg on the bottom, 90 deg on the right)
+ * @param end_angle the end angle of the arc
+ * @param style style of the arc (`body.thickness`, `body.main_color`, `body.opa` is used)
+ * @param opa_scale scale down all opacities by the factor
+ * @param angle_map angles filled by `lv_draw_arc_fill_angle_map` with the same `radius`
+ */
+void lv_draw_arc_cached(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius, const lv_area_t * mask,
+                        uint16_t start_angle, uint16_t end_angle, const lv_style_t * style, lv_opa_t opa_scale,
+                        const uint8_t * angle_map)
+{
+#if LV_REFR_DISP_LIST
+    /*The map might not live until the replay so record a normal arc*/
+    if(lv_draw_dl_is_rec()) {
+        lv_draw_dl_add_arc(center_x, center_y, radius, mask, start_angle, end_angle, style, opa_scale);
+        return;
+    }
+#endif
+
+    draw_arc(center_x, center_y, radius, mask, start_angle, end_angle, style, opa_scale, angle_map);
+}
+
+/**
+ * Calculate the angles of the pixels in the top left quarter of an arc for `lv_draw_arc_cached`
+ * @param angle_map store the angles here. Its size should be `LV_DRAW_ARC_ANGLE_MAP_SIZE(radius)`
+ * @param radius the radius of the arc
+ */
+void lv_draw_arc_fill_angle_map(uint8_t * angle_map, uint16_t radius)
+{
+    int16_t r = radius;
+    int16_t xi;
+    int16_t yi;
+    for(yi = -r; yi < 0; yi++) {
+        for(xi = -r; xi < 0; xi++) {
+            *angle_map = fast_atan2(xi, yi) - 180;     /*0..90 in this quarter*/
+            angle_map++;
+        }
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Draw an arc. Calculates the angle of every pixel or reads it from `angle_map`.
+ * The parameters are the same as `lv_draw_arc_cached`'s. `angle_map` can be NULL.
+ */
+static void draw_arc(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius, const lv_area_t * mask,
+                     uint16_t start_angle, uint16_t end_angle, const lv_style_t * style, lv_opa_t opa_scale,
+                     const uint8_t * angle_map)
 {
     lv_coord_t thickness = style->line.width;
     if(thickness > radius) thickness = radius;
@@ -80,6 +152,11 @@ void lv_draw_arc(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius, cons
     int16_t xi;
     int16_t yi;
     for(yi = -r_out; yi < 0; yi++) {
+        /*Skip the rows which are out of the mask (the row is drawn at `center_y + yi` and `center_y - yi`)*/
+        if((center_y + yi < mask->y1 || center_y + yi > mask->y2) &&
+                (center_y - yi < mask->y1 || center_y - yi > mask->y2)) continue;
+
+        const uint8_t * map_row = angle_map ? &angle_map[(yi + r_out) * r_out] : NULL;
         x_start[0] = LV_COORD_MIN;
         x_start[1] = LV_COORD_MIN;
         x_start[2] = LV_COORD_MIN;
@@ -93,7 +170,8 @@ void lv_draw_arc(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius, cons
             uint32_t r_act_sqr = xi * xi + yi * yi;
             if(r_act_sqr > r_out_sqr) continue;
 
-            deg_base =  fast_atan2(xi, yi) - 180;
+            if(map_row) deg_base = map_row[xi + r_out];
+            else deg_base =  fast_atan2(xi, yi) - 180;
 
             deg = 180 + deg_base;
             if(deg_test(deg, start_angle, end_angle)) {
@@ -231,9 +309,6 @@ static uint16_t fast_atan2(int x, int y)
     return degree;
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
 static void ver_line(lv_coord_t x, lv_coord_t y, const lv_area_t * mask, lv_coord_t len, lv_color_t color, lv_opa_t opa)
 {
     lv_area_t area;
@@ -19,6 +19,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/*Size of the angle map of an arc in bytes (the top left quarter of the arc)*/
+#define LV_DRAW_ARC_ANGLE_MAP_SIZE(radius)  ((uint32_t)(radius) * (radius))
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -41,6 +44,30 @@ extern "C" {
 void lv_draw_arc(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius, const lv_area_t * mask,
                  uint16_t start_angle, uint16_t end_angle, const lv_style_t * style, lv_opa_t opa_scale);
 
+/**
+ * Draw an arc using the pre-calculated angles of its pixels. Looks the same as `lv_draw_arc`
+ * but skips the angle calculation of every pixel.
+ * @param center_x the x coordinate of the center of the arc
+ * @param center_y the y coordinate of the center of the arc
+ * @param radius the radius of the arc
+ * @param mask the arc will be drawn only in this mask
+ * @param start_angle the start angle of the arc (0 deg on the bottom, 90 deg on the right)
+ * @param end_angle the end angle of the arc
+ * @param style style of the arc (`body.thickness`, `body.main_color`, `body.opa` is used)
+ * @param opa_scale scale down all opacities by the factor
+ * @param angle_map angles filled by `lv_draw_arc_fill_angle_map` with the same `radius`
+ */
+void lv_draw_arc_cached(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius, const lv_area_t * mask,
+                        uint16_t start_angle, uint16_t end_angle, const lv_style_t * style, lv_opa_t opa_scale,
+                        const uint8_t * angle_map);
+
+/**
+ * Calculate the angles of the pixels in the top left quarter of an arc for `lv_draw_arc_cached`
+ * @param angle_map store the angles here. Its size should be `LV_DRAW_ARC_ANGLE_MAP_SIZE(radius)`
+ * @param radius the radius of the arc
+ */
+void lv_draw_arc_fill_angle_map(uint8_t * angle_map, uint16_t radius);
+
 /**********************
  *      MACROS
  **********************/
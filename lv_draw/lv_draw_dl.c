@@ -0,0 +1,392 @@
+/**
+ * @file lv_draw_dl.c
+ * Display list: record the drawings of an area once and replay them on the parts of the VDB
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_dl.h"
+#if LV_REFR_DISP_LIST
+
+#include <stddef.h>
+#include <string.h>
+#include "lv_draw_arc.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Keep every command aligned to a pointer*/
+#define DL_ALIGN(size)   (((size) + sizeof(void *) - 1) & ~(sizeof(void *) - 1))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+enum {
+    DL_CMD_STYLE,       /*Not drawn. Stores a style used by the next commands*/
+    DL_CMD_MARK,        /*Not drawn. Marks where the drawings of an object start*/
+    DL_CMD_RECT,
+    DL_CMD_LABEL,
+    DL_CMD_LINE,
+    DL_CMD_IMG,
+    DL_CMD_ARC,
+    DL_CMD_TRIANGLE,
+};
+typedef uint8_t dl_cmd_type_t;
+
+/*The common header of the commands*/
+typedef struct {
+    uint16_t size;              /*Size of the whole command in bytes (aligned)*/
+    dl_cmd_type_t type;
+    lv_opa_t opa_scale;
+    lv_area_t mask;
+} dl_cmd_t;
+
+typedef struct {
+    dl_cmd_t hdr;
+    lv_style_t style;
+} dl_style_t;
+
+typedef struct {
+    dl_cmd_t hdr;
+    const void * id;
+} dl_mark_t;
+
+typedef struct {
+    dl_cmd_t hdr;
+    const lv_style_t * style;
+    lv_area_t coords;
+} dl_rect_t;
+
+typedef struct {
+    dl_cmd_t hdr;
+    const lv_style_t * style;
+    lv_area_t coords;
+    lv_point_t offset;
+    lv_txt_flag_t flag;
+    uint8_t has_offset;
+    char txt[];                 /*The text is copied here because it might be a local buffer of the caller*/
+} dl_label_t;
+
+typedef struct {
+    dl_cmd_t hdr;
+    const lv_style_t * style;
+    lv_point_t p1;
+    lv_point_t p2;
+} dl_line_t;
+
+typedef struct {
+    dl_cmd_t hdr;
+    const lv_style_t * style;
+    const void * src;
+    lv_area_t coords;
+} dl_img_t;
+
+typedef struct {
+    dl_cmd_t hdr;
+    const lv_style_t * style;
+    lv_coord_t center_x;
+    lv_coord_t center_y;
+    uint16_t radius;
+    uint16_t start_angle;
+    uint16_t end_angle;
+} dl_arc_t;
+
+typedef struct {
+    dl_cmd_t hdr;
+    lv_point_t points[3];
+    lv_color_t color;
+} dl_triangle_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void * dl_alloc(uint32_t size, dl_cmd_type_t type, const lv_area_t * mask, lv_opa_t opa_scale);
+static const lv_style_t * dl_add_style(const lv_style_t * style);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static void * dl_buf[LV_REFR_DISP_LIST_SIZE / sizeof(void *)];     /*`void *` type to align the buffer*/
+static uint32_t dl_used;                /*Used bytes in `dl_buf`*/
+static dl_style_t * dl_last_style;      /*The last saved style to reuse it by the next commands*/
+static bool dl_rec;
+static bool dl_full;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Clear the display list and start recording. While recording the `lv_draw_...` functions
+ * only add a command to the list instead of drawing.
+ */
+void lv_draw_dl_start(void)
+{
+    dl_used = 0;
+    dl_last_style = NULL;
+    dl_full = false;
+    dl_rec = true;
+}
+
+/**
+ * Stop recording
+ * @return true: the list is complete; false: the list became full so it can't be replayed
+ */
+bool lv_draw_dl_stop(void)
+{
+    dl_rec = false;
+    return dl_full ? false : true;
+}
+
+/**
+ * Tell whether the drawings are being recorded
+ * @return true: recording is in progress
+ */
+bool lv_draw_dl_is_rec(void)
+{
+    return dl_rec;
+}
+
+/**
+ * Draw the recorded commands which are on a clip area.
+ * @param clip the masks of the commands are limited to this area (typically the area of the VDB)
+ * @param start_id skip the commands before the mark with this ID. NULL to start from the beginning
+ * @return true: the commands are drawn; false: `start_id` is not found, nothing is drawn
+ */
+bool lv_draw_dl_replay(const lv_area_t * clip, const void * start_id)
+{
+    uint8_t * buf = (uint8_t *)dl_buf;
+    uint32_t i = 0;
+    lv_area_t mask;
+
+    /*Find the start mark*/
+    if(start_id) {
+        while(i < dl_used) {
+            const dl_mark_t * mark = (const dl_mark_t *)&buf[i];
+            if(mark->hdr.type == DL_CMD_MARK && mark->id == start_id) break;
+            i += mark->hdr.size;
+        }
+
+        if(i >= dl_used) return false;
+    }
+
+    while(i < dl_used) {
+        const dl_cmd_t * cmd = (const dl_cmd_t *)&buf[i];
+        i += cmd->size;
+
+        if(cmd->type == DL_CMD_STYLE || cmd->type == DL_CMD_MARK) continue;
+        if(lv_area_intersect(&mask, &cmd->mask, clip) == false) continue;
+
+        switch(cmd->type) {
+            case DL_CMD_RECT: {
+                const dl_rect_t * rect = (const dl_rect_t *)cmd;
+                lv_draw_rect(&rect->coords, &mask, rect->style, cmd->opa_scale);
+                break;
+            }
+            case DL_CMD_LABEL: {
+                const dl_label_t * label = (const dl_label_t *)cmd;
+                lv_point_t offset = label->offset;      /*Copy because `lv_draw_label` requires a non-const pointer*/
+                lv_draw_label(&label->coords, &mask, label->style, cmd->opa_scale,
+                              label->txt, label->flag, label->has_offset ? &offset : NULL);
+                break;
+            }
+            case DL_CMD_LINE: {
+                const dl_line_t * line = (const dl_line_t *)cmd;
+                lv_draw_line(&line->p1, &line->p2, &mask, line->style, cmd->opa_scale);
+                break;
+            }
+            case DL_CMD_IMG: {
+                const dl_img_t * img = (const dl_img_t *)cmd;
+                lv_draw_img(&img->coords, &mask, img->src, img->style, cmd->opa_scale);
+                break;
+            }
+            case DL_CMD_ARC: {
+                const dl_arc_t * arc = (const dl_arc_t *)cmd;
+                lv_draw_arc(arc->center_x, arc->center_y, arc->radius, &mask,
+                            arc->start_angle, arc->end_angle, arc->style, cmd->opa_scale);
+                break;
+            }
+            case DL_CMD_TRIANGLE: {
+                const dl_triangle_t * tri = (const dl_triangle_t *)cmd;
+                lv_draw_triangle(tri->points, &mask, tri->color);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Add a mark to the list. The replay can be started from a mark.
+ * @param id an ID of the mark (e.g. pointer to the object which is drawn after it)
+ */
+void lv_draw_dl_add_mark(const void * id)
+{
+    dl_mark_t * mark = dl_alloc(sizeof(dl_mark_t), DL_CMD_MARK, NULL, LV_OPA_COVER);
+    if(mark == NULL) return;
+
+    mark->id = id;
+}
+
+/**
+ * Add a rectangle to the list. The parameters are the same as of `lv_draw_rect`
+ */
+void lv_draw_dl_add_rect(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale)
+{
+    style = dl_add_style(style);
+    dl_rect_t * rect = dl_alloc(sizeof(dl_rect_t), DL_CMD_RECT, mask, opa_scale);
+    if(rect == NULL) return;
+
+    rect->style = style;
+    lv_area_copy(&rect->coords, coords);
+}
+
+/**
+ * Add a text to the list. The parameters are the same as of `lv_draw_label`
+ */
+void lv_draw_dl_add_label(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale,
+                          const char * txt, lv_txt_flag_t flag, const lv_point_t * offset)
+{
+    if(txt == NULL) return;
+
+    style = dl_add_style(style);
+    uint32_t len = strlen(txt) + 1;
+    dl_label_t * label = dl_alloc(offsetof(dl_label_t, txt) + len, DL_CMD_LABEL, mask, opa_scale);
+    if(label == NULL) return;
+
+    label->style = style;
+    lv_area_copy(&label->coords, coords);
+    label->flag = flag;
+    if(offset) {
+        label->offset = *offset;
+        label->has_offset = 1;
+    } else {
+        label->offset.x = 0;
+        label->offset.y = 0;
+        label->has_offset = 0;
+    }
+    memcpy(label->txt, txt, len);
+}
+
+/**
+ * Add a line to the list. The parameters are the same as of `lv_draw_line`
+ */
+void lv_draw_dl_add_line(const lv_point_t * point1, const lv_point_t * point2, const lv_area_t * mask,
+                         const lv_style_t * style, lv_opa_t opa_scale)
+{
+    style = dl_add_style(style);
+    dl_line_t * line = dl_alloc(sizeof(dl_line_t), DL_CMD_LINE, mask, opa_scale);
+    if(line == NULL) return;
+
+    line->style = style;
+    line->p1 = *point1;
+    line->p2 = *point2;
+}
+
+/**
+ * Add an image to the list. The parameters are the same as of `lv_draw_img`
+ */
+void lv_draw_dl_add_img(const lv_area_t * coords, const lv_area_t * mask,
+                        const void * src, const lv_style_t * style, lv_opa_t opa_scale)
+{
+    style = dl_add_style(style);
+    dl_img_t * img = dl_alloc(sizeof(dl_img_t), DL_CMD_IMG, mask, opa_scale);
+    if(img == NULL) return;
+
+    img->style = style;
+    img->src = src;         /*The image sources are stored by the objects so only the pointer is saved*/
+    lv_area_copy(&img->coords, coords);
+}
+
+/**
+ * Add an arc to the list. The parameters are the same as of `lv_draw_arc`
+ */
+void lv_draw_dl_add_arc(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius, const lv_area_t * mask,
+                        uint16_t start_angle, uint16_t end_angle, const lv_style_t * style, lv_opa_t opa_scale)
+{
+    style = dl_add_style(style);
+    dl_arc_t * arc = dl_alloc(sizeof(dl_arc_t), DL_CMD_ARC, mask, opa_scale);
+    if(arc == NULL) return;
+
+    arc->style = style;
+    arc->center_x = center_x;
+    arc->center_y = center_y;
+    arc->radius = radius;
+    arc->start_angle = start_angle;
+    arc->end_angle = end_angle;
+}
+
+/**
+ * Add a triangle to the list. The parameters are the same as of `lv_draw_triangle`
+ */
+void lv_draw_dl_add_triangle(const lv_point_t * points, const lv_area_t * mask, lv_color_t color)
+{
+    dl_triangle_t * tri = dl_alloc(sizeof(dl_triangle_t), DL_CMD_TRIANGLE, mask, LV_OPA_COVER);
+    if(tri == NULL) return;
+
+    memcpy(tri->points, points, sizeof(tri->points));
+    tri->color = color;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Allocate a new command at the end of the list
+ * @param size size of the command in bytes
+ * @param type type of the command
+ * @param mask mask of the drawing (the area is copied). NULL if not drawn
+ * @param opa_scale opacity scale of the drawing
+ * @return pointer to the new command or NULL if the list is full
+ */
+static void * dl_alloc(uint32_t size, dl_cmd_type_t type, const lv_area_t * mask, lv_opa_t opa_scale)
+{
+    size = DL_ALIGN(size);
+    if(dl_full || size > UINT16_MAX || dl_used + size > sizeof(dl_buf)) {
+        dl_full = true;
+        return NULL;
+    }
+
+    dl_cmd_t * cmd = (dl_cmd_t *)((uint8_t *)dl_buf + dl_used);
+    dl_used += size;
+
+    cmd->size = size;
+    cmd->type = type;
+    cmd->opa_scale = opa_scale;
+    if(mask) lv_area_copy(&cmd->mask, mask);
+    else memset(&cmd->mask, 0, sizeof(lv_area_t));
+
+    return cmd;
+}
+
+/**
+ * Save a copy of a style in the list because the design functions often use local styles.
+ * If the last saved style is the same it is reused.
+ * @param style pointer to a style
+ * @return pointer to the saved style or NULL if the list is full
+ */
+static const lv_style_t * dl_add_style(const lv_style_t * style)
+{
+    if(dl_last_style && memcmp(&dl_last_style->style, style, sizeof(lv_style_t)) == 0) {
+        return &dl_last_style->style;
+    }
+
+    dl_style_t * saved = dl_alloc(sizeof(dl_style_t), DL_CMD_STYLE, NULL, LV_OPA_COVER);
+    if(saved == NULL) return NULL;
+
+    memcpy(&saved->style, style, sizeof(lv_style_t));
+    dl_last_style = saved;
+
+    return &saved->style;
+}
+
+#endif /*LV_REFR_DISP_LIST*/
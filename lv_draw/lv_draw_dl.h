@@ -0,0 +1,93 @@
+/**
+ * @file lv_draw_dl.h
+ * Display list: record the drawings of an area once and replay them on the parts of the VDB
+ */
+
+#ifndef LV_DRAW_DL_H
+#define LV_DRAW_DL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifdef LV_CONF_INCLUDE_SIMPLE
+#include "lv_conf.h"
+#else
+#include "../../lv_conf.h"
+#endif
+
+#if LV_REFR_DISP_LIST
+
+#include <stdbool.h>
+#include "lv_draw.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Clear the display list and start recording. While recording the `lv_draw_...` functions
+ * only add a command to the list instead of drawing.
+ */
+void lv_draw_dl_start(void);
+
+/**
+ * Stop recording
+ * @return true: the list is complete; false: the list became full so it can't be replayed
+ */
+bool lv_draw_dl_stop(void);
+
+/**
+ * Tell whether the drawings are being recorded
+ * @return true: recording is in progress
+ */
+bool lv_draw_dl_is_rec(void);
+
+/**
+ * Draw the recorded commands which are on a clip area.
+ * @param clip the masks of the commands are limited to this area (typically the area of the VDB)
+ * @param start_id skip the commands before the mark with this ID. NULL to start from the beginning
+ * @return true: the commands are drawn; false: `start_id` is not found, nothing is drawn
+ */
+bool lv_draw_dl_replay(const lv_area_t * clip, const void * start_id);
+
+/**
+ * Add a mark to the list. The replay can be started from a mark.
+ * @param id an ID of the mark (e.g. pointer to the object which is drawn after it)
+ */
+void lv_draw_dl_add_mark(const void * id);
+
+/*Add commands to the list. Called by the `lv_draw_...` functions while recording*/
+void lv_draw_dl_add_rect(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale);
+void lv_draw_dl_add_label(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale,
+                          const char * txt, lv_txt_flag_t flag, const lv_point_t * offset);
+void lv_draw_dl_add_line(const lv_point_t * point1, const lv_point_t * point2, const lv_area_t * mask,
+                         const lv_style_t * style, lv_opa_t opa_scale);
+void lv_draw_dl_add_img(const lv_area_t * coords, const lv_area_t * mask,
+                        const void * src, const lv_style_t * style, lv_opa_t opa_scale);
+void lv_draw_dl_add_arc(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius, const lv_area_t * mask,
+                        uint16_t start_angle, uint16_t end_angle, const lv_style_t * style, lv_opa_t opa_scale);
+void lv_draw_dl_add_triangle(const lv_point_t * points, const lv_area_t * mask, lv_color_t color);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_REFR_DISP_LIST*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_DRAW_DL_H*/
@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_draw_img.h"
+#include "lv_draw_dl.h"
 #include "../lv_misc/lv_fs.h"
 
 /*********************
@@ -68,6 +69,13 @@ static lv_img_decoder_close_f_t lv_img_decoder_close_custom;
 void lv_draw_img(const lv_area_t * coords, const lv_area_t * mask,
                  const void * src, const lv_style_t * style, lv_opa_t opa_scale)
 {
+#if LV_REFR_DISP_LIST
+    if(lv_draw_dl_is_rec()) {
+        lv_draw_dl_add_img(coords, mask, src, style, opa_scale);
+        return;
+    }
+#endif
+
     if(src == NULL) {
         LV_LOG_WARN("Image draw: src is NULL");
         lv_draw_rect(coords, mask, &lv_style_plain, LV_OPA_COVER);
@@ -583,6 +591,8 @@ static lv_res_t lv_img_built_in_decoder_line_alpha(lv_coord_t x, lv_coord_t y, l
         /*Because of Alpha byte 16 bit color can start on odd address which can cause crash*/
         buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE] = bg_color.full & 0xFF;
         buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE + 1] = (bg_color.full >> 8) & 0xFF;
+#elif LV_COLOR_DEPTH == 24
+        memcpy(&buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE], &bg_color, sizeof(lv_color_t));
 #elif LV_COLOR_DEPTH == 32
         *((uint32_t *)&buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE]) = bg_color.full;
 #else
@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_draw_label.h"
+#include "lv_draw_dl.h"
 #include "lv_draw_rbasic.h"
 #include "../lv_misc/lv_math.h"
 
@@ -57,6 +58,13 @@ static uint8_t hex_char_to_num(char hex);
 void lv_draw_label(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale,
                    const char * txt, lv_txt_flag_t flag, lv_point_t * offset)
 {
+#if LV_REFR_DISP_LIST
+    if(lv_draw_dl_is_rec()) {
+        lv_draw_dl_add_label(coords, mask, style, opa_scale, txt, flag, offset);
+        return;
+    }
+#endif
+
     const lv_font_t * font = style->text.font;
     lv_coord_t w;
     if((flag & LV_TXT_FLAG_EXPAND) == 0) {
@@ -24,12 +24,21 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void span_add(lv_coord_t x, lv_coord_t y, lv_color_t color);
+static void span_flush(void);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static lv_color_t letter_bg_color;
 
+/*Horizontal span of pixels not written to the display yet*/
+static lv_color_t span_buf[LV_REAL_DRAW_SPAN_BUF];
+static lv_coord_t span_x1;
+static lv_coord_t span_y;
+static uint16_t span_len;
+static bool span_same;          /*All pixels of the span have the same color, so it can be filled*/
+
 /**********************
  *      MACROS
  **********************/
@@ -39,7 +48,8 @@ static lv_color_t letter_bg_color;
  **********************/
 
 /**
- * Put a pixel to the display
+ * Put a pixel to the display. The neighbouring pixels are collected and written
+ * together when a pixel doesn't continue them or on `lv_rflush`.
  * @param x x coordinate of the pixel
  * @param y y coordinate of the pixel
  * @param mask_p the pixel will be drawn on this area
@@ -50,13 +60,14 @@ void lv_rpx(lv_coord_t x, lv_coord_t y, const lv_area_t * mask_p, lv_color_t col
 {
     (void)opa;      /*Opa is used only for compatibility with lv_vpx*/
 
-    lv_area_t area;
-    area.x1 = x;
-    area.y1 = y;
-    area.x2 = x;
-    area.y2 = y;
+    if(mask_p != NULL) {
+        if(x < mask_p->x1 || x > mask_p->x2 || y < mask_p->y1 || y > mask_p->y2) return;
+    } else {
+        if(x < 0 || x >= LV_HOR_RES || y < 0 || y >= LV_VER_RES) return;
+    }
 
-    lv_rfill(&area, mask_p, color, LV_OPA_COVER);
+    /*Collect the neighbouring pixels (e.g. anti-aliased edges) to write them at once*/
+    span_add(x, y, color);
 }
 
 /**
@@ -84,6 +95,7 @@ void lv_rfill(const lv_area_t * cords_p, const lv_area_t * mask_p,
     }
 
     if(union_ok != false) {
+        span_flush();       /*The pending pixels are drawn earlier so write them first*/
         lv_disp_fill(masked_area.x1, masked_area.y1, masked_area.x2, masked_area.y2, color);
     }
 }
@@ -173,8 +185,9 @@ void lv_rletter(const lv_point_t * pos_p, const lv_area_t * mask_p,
         mask = mask_init >> col_bit;
         for(col = col_start; col < col_end; col ++) {
             letter_px = (*map_p & mask) >> (8 - col_bit - bpp);
+            /*The rows and columns are already masked. The transparent pixels break the spans.*/
             if(letter_px != 0) {
-                lv_rpx(pos_p->x + col, pos_p->y + row, mask_p, lv_color_mix(color, letter_bg_color, bpp == 8 ? letter_px : bpp_opa_table[letter_px]), LV_OPA_COVER);
+                span_add(pos_p->x + col, pos_p->y + row, lv_color_mix(color, letter_bg_color, bpp == 8 ? letter_px : bpp_opa_table[letter_px]));
             }
 
             if(col_bit < 8 - bpp) {
@@ -234,6 +247,7 @@ void lv_rmap(const lv_area_t * cords_p, const lv_area_t * mask_p,
 
     lv_coord_t row;
     if(recolor_opa == LV_OPA_TRANSP && chroma_key == false) {
+        span_flush();
         lv_coord_t mask_w = lv_area_get_width(&masked_a) - 1;
         for(row = masked_a.y1; row <= masked_a.y2; row++) {
             lv_disp_map(masked_a.x1, row, masked_a.x1 + mask_w, row, (lv_color_t *)map_p);
@@ -251,9 +265,9 @@ void lv_rmap(const lv_area_t * cords_p, const lv_area_t * mask_p,
                 if(recolor_opa != LV_OPA_TRANSP) {
                     lv_color_t recolored_px = lv_color_mix(recolor, *px_color, recolor_opa);
 
-                    lv_rpx(col, row, mask_p, recolored_px, LV_OPA_COVER);
+                    span_add(col, row, recolored_px);
                 } else {
-                    lv_rpx(col, row, mask_p, *px_color, LV_OPA_COVER);
+                    span_add(col, row, *px_color);
                 }
 
             }
@@ -262,8 +276,55 @@ void lv_rmap(const lv_area_t * cords_p, const lv_area_t * mask_p,
     }
 }
 
+/**
+ * Write the pending pixels of `lv_rpx`, `lv_rletter` and `lv_rmap` to the display.
+ * Should be called when the drawing of an area is ready.
+ */
+void lv_rflush(void)
+{
+    span_flush();
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Add a pixel to the pending span. If it doesn't continue the span the span is written first.
+ * @param x x coordinate of the pixel (already masked)
+ * @param y y coordinate of the pixel (already masked)
+ * @param color color of the pixel
+ */
+static void span_add(lv_coord_t x, lv_coord_t y, lv_color_t color)
+{
+    if(span_len != 0 && (y != span_y || x != span_x1 + span_len || span_len >= LV_REAL_DRAW_SPAN_BUF)) {
+        span_flush();
+    }
+
+    if(span_len == 0) {
+        span_x1 = x;
+        span_y = y;
+        span_same = true;
+    } else if(span_same && span_buf[0].full != color.full) {
+        span_same = false;
+    }
+
+    span_buf[span_len] = color;
+    span_len++;
+}
+
+/**
+ * Write the pending span to the display. Spans with a single color are filled.
+ */
+static void span_flush(void)
+{
+    if(span_len == 0) return;
+
+    lv_coord_t x2 = span_x1 + span_len - 1;
+    if(span_same) lv_disp_fill(span_x1, span_y, x2, span_y, span_buf[0]);
+    else lv_disp_map(span_x1, span_y, x2, span_y, span_buf);
+
+    span_len = 0;
+}
+
 #endif  /*USE_LV_REAL_DRAW*/
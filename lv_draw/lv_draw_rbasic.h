@@ -37,6 +37,15 @@ extern "C" {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Put a pixel to the display. The neighbouring pixels are collected and written
+ * together when a pixel doesn't continue them or on `lv_rflush`.
+ * @param x x coordinate of the pixel
+ * @param y y coordinate of the pixel
+ * @param mask_p the pixel will be drawn on this area
+ * @param color color of the pixel
+ * @param opa opacity (ignored, only for compatibility with lv_vpx)
+ */
 void lv_rpx(lv_coord_t x, lv_coord_t y, const lv_area_t * mask_p, lv_color_t color, lv_opa_t opa);
 
 /**
@@ -83,6 +92,13 @@ void lv_rletter_set_background(lv_color_t color);
 void lv_rmap(const lv_area_t * cords_p, const lv_area_t * mask_p,
              const uint8_t * map_p, lv_opa_t opa, bool chroma_key, bool alpha_byte,
              lv_color_t recolor, lv_opa_t recolor_opa);
+
+/**
+ * Write the pending pixels of `lv_rpx`, `lv_rletter` and `lv_rmap` to the display.
+ * Should be called when the drawing of an area is ready.
+ */
+void lv_rflush(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -7,6 +7,9 @@
  *      INCLUDES
  *********************/
 #include "lv_draw_rect.h"
+#include "lv_draw_dl.h"
+#include "lv_draw_vbasic.h"
+#include "../lv_core/lv_quality.h"
 #include "../lv_misc/lv_circ.h"
 #include "../lv_misc/lv_math.h"
 
@@ -25,11 +28,17 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static void lv_draw_rect_main_mid(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale);
-static void lv_draw_rect_main_corner(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale);
+static void lv_draw_rect_main_mid(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale,
+                                  lv_draw_fill_func_t fill);
+static void lv_draw_rect_main_corner(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale,
+                                     lv_draw_fill_func_t fill, lv_draw_px_func_t px);
 static void lv_draw_rect_border_straight(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale);
 static void lv_draw_rect_border_corner(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale);
 
+#if USE_LV_GPU_2D && LV_VDB_SIZE
+static bool lv_draw_rect_main_acc(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale);
+#endif
+
 #if USE_LV_SHADOW && LV_VDB_SIZE
 static void lv_draw_shadow(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale);
 static void lv_draw_shadow_full(const lv_area_t * coords, const lv_area_t * mask, const  lv_style_t * style, lv_opa_t opa_scale);
@@ -64,18 +73,43 @@ static lv_opa_t antialias_get_opa_circ(lv_coord_t seg, lv_coord_t px_id, lv_opa_
  */
 void lv_draw_rect(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale)
 {
+#if LV_REFR_DISP_LIST
+    if(lv_draw_dl_is_rec()) {
+        lv_draw_dl_add_rect(coords, mask, style, opa_scale);
+        return;
+    }
+#endif
+
     if(lv_area_get_height(coords) < 1 || lv_area_get_width(coords) < 1) return;
 
+#if USE_LV_QUALITY_GOV
+    /*With reduced quality draw simple rectangles: no shadow and no (anti-aliased) rounded corners*/
+    static lv_style_t style_low;     /*Static to keep the stack usage of the drawing unchanged*/
+    if(lv_quality_get() == LV_QUALITY_LOW && (style->body.radius != 0 || style->body.shadow.width != 0)) {
+        lv_style_copy(&style_low, style);
+        style_low.body.radius = 0;
+        style_low.body.shadow.width = 0;
+        style = &style_low;
+    }
+#endif
+
 #if USE_LV_SHADOW && LV_VDB_SIZE
     if(style->body.shadow.width != 0) {
         lv_draw_shadow(coords, mask, style, opa_scale);
     }
 #endif
     if(style->body.empty == 0 && style->body.opa >= LV_OPA_MIN) {
-        lv_draw_rect_main_mid(coords, mask, style, opa_scale);
+#if USE_LV_GPU_2D && LV_VDB_SIZE
+        if(lv_draw_rect_main_acc(coords, mask, style, opa_scale)) {
+            /*Filled by the 2D accelerator*/
+        } else
+#endif
+        {
+            lv_draw_rect_main_mid(coords, mask, style, opa_scale, fill_fp);
 
-        if(style->body.radius != 0) {
-            lv_draw_rect_main_corner(coords, mask, style, opa_scale);
+            if(style->body.radius != 0) {
+                lv_draw_rect_main_corner(coords, mask, style, opa_scale, fill_fp, px_fp);
+            }
         }
     }
 
@@ -88,18 +122,71 @@ void lv_draw_rect(const lv_area_t * coords, const lv_area_t * mask, const lv_sty
     }
 }
 
+#if USE_LV_GPU_2D && LV_VDB_SIZE
+/**
+ * Fill the body of a rectangle with rounded corners and without gradient pixel by pixel the same way
+ * as `lv_draw_rect` does but with custom pixel and fill functions.
+ * Used by the software 2D accelerator to draw exactly the same corners as the normal drawing.
+ * @param coords the coordinates of the rectangle
+ * @param mask the rectangle will be drawn only on this area
+ * @param radius the radius of the corners (already corrected to the size of the rectangle)
+ * @param color color of the rectangle
+ * @param opa opacity of the rectangle
+ * @param fill function to fill an area (works like `fill_fp`)
+ * @param px function to draw a pixel (works like `px_fp`)
+ */
+void lv_draw_rect_body_round(const lv_area_t * coords, const lv_area_t * mask, lv_coord_t radius, lv_color_t color, lv_opa_t opa,
+                             lv_draw_fill_func_t fill, lv_draw_px_func_t px)
+{
+    /*`lv_draw_rect_main_acc` has corrected the radius with `lv_draw_cont_radius_corr`.
+     *Get a style radius which is corrected to the same value.*/
+    lv_style_t style;
+    lv_style_copy(&style, &lv_style_plain);
+    style.body.radius = radius + LV_ANTIALIAS;
+    if(style.body.radius == 0) style.body.radius = 1;
+    style.body.main_color = color;
+    style.body.grad_color = color;
+    style.body.opa = opa;
+
+    lv_draw_rect_main_mid(coords, mask, &style, LV_OPA_COVER, fill);
+    lv_draw_rect_main_corner(coords, mask, &style, LV_OPA_COVER, fill, px);
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+#if USE_LV_GPU_2D && LV_VDB_SIZE
+/**
+ * Fill the body of a rectangle with rounded corners and without gradient by the 2D accelerator of the display
+ * @param coords the coordinates of the original rectangle
+ * @param mask the rectangle will be drawn only  on this area
+ * @param style pointer to a rectangle style
+ * @param opa_scale scale down all opacities by the factor
+ * @return true: the body is drawn; false: the accelerator can't draw it
+ */
+static bool lv_draw_rect_main_acc(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale)
+{
+    if(style->body.radius == 0 || style->body.main_color.full != style->body.grad_color.full) return false;
+
+    lv_coord_t radius = lv_draw_cont_radius_corr(style->body.radius, lv_area_get_width(coords), lv_area_get_height(coords));
+    lv_opa_t opa = opa_scale == LV_OPA_COVER ? style->body.opa : (uint16_t)((uint16_t) style->body.opa * opa_scale) >> 8;
+
+    return lv_vfill_round(coords, mask, radius, style->body.main_color, opa);
+}
+#endif
+
 /**
  * Draw the middle part (rectangular) of a rectangle
  * @param coords the coordinates of the original rectangle
  * @param mask the rectangle will be drawn only  on this area
  * @param rects_p pointer to a rectangle style
  * @param opa_scale scale down all opacities by the factor
+ * @param fill function to fill the areas (`fill_fp` or a custom one)
  */
-static void lv_draw_rect_main_mid(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale)
+static void lv_draw_rect_main_mid(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale,
+                                  lv_draw_fill_func_t fill)
 {
     uint16_t radius = style->body.radius;
 
@@ -133,7 +220,7 @@ static void lv_draw_rect_main_mid(const lv_area_t * coords, const lv_area_t * ma
 #endif
         }
 
-        fill_fp(&work_area, mask, mcolor, opa);
+        fill(&work_area, mask, mcolor, opa);
     } else {
         lv_coord_t row;
         lv_coord_t row_start = coords->y1 + radius;
@@ -157,7 +244,7 @@ static void lv_draw_rect_main_mid(const lv_area_t * coords, const lv_area_t * ma
             mix = (uint32_t)((uint32_t)(coords->y2 - work_area.y1) * 255) / height;
             act_color = lv_color_mix(mcolor, gcolor, mix);
 
-            fill_fp(&work_area, mask, act_color, opa);
+            fill(&work_area, mask, act_color, opa);
         }
     }
 }
@@ -167,8 +254,11 @@ static void lv_draw_rect_main_mid(const lv_area_t * coords, const lv_area_t * ma
  * @param mask the rectangle will be drawn only  on this area
  * @param rects_p pointer to a rectangle style
  * @param opa_scale scale down all opacities by the factor
+ * @param fill function to fill the areas (`fill_fp` or a custom one)
+ * @param px function to draw the anti-aliased pixels (`px_fp` or a custom one)
  */
-static void lv_draw_rect_main_corner(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale)
+static void lv_draw_rect_main_corner(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale,
+                                     lv_draw_fill_func_t fill, lv_draw_px_func_t px)
 {
     uint16_t radius = style->body.radius;
 
@@ -263,19 +353,19 @@ static void lv_draw_rect_main_corner(const lv_area_t * coords, const lv_area_t *
                     aa_opa = opa - lv_draw_aa_get_opa(seg_size, i, opa);
                 }
 
-                px_fp(rb_origo.x + LV_CIRC_OCT2_X(aa_p) + i, rb_origo.y + LV_CIRC_OCT2_Y(aa_p) + 1, mask, aa_color_hor_bottom, aa_opa);
-                px_fp(lb_origo.x + LV_CIRC_OCT3_X(aa_p) - i, lb_origo.y + LV_CIRC_OCT3_Y(aa_p) + 1, mask, aa_color_hor_bottom, aa_opa);
-                px_fp(lt_origo.x + LV_CIRC_OCT6_X(aa_p) - i, lt_origo.y + LV_CIRC_OCT6_Y(aa_p) - 1, mask, aa_color_hor_top, aa_opa);
-                px_fp(rt_origo.x + LV_CIRC_OCT7_X(aa_p) + i, rt_origo.y + LV_CIRC_OCT7_Y(aa_p) - 1, mask, aa_color_hor_top, aa_opa);
+                px(rb_origo.x + LV_CIRC_OCT2_X(aa_p) + i, rb_origo.y + LV_CIRC_OCT2_Y(aa_p) + 1, mask, aa_color_hor_bottom, aa_opa);
+                px(lb_origo.x + LV_CIRC_OCT3_X(aa_p) - i, lb_origo.y + LV_CIRC_OCT3_Y(aa_p) + 1, mask, aa_color_hor_bottom, aa_opa);
+                px(lt_origo.x + LV_CIRC_OCT6_X(aa_p) - i, lt_origo.y + LV_CIRC_OCT6_Y(aa_p) - 1, mask, aa_color_hor_top, aa_opa);
+                px(rt_origo.x + LV_CIRC_OCT7_X(aa_p) + i, rt_origo.y + LV_CIRC_OCT7_Y(aa_p) - 1, mask, aa_color_hor_top, aa_opa);
 
                 mix = (uint32_t)((uint32_t)(radius - out_y_seg_start + i) * 255) / height;
                 aa_color_ver = lv_color_mix(mcolor, gcolor, mix);
-                px_fp(rb_origo.x + LV_CIRC_OCT1_X(aa_p) + 1, rb_origo.y + LV_CIRC_OCT1_Y(aa_p) + i, mask, aa_color_ver, aa_opa);
-                px_fp(lb_origo.x + LV_CIRC_OCT4_X(aa_p) - 1, lb_origo.y + LV_CIRC_OCT4_Y(aa_p) + i, mask, aa_color_ver, aa_opa);
+                px(rb_origo.x + LV_CIRC_OCT1_X(aa_p) + 1, rb_origo.y + LV_CIRC_OCT1_Y(aa_p) + i, mask, aa_color_ver, aa_opa);
+                px(lb_origo.x + LV_CIRC_OCT4_X(aa_p) - 1, lb_origo.y + LV_CIRC_OCT4_Y(aa_p) + i, mask, aa_color_ver, aa_opa);
 
                 aa_color_ver = lv_color_mix(gcolor, mcolor, mix);
-                px_fp(lt_origo.x + LV_CIRC_OCT5_X(aa_p) - 1, lt_origo.y + LV_CIRC_OCT5_Y(aa_p) - i, mask, aa_color_ver, aa_opa);
-                px_fp(rt_origo.x + LV_CIRC_OCT8_X(aa_p) + 1, rt_origo.y + LV_CIRC_OCT8_Y(aa_p) - i, mask, aa_color_ver, aa_opa);
+                px(lt_origo.x + LV_CIRC_OCT5_X(aa_p) - 1, lt_origo.y + LV_CIRC_OCT5_Y(aa_p) - i, mask, aa_color_ver, aa_opa);
+                px(rt_origo.x + LV_CIRC_OCT8_X(aa_p) + 1, rt_origo.y + LV_CIRC_OCT8_Y(aa_p) - i, mask, aa_color_ver, aa_opa);
             }
 
             out_x_last = cir.x;
@@ -304,7 +394,7 @@ static void lv_draw_rect_main_corner(const lv_area_t * coords, const lv_area_t *
                 mix = (uint32_t)((uint32_t)(coords->y2 - edge_top_area.y1)  * 255) / height;
                 act_color = lv_color_mix(mcolor, gcolor, mix);
             }
-            fill_fp(&edge_top_area, mask, act_color, opa);
+            fill(&edge_top_area, mask, act_color, opa);
         }
 
         if(mid_top_refr != 0) {
@@ -313,7 +403,7 @@ static void lv_draw_rect_main_corner(const lv_area_t * coords, const lv_area_t *
                 mix = (uint32_t)((uint32_t)(coords->y2 - mid_top_area.y1) * 255) / height;
                 act_color = lv_color_mix(mcolor, gcolor, mix);
             }
-            fill_fp(&mid_top_area, mask, act_color, opa);
+            fill(&mid_top_area, mask, act_color, opa);
         }
 
         if(mid_bot_refr != 0) {
@@ -322,7 +412,7 @@ static void lv_draw_rect_main_corner(const lv_area_t * coords, const lv_area_t *
                 mix = (uint32_t)((uint32_t)(coords->y2 - mid_bot_area.y1) * 255) / height;
                 act_color = lv_color_mix(mcolor, gcolor, mix);
             }
-            fill_fp(&mid_bot_area, mask, act_color, opa);
+            fill(&mid_bot_area, mask, act_color, opa);
         }
 
         if(edge_bot_refr != 0) {
@@ -332,7 +422,7 @@ static void lv_draw_rect_main_corner(const lv_area_t * coords, const lv_area_t *
                 mix = (uint32_t)((uint32_t)(coords->y2 - edge_bot_area.y1) * 255) / height;
                 act_color = lv_color_mix(mcolor, gcolor, mix);
             }
-            fill_fp(&edge_bot_area, mask, act_color, opa);
+            fill(&edge_bot_area, mask, act_color, opa);
         }
 
         /*Save the current coordinates*/
@@ -364,7 +454,7 @@ static void lv_draw_rect_main_corner(const lv_area_t * coords, const lv_area_t *
         mix = (uint32_t)((uint32_t)(coords->y2 - edge_top_area.y1)  * 255) / height;
         act_color = lv_color_mix(mcolor, gcolor, mix);
     }
-    fill_fp(&edge_top_area, mask, act_color, opa);
+    fill(&edge_top_area, mask, act_color, opa);
 
     if(edge_top_area.y1 != mid_top_area.y1) {
 
@@ -373,7 +463,7 @@ static void lv_draw_rect_main_corner(const lv_area_t * coords, const lv_area_t *
             mix = (uint32_t)((uint32_t)(coords->y2 - mid_top_area.y1) * 255) / height;
             act_color = lv_color_mix(mcolor, gcolor, mix);
         }
-        fill_fp(&mid_top_area, mask, act_color, opa);
+        fill(&mid_top_area, mask, act_color, opa);
     }
 
     if(mcolor.full == gcolor.full) act_color = mcolor;
@@ -381,7 +471,7 @@ static void lv_draw_rect_main_corner(const lv_area_t * coords, const lv_area_t *
         mix = (uint32_t)((uint32_t)(coords->y2 - mid_bot_area.y1) * 255) / height;
         act_color = lv_color_mix(mcolor, gcolor, mix);
     }
-    fill_fp(&mid_bot_area, mask, act_color, opa);
+    fill(&mid_bot_area, mask, act_color, opa);
 
     if(edge_bot_area.y1 != mid_bot_area.y1) {
 
@@ -390,7 +480,7 @@ static void lv_draw_rect_main_corner(const lv_area_t * coords, const lv_area_t *
             mix = (uint32_t)((uint32_t)(coords->y2 - edge_bot_area.y1) * 255) / height;
             act_color = lv_color_mix(mcolor, gcolor, mix);
         }
-        fill_fp(&edge_bot_area, mask, act_color, opa);
+        fill(&edge_bot_area, mask, act_color, opa);
     }
 
 
@@ -400,11 +490,11 @@ static void lv_draw_rect_main_corner(const lv_area_t * coords, const lv_area_t *
     edge_top_area.x2 = coords->x2 - radius - 2;
     edge_top_area.y1 = coords->y1;
     edge_top_area.y2 = coords->y1;
-    fill_fp(&edge_top_area, mask, style->body.main_color, opa);
+    fill(&edge_top_area, mask, style->body.main_color, opa);
 
     edge_top_area.y1 = coords->y2;
     edge_top_area.y2 = coords->y2;
-    fill_fp(&edge_top_area, mask, style->body.grad_color, opa);
+    fill(&edge_top_area, mask, style->body.grad_color, opa);
 
     /*Last parts of the anti-alias*/
     out_y_seg_end = cir.y;
@@ -421,19 +511,19 @@ static void lv_draw_rect_main_corner(const lv_area_t * coords, const lv_area_t *
     lv_coord_t i;
     for(i = 0; i  < seg_size; i++) {
         lv_opa_t aa_opa = opa - lv_draw_aa_get_opa(seg_size, i, opa);
-        px_fp(rb_origo.x + LV_CIRC_OCT2_X(aa_p) + i, rb_origo.y + LV_CIRC_OCT2_Y(aa_p) + 1, mask, aa_color_hor_top, aa_opa);
-        px_fp(lb_origo.x + LV_CIRC_OCT3_X(aa_p) - i, lb_origo.y + LV_CIRC_OCT3_Y(aa_p) + 1, mask, aa_color_hor_top, aa_opa);
-        px_fp(lt_origo.x + LV_CIRC_OCT6_X(aa_p) - i, lt_origo.y + LV_CIRC_OCT6_Y(aa_p) - 1, mask, aa_color_hor_bottom, aa_opa);
-        px_fp(rt_origo.x + LV_CIRC_OCT7_X(aa_p) + i, rt_origo.y + LV_CIRC_OCT7_Y(aa_p) - 1, mask, aa_color_hor_bottom, aa_opa);
+        px(rb_origo.x + LV_CIRC_OCT2_X(aa_p) + i, rb_origo.y + LV_CIRC_OCT2_Y(aa_p) + 1, mask, aa_color_hor_top, aa_opa);
+        px(lb_origo.x + LV_CIRC_OCT3_X(aa_p) - i, lb_origo.y + LV_CIRC_OCT3_Y(aa_p) + 1, mask, aa_color_hor_top, aa_opa);
+        px(lt_origo.x + LV_CIRC_OCT6_X(aa_p) - i, lt_origo.y + LV_CIRC_OCT6_Y(aa_p) - 1, mask, aa_color_hor_bottom, aa_opa);
+        px(rt_origo.x + LV_CIRC_OCT7_X(aa_p) + i, rt_origo.y + LV_CIRC_OCT7_Y(aa_p) - 1, mask, aa_color_hor_bottom, aa_opa);
 
         mix = (uint32_t)((uint32_t)(radius - out_y_seg_start + i) * 255) / height;
         aa_color_ver = lv_color_mix(mcolor, gcolor, mix);
-        px_fp(rb_origo.x + LV_CIRC_OCT1_X(aa_p) + 1, rb_origo.y + LV_CIRC_OCT1_Y(aa_p) + i, mask, aa_color_ver, aa_opa);
-        px_fp(lb_origo.x + LV_CIRC_OCT4_X(aa_p) - 1, lb_origo.y + LV_CIRC_OCT4_Y(aa_p) + i, mask, aa_color_ver, aa_opa);
+        px(rb_origo.x + LV_CIRC_OCT1_X(aa_p) + 1, rb_origo.y + LV_CIRC_OCT1_Y(aa_p) + i, mask, aa_color_ver, aa_opa);
+        px(lb_origo.x + LV_CIRC_OCT4_X(aa_p) - 1, lb_origo.y + LV_CIRC_OCT4_Y(aa_p) + i, mask, aa_color_ver, aa_opa);
 
         aa_color_ver = lv_color_mix(gcolor, mcolor, mix);
-        px_fp(lt_origo.x + LV_CIRC_OCT5_X(aa_p) - 1, lt_origo.y + LV_CIRC_OCT5_Y(aa_p) - i, mask, aa_color_ver, aa_opa);
-        px_fp(rt_origo.x + LV_CIRC_OCT8_X(aa_p) + 1, rt_origo.y + LV_CIRC_OCT8_Y(aa_p) - i, mask, aa_color_ver, aa_opa);
+        px(lt_origo.x + LV_CIRC_OCT5_X(aa_p) - 1, lt_origo.y + LV_CIRC_OCT5_Y(aa_p) - i, mask, aa_color_ver, aa_opa);
+        px(rt_origo.x + LV_CIRC_OCT8_X(aa_p) + 1, rt_origo.y + LV_CIRC_OCT8_Y(aa_p) - i, mask, aa_color_ver, aa_opa);
     }
 
     /*In some cases the last pixel is not drawn*/
@@ -446,10 +536,10 @@ static void lv_draw_rect_main_corner(const lv_area_t * coords, const lv_area_t *
         aa_color_hor_bottom = lv_color_mix(mcolor, gcolor, mix);
 
         lv_opa_t aa_opa = opa >> 1;
-        px_fp(rb_origo.x + LV_CIRC_OCT2_X(aa_p), rb_origo.y + LV_CIRC_OCT2_Y(aa_p), mask, aa_color_hor_bottom, aa_opa);
-        px_fp(lb_origo.x + LV_CIRC_OCT4_X(aa_p), lb_origo.y + LV_CIRC_OCT4_Y(aa_p), mask, aa_color_hor_bottom, aa_opa);
-        px_fp(lt_origo.x + LV_CIRC_OCT6_X(aa_p), lt_origo.y + LV_CIRC_OCT6_Y(aa_p), mask, aa_color_hor_top, aa_opa);
-        px_fp(rt_origo.x + LV_CIRC_OCT8_X(aa_p), rt_origo.y + LV_CIRC_OCT8_Y(aa_p), mask, aa_color_hor_top, aa_opa);
+        px(rb_origo.x + LV_CIRC_OCT2_X(aa_p), rb_origo.y + LV_CIRC_OCT2_Y(aa_p), mask, aa_color_hor_bottom, aa_opa);
+        px(lb_origo.x + LV_CIRC_OCT4_X(aa_p), lb_origo.y + LV_CIRC_OCT4_Y(aa_p), mask, aa_color_hor_bottom, aa_opa);
+        px(lt_origo.x + LV_CIRC_OCT6_X(aa_p), lt_origo.y + LV_CIRC_OCT6_Y(aa_p), mask, aa_color_hor_top, aa_opa);
+        px(rt_origo.x + LV_CIRC_OCT8_X(aa_p), rt_origo.y + LV_CIRC_OCT8_Y(aa_p), mask, aa_color_hor_top, aa_opa);
     }
 
 #endif
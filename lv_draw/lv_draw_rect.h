@@ -36,6 +36,22 @@ extern "C" {
  */
 void lv_draw_rect(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale);
 
+#if USE_LV_GPU_2D && LV_VDB_SIZE
+/**
+ * Fill the body of a rectangle with rounded corners and without gradient the same way as `lv_draw_rect`
+ * does but with custom pixel and fill functions. Used by the software 2D accelerator.
+ * @param coords the coordinates of the rectangle
+ * @param mask the rectangle will be drawn only on this area
+ * @param radius the radius of the corners (already corrected to the size of the rectangle)
+ * @param color color of the rectangle
+ * @param opa opacity of the rectangle
+ * @param fill function to fill an area (works like `fill_fp`)
+ * @param px function to draw a pixel (works like `px_fp`)
+ */
+void lv_draw_rect_body_round(const lv_area_t * coords, const lv_area_t * mask, lv_coord_t radius, lv_color_t color, lv_opa_t opa,
+                             lv_draw_fill_func_t fill, lv_draw_px_func_t px);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_draw_triangle.h"
+#include "lv_draw_dl.h"
 #include "../lv_misc/lv_math.h"
 
 /*********************
@@ -42,6 +43,13 @@ static void point_swap(lv_point_t * p1, lv_point_t * p2);
  */
 void lv_draw_triangle(const lv_point_t * points, const lv_area_t * mask, lv_color_t color)
 {
+#if LV_REFR_DISP_LIST
+    if(lv_draw_dl_is_rec()) {
+        lv_draw_dl_add_triangle(points, mask, color);
+        return;
+    }
+#endif
+
     lv_point_t tri[3];
 
     memcpy(tri, points, sizeof(tri));
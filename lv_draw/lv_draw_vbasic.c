@@ -20,6 +20,7 @@
 #include <stddef.h>
 #include "../lv_core/lv_vdb.h"
 #include "lv_draw.h"
+#include "lv_draw_vpacked.h"
 
 /*********************
  *      INCLUDES
@@ -44,6 +45,11 @@
 static void sw_mem_blend(lv_color_t * dest, const lv_color_t * src, uint32_t length, lv_opa_t opa);
 static void sw_color_fill(lv_area_t * mem_area, lv_color_t * mem, const lv_area_t * fill_area, lv_color_t color, lv_opa_t opa);
 
+#if USE_LV_GPU_2D
+static const lv_acc_t * acc_get(lv_acc_cap_t caps);
+static void acc_buf_init(lv_acc_buf_t * dest, lv_vdb_t * vdb_p, const lv_area_t * rel_a);
+#endif
+
 #if LV_COLOR_SCREEN_TRANSP
 static inline lv_color_t color_mix_2_alpha(lv_color_t bg_color, lv_opa_t bg_opa, lv_color_t fg_color, lv_opa_t fg_opa);
 #endif
@@ -95,6 +101,9 @@ void lv_vpx(lv_coord_t x, lv_coord_t y, const lv_area_t * mask_p, lv_color_t col
     if(disp->driver.vdb_wr) {
         disp->driver.vdb_wr((uint8_t *)vdb_p->buf, vdb_width, x, y, color, opa);
     } else {
+#if LV_VDB_PACKED
+        lv_vpacked_px(vdb_p, x, y, color, opa);
+#else
         lv_color_t * vdb_px_p = vdb_p->buf + y * vdb_width + x;
 #if LV_COLOR_SCREEN_TRANSP == 0
         if(opa == LV_OPA_COVER) {
@@ -105,6 +114,7 @@ void lv_vpx(lv_coord_t x, lv_coord_t y, const lv_area_t * mask_p, lv_color_t col
 #else
         *vdb_px_p = color_mix_2_alpha(*vdb_px_p, (*vdb_px_p).alpha, color, opa);
 #endif
+#endif /*LV_VDB_PACKED*/
     }
 }
 
@@ -144,6 +154,23 @@ void lv_vfill(const lv_area_t * cords_p, const lv_area_t * mask_p,
     vdb_rel_a.x2 = res_a.x2 - vdb_p->area.x1;
     vdb_rel_a.y2 = res_a.y2 - vdb_p->area.y1;
 
+#if LV_VDB_PACKED
+    if(lv_disp_get_active()->driver.vdb_wr == NULL) {
+        lv_vpacked_fill(vdb_p, &vdb_rel_a, color, opa);
+        return;
+    }
+#endif
+
+#if USE_LV_GPU_2D
+    const lv_acc_t * acc = acc_get(opa == LV_OPA_COVER ? LV_ACC_CAP_FILL : LV_ACC_CAP_FILL_OPA);
+    if(acc && lv_area_get_size(&vdb_rel_a) >= acc->fill_min_px) {
+        lv_acc_buf_t dest;
+        acc_buf_init(&dest, vdb_p, &vdb_rel_a);
+        acc->fill(&dest, color, opa);
+        return;
+    }
+#endif
+
     lv_color_t * vdb_buf_tmp = vdb_p->buf;
     uint32_t vdb_width = lv_area_get_width(&vdb_p->area);
     /*Move the vdb_tmp to the first row*/
@@ -302,6 +329,15 @@ void lv_vletter(const lv_point_t * pos_p, const lv_area_t * mask_p,
         return;
     }
 
+    lv_disp_t * disp = lv_disp_get_active();
+
+#if LV_VDB_PACKED
+    if(disp->driver.vdb_wr == NULL) {
+        lv_vpacked_letter(vdb_p, pos_x, pos_y, mask_p, map_p, letter_w, letter_h, bpp, bpp_opa_table, color, opa);
+        return;
+    }
+#endif
+
     lv_coord_t vdb_width = lv_area_get_width(&vdb_p->area);
     lv_color_t * vdb_buf_tmp = vdb_p->buf;
     lv_coord_t col, row;
@@ -318,6 +354,24 @@ void lv_vletter(const lv_point_t * pos_p, const lv_area_t * mask_p,
     lv_coord_t row_start = pos_y >= mask_p->y1 ? 0 : mask_p->y1 - pos_y;
     lv_coord_t row_end  = pos_y + letter_h <= mask_p->y2 ? letter_h : mask_p->y2 - pos_y + 1;
 
+#if USE_LV_GPU_2D
+    const lv_acc_t * acc = acc_get(lv_acc_mask_caps(bpp));
+    if(acc && (uint32_t)(col_end - col_start) * (row_end - row_start) >= acc->mask_min_px) {
+        if(col_end <= col_start || row_end <= row_start) return;
+
+        lv_area_t rel_a;
+        rel_a.x1 = pos_x + col_start - vdb_p->area.x1;
+        rel_a.y1 = pos_y + row_start - vdb_p->area.y1;
+        rel_a.x2 = pos_x + col_end - 1 - vdb_p->area.x1;
+        rel_a.y2 = pos_y + row_end - 1 - vdb_p->area.y1;
+
+        lv_acc_buf_t dest;
+        acc_buf_init(&dest, vdb_p, &rel_a);
+        acc->mask(&dest, map_p + row_start * width_byte_bpp, width_byte_bpp, col_start, bpp, color, opa);
+        return;
+    }
+#endif
+
     /*Set a pointer on VDB to the first pixel of the letter*/
     vdb_buf_tmp += ((pos_y - vdb_p->area.y1) * vdb_width)
                    + pos_x - vdb_p->area.x1;
@@ -328,8 +382,6 @@ void lv_vletter(const lv_point_t * pos_p, const lv_area_t * mask_p,
     /*Move on the map too*/
     map_p += (row_start * width_byte_bpp) + ((col_start * bpp) >> 3);
 
-    lv_disp_t * disp = lv_disp_get_active();
-
     uint8_t letter_px;
     lv_opa_t px_opa;
     for(row = row_start; row < row_end; row ++) {
@@ -431,6 +483,30 @@ void lv_vmap(const lv_area_t * cords_p, const lv_area_t * mask_p,
     masked_a.x2 = masked_a.x2 - vdb_p->area.x1;
     masked_a.y2 = masked_a.y2 - vdb_p->area.y1;
 
+#if LV_VDB_PACKED
+    if(lv_disp_get_active()->driver.vdb_wr == NULL) {
+        lv_vpacked_map(vdb_p, &masked_a, map_p, map_width, chroma_key, alpha_byte, recolor, recolor_opa, opa);
+        return;
+    }
+#endif
+
+#if USE_LV_GPU_2D
+    lv_acc_blit_dsc_t blit_dsc;
+    blit_dsc.opa = opa;
+    blit_dsc.recolor = recolor;
+    blit_dsc.recolor_opa = recolor_opa;
+    blit_dsc.alpha_byte = alpha_byte ? 1 : 0;
+    blit_dsc.chroma_key = chroma_key ? 1 : 0;
+
+    const lv_acc_t * acc = acc_get(lv_acc_blit_caps(&blit_dsc));
+    if(acc && lv_area_get_size(&masked_a) >= acc->blit_min_px) {
+        lv_acc_buf_t dest;
+        acc_buf_init(&dest, vdb_p, &masked_a);
+        acc->blit(&dest, map_p, (uint32_t)map_width * px_size_byte, &blit_dsc);
+        return;
+    }
+#endif
+
     lv_coord_t vdb_width = lv_area_get_width(&vdb_p->area);
     lv_color_t * vdb_buf_tmp = vdb_p->buf;
     vdb_buf_tmp += (uint32_t) vdb_width * masked_a.y1; /*Move to the first row*/
@@ -492,7 +568,7 @@ void lv_vmap(const lv_area_t * cords_p, const lv_area_t * mask_p,
 #elif LV_COLOR_DEPTH == 16
                     /*Because of Alpha byte 16 bit color can start on odd address which can cause crash*/
                     px_color.full = px_color_p[0] + (px_color_p[1] << 8);
-#elif LV_COLOR_DEPTH == 32
+#elif LV_COLOR_DEPTH == 24 || LV_COLOR_DEPTH == 32
                     px_color = *((lv_color_t *)px_color_p);
 #endif
                     lv_opa_t px_opa = *(px_color_p + LV_IMG_PX_SIZE_ALPHA_BYTE - 1);
@@ -545,10 +621,99 @@ void lv_vmap(const lv_area_t * cords_p, const lv_area_t * mask_p,
     }
 }
 
+#if USE_LV_GPU_2D
+/**
+ * Fill a rectangle with rounded corners in the Virtual Display Buffer using the 2D accelerator of the display
+ * @param cords_p coordinates of the rectangle
+ * @param mask_p fill only on this mask (truncated to VDB area)
+ * @param radius radius of the corners
+ * @param color fill color
+ * @param opa opacity of the area (0..255)
+ * @return true: ready; false: the accelerator can't fill it, draw it in an other way
+ */
+bool lv_vfill_round(const lv_area_t * cords_p, const lv_area_t * mask_p, lv_coord_t radius,
+                    lv_color_t color, lv_opa_t opa)
+{
+    const lv_acc_t * acc = acc_get(LV_ACC_CAP_FILL_ROUND);
+    if(acc == NULL) return false;
+
+    if(opa < LV_OPA_MIN) return true;
+    if(opa > LV_OPA_MAX) opa = LV_OPA_COVER;
+
+    lv_vdb_t * vdb_p = lv_vdb_get();
+    if(!vdb_p) {
+        LV_LOG_WARN("Invalid VDB pointer");
+        return true;
+    }
+
+    lv_area_t res_a;
+    if(lv_area_intersect(&res_a, cords_p, mask_p) == false) return true;
+    if(lv_area_get_size(&res_a) < acc->fill_round_min_px) return false;
+
+    /*The rectangle relative to the filled window*/
+    lv_area_t rect;
+    rect.x1 = cords_p->x1 - res_a.x1;
+    rect.y1 = cords_p->y1 - res_a.y1;
+    rect.x2 = cords_p->x2 - res_a.x1;
+    rect.y2 = cords_p->y2 - res_a.y1;
+
+    lv_area_t vdb_rel_a;
+    vdb_rel_a.x1 = res_a.x1 - vdb_p->area.x1;
+    vdb_rel_a.y1 = res_a.y1 - vdb_p->area.y1;
+    vdb_rel_a.x2 = res_a.x2 - vdb_p->area.x1;
+    vdb_rel_a.y2 = res_a.y2 - vdb_p->area.y1;
+
+    lv_acc_buf_t dest;
+    acc_buf_init(&dest, vdb_p, &vdb_rel_a);
+    acc->fill_round(&dest, &rect, radius, color, opa);
+
+    return true;
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+#if USE_LV_GPU_2D
+/**
+ * Get the 2D accelerator of the active display if it can be used with the given capabilities
+ * @param caps required `LV_ACC_CAP_...` flags
+ * @return pointer to the accelerator or NULL if it can't be used
+ */
+static const lv_acc_t * acc_get(lv_acc_cap_t caps)
+{
+#if LV_VDB_PACKED
+    (void)caps;
+    return NULL;        /*The accelerators draw `lv_color_t` pixels*/
+#else
+    lv_disp_t * disp = lv_disp_get_active();
+    if(disp == NULL || disp->driver.acc == NULL || disp->driver.vdb_wr != NULL) return NULL;
+
+    const lv_acc_t * acc = disp->driver.acc;
+    if(caps == 0 || (acc->caps & caps) != caps) return NULL;
+
+    return acc;
+#endif
+}
+
+/**
+ * Initialize an accelerator window on the VDB
+ * @param dest pointer to the window to initialize
+ * @param vdb_p pointer to the VDB
+ * @param rel_a area of the window relative to the VDB
+ */
+static void acc_buf_init(lv_acc_buf_t * dest, lv_vdb_t * vdb_p, const lv_area_t * rel_a)
+{
+    lv_coord_t vdb_width = lv_area_get_width(&vdb_p->area);
+
+    dest->buf = vdb_p->buf + (uint32_t)vdb_width * rel_a->y1 + rel_a->x1;
+    dest->stride = vdb_width;
+    dest->w = lv_area_get_width(rel_a);
+    dest->h = lv_area_get_height(rel_a);
+}
+#endif
+
 /**
  * Blend pixels to destination memory using opacity
  * @param dest a memory address. Copy 'src' here.
@@ -76,6 +76,20 @@ void lv_vmap(const lv_area_t * cords_p, const lv_area_t * mask_p,
              const uint8_t * map_p, lv_opa_t opa, bool chroma_key, bool alpha_byte,
              lv_color_t recolor, lv_opa_t recolor_opa);
 
+#if USE_LV_GPU_2D
+/**
+ * Fill a rectangle with rounded corners in the Virtual Display Buffer using the 2D accelerator of the display
+ * @param cords_p coordinates of the rectangle
+ * @param mask_p fill only on this mask (truncated to VDB area)
+ * @param radius radius of the corners
+ * @param color fill color
+ * @param opa opacity of the area (0..255)
+ * @return true: ready; false: the accelerator can't fill it, draw it in an other way
+ */
+bool lv_vfill_round(const lv_area_t * cords_p, const lv_area_t * mask_p, lv_coord_t radius,
+                    lv_color_t color, lv_opa_t opa);
+#endif
+
 /**********************
  *      MACROS
  **********************/
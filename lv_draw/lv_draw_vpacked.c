@@ -0,0 +1,451 @@
+/**
+ * @file lv_draw_vpacked.c
+ * Drawing into a VDB with packed 1, 2 or 4 bit grayscale pixels
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_vpacked.h"
+
+#if LV_VDB_SIZE != 0 && LV_VDB_PACKED
+
+#include <string.h>
+#include "lv_draw.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define PX_PER_BYTE     (8 / LV_VDB_PX_BPP)
+#define PX_MAX          ((1 << LV_VDB_PX_BPP) - 1)          /*The level of white*/
+#define PX_PATTERN(l)   ((l) * (0xFF / PX_MAX))             /*A byte with all pixels set to a level*/
+#define ROW_BYTES(w)    (((w) * LV_VDB_PX_BPP + 7) >> 3)    /*Size of a row in horizontal layout*/
+
+#if LV_VDB_PX_MSB_FIRST
+#define PX_SHIFT(pos)   (8 - LV_VDB_PX_BPP * ((pos) + 1))
+#else
+#define PX_SHIFT(pos)   (LV_VDB_PX_BPP * (pos))
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Points to a pixel in the VDB*/
+typedef struct {
+    uint8_t * byte;
+    uint8_t shift;
+} px_ptr_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void fill_cover(const lv_vdb_t * vdb, const lv_area_t * fill_area, uint8_t level);
+static uint8_t pos_mask(uint8_t pos1, uint8_t pos2);
+static inline px_ptr_t px_ptr(const lv_vdb_t * vdb, lv_coord_t x, lv_coord_t y);
+static inline void px_next(px_ptr_t * p);
+static inline uint8_t px_get(px_ptr_t p);
+static inline void px_set(px_ptr_t p, uint8_t level);
+static inline uint8_t color_to_level(lv_color_t color);
+static inline uint8_t level_mix(uint8_t fg, uint8_t bg, lv_opa_t opa);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Get how many rows of an area fit into the VDB. The rows (or pages) start on a byte boundary.
+ * @param w width of the area
+ * @return number of rows
+ */
+lv_coord_t lv_vpacked_get_max_row(lv_coord_t w)
+{
+#if LV_VDB_PX_VERTICAL
+    return ((LV_VDB_SIZE_IN_BYTES) / w) * PX_PER_BYTE;
+#else
+    return (LV_VDB_SIZE_IN_BYTES) / ROW_BYTES(w);
+#endif
+}
+
+/**
+ * Put a pixel into a packed VDB
+ * @param vdb pointer to a VDB
+ * @param x x coordinate relative to the VDB
+ * @param y y coordinate relative to the VDB
+ * @param color pixel color
+ * @param opa opacity of the pixel
+ */
+void lv_vpacked_px(lv_vdb_t * vdb, lv_coord_t x, lv_coord_t y, lv_color_t color, lv_opa_t opa)
+{
+    px_ptr_t p = px_ptr(vdb, x, y);
+    px_set(p, level_mix(color_to_level(color), px_get(p), opa));
+}
+
+/**
+ * Fill an area of a packed VDB
+ * @param vdb pointer to a VDB
+ * @param fill_area the area to fill relative to the VDB
+ * @param color fill color
+ * @param opa opacity of the area
+ */
+void lv_vpacked_fill(lv_vdb_t * vdb, const lv_area_t * fill_area, lv_color_t color, lv_opa_t opa)
+{
+    uint8_t level = color_to_level(color);
+
+    if(opa != LV_OPA_COVER) {
+        /*There are only a few levels so mix the color with all of them in advance*/
+        uint8_t mix_lut[PX_MAX + 1];
+        bool same = true;
+        bool unchanged = true;
+        uint8_t bg;
+        for(bg = 0; bg <= PX_MAX; bg++) {
+            mix_lut[bg] = level_mix(level, bg, opa);
+            if(mix_lut[bg] != mix_lut[0]) same = false;
+            if(mix_lut[bg] != bg) unchanged = false;
+        }
+
+        /*The opacity is too low to change any level*/
+        if(unchanged) return;
+
+        /*If the result doesn't depend on the background simply fill with it*/
+        if(same) {
+            level = mix_lut[0];
+        } else {
+            lv_coord_t x;
+            lv_coord_t y;
+            for(y = fill_area->y1; y <= fill_area->y2; y++) {
+                px_ptr_t p = px_ptr(vdb, fill_area->x1, y);
+                for(x = fill_area->x1; x <= fill_area->x2; x++) {
+                    px_set(p, mix_lut[px_get(p)]);
+                    px_next(&p);
+                }
+            }
+            return;
+        }
+    }
+
+    fill_cover(vdb, fill_area, level);
+}
+
+/**
+ * Draw a letter into a packed VDB
+ * @param vdb pointer to a VDB
+ * @param pos_x x coordinate of the letter
+ * @param pos_y y coordinate of the letter
+ * @param mask_p the letter will be drawn only on this area (truncated to VDB area)
+ * @param map_p bitmap of the letter
+ * @param letter_w width of the letter
+ * @param letter_h height of the letter
+ * @param bpp bit per pixel of the bitmap (1, 2, 4 or 8)
+ * @param bpp_opa_table convert the pixel values of the bitmap to opacity. NULL with 8 bpp
+ * @param color color of letter
+ * @param opa opacity of letter
+ */
+void lv_vpacked_letter(lv_vdb_t * vdb, lv_coord_t pos_x, lv_coord_t pos_y, const lv_area_t * mask_p,
+                       const uint8_t * map_p, lv_coord_t letter_w, lv_coord_t letter_h,
+                       uint8_t bpp, const uint8_t * bpp_opa_table, lv_color_t color, lv_opa_t opa)
+{
+    /* Calculate the col/row start/end on the map*/
+    lv_coord_t col_start = pos_x >= mask_p->x1 ? 0 : mask_p->x1 - pos_x;
+    lv_coord_t col_end = pos_x + letter_w <= mask_p->x2 ? letter_w : mask_p->x2 - pos_x + 1;
+    lv_coord_t row_start = pos_y >= mask_p->y1 ? 0 : mask_p->y1 - pos_y;
+    lv_coord_t row_end  = pos_y + letter_h <= mask_p->y2 ? letter_h : mask_p->y2 - pos_y + 1;
+    if(col_start >= col_end || row_start >= row_end) return;
+
+    uint16_t width_byte_bpp = (letter_w * bpp + 7) >> 3;    /*Letter width in byte. Real width in the font*/
+    uint8_t level = color_to_level(color);
+    lv_coord_t x_ofs = pos_x - vdb->area.x1;                /*Position of the letter relative to the VDB*/
+    lv_coord_t y_ofs = pos_y - vdb->area.y1;
+    lv_coord_t row;
+
+    /*Opacity of the values of the letter's pixels*/
+    uint8_t opa_lut[16];
+    if(bpp != 8) {
+        uint8_t v;
+        for(v = 0; v < (1 << bpp); v++) {
+            opa_lut[v] = opa == LV_OPA_COVER ? bpp_opa_table[v] : (uint16_t)((uint16_t)bpp_opa_table[v] * opa) >> 8;
+        }
+    }
+
+#if LV_VDB_PX_BPP == 1 && LV_VDB_PX_VERTICAL == 0 && LV_VDB_PX_MSB_FIRST
+    /*1 bit letter to 1 bit VDB: the bytes of the letter can be written directly*/
+    if(bpp == 1) {
+        bool set = level_mix(level, 0, opa_lut[1]) != 0;    /*Black pixels become white*/
+        bool clr = level_mix(level, 1, opa_lut[1]) == 0;    /*White pixels become black*/
+        if(set == false && clr == false) return;
+
+        uint32_t row_bytes = ROW_BYTES(lv_area_get_width(&vdb->area));
+        lv_coord_t i_start = col_start >> 3;
+        lv_coord_t i_end = (col_end - 1) >> 3;
+        lv_coord_t i;
+        for(row = row_start; row < row_end; row++) {
+            const uint8_t * map_row = map_p + (uint32_t)row * width_byte_bpp;
+            uint8_t * vdb_row = (uint8_t *)vdb->buf + (uint32_t)(y_ofs + row) * row_bytes;
+            for(i = i_start; i <= i_end; i++) {
+                uint8_t bits = map_row[i];
+
+                /*Clear the pixels out of the mask*/
+                if((i << 3) < col_start) bits &= 0xFF >> (col_start - (i << 3));
+                if((i << 3) + 8 > col_end) bits &= 0xFF << ((i << 3) + 8 - col_end);
+                if(bits == 0) continue;
+
+                /*The first bits can be left from the VDB but they are cleared*/
+                lv_coord_t x = x_ofs + (i << 3);
+                if(x < 0) {
+                    bits = bits << (-x);
+                    x = 0;
+                }
+
+                uint8_t * dest = &vdb_row[x >> 3];
+                uint8_t bits1 = bits >> (x & 0x7);
+                uint8_t bits2 = (uint8_t)(bits << (8 - (x & 0x7)));
+                if(set) {
+                    dest[0] |= bits1;
+                    if(bits2) dest[1] |= bits2;
+                } else {
+                    dest[0] &= ~bits1;
+                    if(bits2) dest[1] &= ~bits2;
+                }
+            }
+        }
+        return;
+    }
+#endif
+
+    uint8_t letter_px_max = (1 << bpp) - 1;
+    lv_coord_t col;
+    for(row = row_start; row < row_end; row++) {
+        const uint8_t * map_row = map_p + (uint32_t)row * width_byte_bpp;
+        px_ptr_t p = px_ptr(vdb, x_ofs + col_start, y_ofs + row);
+        for(col = col_start; col < col_end; col++, px_next(&p)) {
+            uint16_t bit = col * bpp;
+            uint8_t letter_px = (map_row[bit >> 3] >> (8 - bpp - (bit & 0x7))) & letter_px_max;
+            if(letter_px == 0) continue;
+
+            lv_opa_t px_opa;
+            if(bpp == 8) px_opa = opa == LV_OPA_COVER ? letter_px : (uint16_t)((uint16_t)letter_px * opa) >> 8;
+            else px_opa = opa_lut[letter_px];
+
+            px_set(p, level_mix(level, px_get(p), px_opa));
+        }
+    }
+}
+
+/**
+ * Draw a color map into a packed VDB
+ * @param vdb pointer to a VDB
+ * @param map_area the area to draw relative to the VDB
+ * @param map_p pointer to the first pixel of the map to draw
+ * @param map_w width of the whole map (to step to the next row)
+ * @param chroma_key true: enable transparency of LV_IMG_LV_COLOR_TRANSP color pixels
+ * @param alpha_byte true: extra alpha byte is inserted for every pixel
+ * @param recolor mix the pixels with this color
+ * @param recolor_opa the intense of recoloring
+ * @param opa opacity of the map
+ */
+void lv_vpacked_map(lv_vdb_t * vdb, const lv_area_t * map_area, const uint8_t * map_p, lv_coord_t map_w,
+                    bool chroma_key, bool alpha_byte, lv_color_t recolor, lv_opa_t recolor_opa, lv_opa_t opa)
+{
+    uint8_t px_size_byte = alpha_byte ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+    lv_color_t chroma_key_color = LV_COLOR_TRANSP;
+
+    /*Minor acceleration: convert only the new colors (save the last)*/
+    lv_color_t last_img_px = LV_COLOR_BLACK;
+    uint8_t last_level = color_to_level(recolor_opa != LV_OPA_TRANSP ?
+                                        lv_color_mix(recolor, last_img_px, recolor_opa) : last_img_px);
+    lv_coord_t row;
+    lv_coord_t col;
+    for(row = map_area->y1; row <= map_area->y2; row++) {
+        px_ptr_t p = px_ptr(vdb, map_area->x1, row);
+        const uint8_t * px_color_p = map_p;
+        for(col = map_area->x1; col <= map_area->x2; col++, px_next(&p), px_color_p += px_size_byte) {
+            lv_opa_t opa_result = opa;
+            lv_color_t px_color;
+
+            /*Calculate with the pixel level alpha*/
+            if(alpha_byte) {
+#if LV_COLOR_DEPTH == 8 || LV_COLOR_DEPTH == 1
+                px_color.full = px_color_p[0];
+#elif LV_COLOR_DEPTH == 16
+                /*Because of Alpha byte 16 bit color can start on odd address which can cause crash*/
+                px_color.full = px_color_p[0] + (px_color_p[1] << 8);
+#elif LV_COLOR_DEPTH == 24 || LV_COLOR_DEPTH == 32
+                px_color = *((lv_color_t *)px_color_p);
+#endif
+                lv_opa_t px_opa = *(px_color_p + LV_IMG_PX_SIZE_ALPHA_BYTE - 1);
+                if(px_opa == LV_OPA_TRANSP) continue;
+                else if(px_opa != LV_OPA_COVER) opa_result = (uint32_t)((uint32_t)px_opa * opa_result) >> 8;
+            } else {
+                px_color = *((lv_color_t *)px_color_p);
+            }
+
+            /*Handle chroma key*/
+            if(chroma_key && px_color.full == chroma_key_color.full) continue;
+
+            if(last_img_px.full != px_color.full) {
+                last_img_px = px_color;
+                last_level = color_to_level(recolor_opa != LV_OPA_TRANSP ?
+                                            lv_color_mix(recolor, last_img_px, recolor_opa) : last_img_px);
+            }
+
+            px_set(p, level_mix(last_level, px_get(p), opa_result));
+        }
+
+        map_p += (uint32_t)map_w * px_size_byte;    /*Next row on the map*/
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Fill an area with a level without mixing. Write whole bytes where possible.
+ * @param vdb pointer to a VDB
+ * @param fill_area the area to fill relative to the VDB
+ * @param level the level to fill with
+ */
+static void fill_cover(const lv_vdb_t * vdb, const lv_area_t * fill_area, uint8_t level)
+{
+    uint8_t pattern = PX_PATTERN(level);
+    lv_coord_t vdb_w = lv_area_get_width(&vdb->area);
+    uint8_t * buf = (uint8_t *)vdb->buf;
+
+#if LV_VDB_PX_VERTICAL
+    lv_coord_t w = lv_area_get_width(fill_area);
+    lv_coord_t page_first = fill_area->y1 / PX_PER_BYTE;
+    lv_coord_t page_last = fill_area->y2 / PX_PER_BYTE;
+    lv_coord_t page;
+    for(page = page_first; page <= page_last; page++) {
+        uint8_t pos1 = page == page_first ? fill_area->y1 % PX_PER_BYTE : 0;
+        uint8_t pos2 = page == page_last ? fill_area->y2 % PX_PER_BYTE : PX_PER_BYTE - 1;
+        uint8_t mask = pos_mask(pos1, pos2);
+        uint8_t * dest = &buf[(uint32_t)page * vdb_w + fill_area->x1];
+        if(mask == 0xFF) {
+            memset(dest, pattern, w);
+        } else {
+            lv_coord_t i;
+            for(i = 0; i < w; i++) dest[i] = (dest[i] & ~mask) | (pattern & mask);
+        }
+    }
+#else
+    uint32_t row_bytes = ROW_BYTES(vdb_w);
+    lv_coord_t byte_first = fill_area->x1 / PX_PER_BYTE;
+    lv_coord_t byte_last = fill_area->x2 / PX_PER_BYTE;
+    uint8_t mask_first = pos_mask(fill_area->x1 % PX_PER_BYTE, PX_PER_BYTE - 1);
+    uint8_t mask_last = pos_mask(0, fill_area->x2 % PX_PER_BYTE);
+    if(byte_first == byte_last) mask_first &= mask_last;
+
+    uint8_t * dest = &buf[(uint32_t)fill_area->y1 * row_bytes];
+    lv_coord_t row;
+    for(row = fill_area->y1; row <= fill_area->y2; row++) {
+        dest[byte_first] = (dest[byte_first] & ~mask_first) | (pattern & mask_first);
+        if(byte_last > byte_first) {
+            if(byte_last > byte_first + 1) memset(&dest[byte_first + 1], pattern, byte_last - byte_first - 1);
+            dest[byte_last] = (dest[byte_last] & ~mask_last) | (pattern & mask_last);
+        }
+        dest += row_bytes;
+    }
+#endif
+}
+
+/**
+ * Get the bits of a range of pixels in a byte
+ * @param pos1 index of the first pixel in the byte
+ * @param pos2 index of the last pixel in the byte
+ * @return the mask of the pixels
+ */
+static uint8_t pos_mask(uint8_t pos1, uint8_t pos2)
+{
+    uint8_t mask = 0;
+    for(; pos1 <= pos2; pos1++) mask |= PX_MAX << PX_SHIFT(pos1);
+    return mask;
+}
+
+/**
+ * Get the address of a pixel
+ * @param vdb pointer to a VDB
+ * @param x x coordinate relative to the VDB
+ * @param y y coordinate relative to the VDB
+ * @return the byte and the position of the pixel in it
+ */
+static inline px_ptr_t px_ptr(const lv_vdb_t * vdb, lv_coord_t x, lv_coord_t y)
+{
+    px_ptr_t p;
+    lv_coord_t vdb_w = lv_area_get_width(&vdb->area);
+#if LV_VDB_PX_VERTICAL
+    p.byte = (uint8_t *)vdb->buf + (uint32_t)(y / PX_PER_BYTE) * vdb_w + x;
+    p.shift = PX_SHIFT(y % PX_PER_BYTE);
+#else
+    p.byte = (uint8_t *)vdb->buf + (uint32_t)y * ROW_BYTES(vdb_w) + x / PX_PER_BYTE;
+    p.shift = PX_SHIFT(x % PX_PER_BYTE);
+#endif
+    return p;
+}
+
+/**
+ * Step to the next pixel in the row
+ * @param p pointer to a pixel address
+ */
+static inline void px_next(px_ptr_t * p)
+{
+#if LV_VDB_PX_VERTICAL
+    p->byte++;
+#elif LV_VDB_PX_MSB_FIRST
+    if(p->shift == 0) {
+        p->shift = 8 - LV_VDB_PX_BPP;
+        p->byte++;
+    } else {
+        p->shift -= LV_VDB_PX_BPP;
+    }
+#else
+    p->shift += LV_VDB_PX_BPP;
+    if(p->shift == 8) {
+        p->shift = 0;
+        p->byte++;
+    }
+#endif
+}
+
+static inline uint8_t px_get(px_ptr_t p)
+{
+    return (*p.byte >> p.shift) & PX_MAX;
+}
+
+static inline void px_set(px_ptr_t p, uint8_t level)
+{
+    *p.byte = (*p.byte & ~(PX_MAX << p.shift)) | (level << p.shift);
+}
+
+/**
+ * Convert a color to a gray level of the VDB
+ * @param color a color
+ * @return the level (0: black, PX_MAX: white)
+ */
+static inline uint8_t color_to_level(lv_color_t color)
+{
+    return lv_color_brightness(color) >> (8 - LV_VDB_PX_BPP);
+}
+
+/**
+ * Mix two levels. Rounds to the nearest level so 1 bit pixels change above 50% opacity.
+ * @param fg foreground level
+ * @param bg background level
+ * @param opa opacity of the foreground
+ * @return the mixed level
+ */
+static inline uint8_t level_mix(uint8_t fg, uint8_t bg, lv_opa_t opa)
+{
+    if(opa == LV_OPA_COVER) return fg;
+    return ((uint16_t)fg * opa + (uint16_t)bg * (255 - opa) + 127) / 255;
+}
+
+#endif /*LV_VDB_SIZE != 0 && LV_VDB_PACKED*/
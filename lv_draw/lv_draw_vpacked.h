@@ -0,0 +1,111 @@
+/**
+ * @file lv_draw_vpacked.h
+ * Drawing into a VDB with packed 1, 2 or 4 bit grayscale pixels
+ */
+
+#ifndef LV_DRAW_VPACKED_H
+#define LV_DRAW_VPACKED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifdef LV_CONF_INCLUDE_SIMPLE
+#include "lv_conf.h"
+#else
+#include "../../lv_conf.h"
+#endif
+
+#if LV_VDB_SIZE != 0
+
+#include "../lv_core/lv_vdb.h"
+
+#if LV_VDB_PACKED
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get how many rows of an area fit into the VDB. The rows (or pages) start on a byte boundary.
+ * @param w width of the area
+ * @return number of rows
+ */
+lv_coord_t lv_vpacked_get_max_row(lv_coord_t w);
+
+/**
+ * Put a pixel into a packed VDB
+ * @param vdb pointer to a VDB
+ * @param x x coordinate relative to the VDB
+ * @param y y coordinate relative to the VDB
+ * @param color pixel color
+ * @param opa opacity of the pixel
+ */
+void lv_vpacked_px(lv_vdb_t * vdb, lv_coord_t x, lv_coord_t y, lv_color_t color, lv_opa_t opa);
+
+/**
+ * Fill an area of a packed VDB
+ * @param vdb pointer to a VDB
+ * @param fill_area the area to fill relative to the VDB
+ * @param color fill color
+ * @param opa opacity of the area
+ */
+void lv_vpacked_fill(lv_vdb_t * vdb, const lv_area_t * fill_area, lv_color_t color, lv_opa_t opa);
+
+/**
+ * Draw a letter into a packed VDB
+ * @param vdb pointer to a VDB
+ * @param pos_x x coordinate of the letter
+ * @param pos_y y coordinate of the letter
+ * @param mask_p the letter will be drawn only on this area (truncated to VDB area)
+ * @param map_p bitmap of the letter
+ * @param letter_w width of the letter
+ * @param letter_h height of the letter
+ * @param bpp bit per pixel of the bitmap (1, 2, 4 or 8)
+ * @param bpp_opa_table convert the pixel values of the bitmap to opacity. NULL with 8 bpp
+ * @param color color of letter
+ * @param opa opacity of letter
+ */
+void lv_vpacked_letter(lv_vdb_t * vdb, lv_coord_t pos_x, lv_coord_t pos_y, const lv_area_t * mask_p,
+                       const uint8_t * map_p, lv_coord_t letter_w, lv_coord_t letter_h,
+                       uint8_t bpp, const uint8_t * bpp_opa_table, lv_color_t color, lv_opa_t opa);
+
+/**
+ * Draw a color map into a packed VDB
+ * @param vdb pointer to a VDB
+ * @param map_area the area to draw relative to the VDB
+ * @param map_p pointer to the first pixel of the map to draw
+ * @param map_w width of the whole map (to step to the next row)
+ * @param chroma_key true: enable transparency of LV_IMG_LV_COLOR_TRANSP color pixels
+ * @param alpha_byte true: extra alpha byte is inserted for every pixel
+ * @param recolor mix the pixels with this color
+ * @param recolor_opa the intense of recoloring
+ * @param opa opacity of the map
+ */
+void lv_vpacked_map(lv_vdb_t * vdb, const lv_area_t * map_area, const uint8_t * map_p, lv_coord_t map_w,
+                    bool chroma_key, bool alpha_byte, lv_color_t recolor, lv_opa_t recolor_opa, lv_opa_t opa);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_VDB_PACKED*/
+
+#endif /*LV_VDB_SIZE != 0*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_DRAW_VPACKED_H*/
@@ -15,6 +15,7 @@
 #include "../lv_misc/lv_mem.h"
 #include "../lv_core/lv_obj.h"
 #include "../lv_misc/lv_gc.h"
+#include "../lv_misc/lv_trace.h"
 
 #if defined(LV_GC_INCLUDE)
 #   include LV_GC_INCLUDE
@@ -66,6 +67,20 @@ void lv_disp_drv_init(lv_disp_drv_t * driver)
 #if LV_VDB_SIZE
     driver->vdb_wr = NULL;
 #endif
+
+#if LV_VDB_SIZE && USE_LV_GPU_2D
+    driver->acc = NULL;
+#endif
+
+#if LV_VDB_SIZE && USE_LV_FLUSH_CONV
+    driver->conv_fmt = LV_COLOR_CONV_NONE;
+    driver->conv_buf = NULL;
+#endif
+
+#if LV_VDB_SIZE && USE_LV_DISP_ROT
+    driver->rotated = LV_ROT_NONE;
+    driver->rot_buf = NULL;
+#endif
 }
 
 /**
@@ -85,6 +100,25 @@ lv_disp_t * lv_disp_drv_register(lv_disp_drv_t * driver)
     memcpy(&node->driver, driver, sizeof(lv_disp_drv_t));
     node->next = NULL;
 
+#if LV_VDB_SIZE && USE_LV_FLUSH_CONV
+    if(node->driver.conv_fmt != LV_COLOR_CONV_NONE && node->driver.conv_buf == NULL) {
+        node->driver.conv_buf = lv_mem_alloc(LV_VDB_SIZE * lv_color_conv_get_px_size(node->driver.conv_fmt));
+        if(node->driver.conv_buf == NULL) {
+            /*Not fatal: flush the VDB without conversion*/
+            LV_LOG_WARN("lv_disp_drv_register: not enough memory for the conversion buffer");
+            node->driver.conv_fmt = LV_COLOR_CONV_NONE;
+        }
+    }
+#endif
+
+#if LV_VDB_SIZE && USE_LV_DISP_ROT
+    if(node->driver.rotated != LV_ROT_NONE) {
+        lv_rot_t rot = node->driver.rotated;
+        node->driver.rotated = LV_ROT_NONE;
+        lv_disp_set_rot(node, rot);
+    }
+#endif
+
     /* Set first display as active by default */
     if(LV_GC_ROOT(_lv_disp_list) == NULL) {
         LV_GC_ROOT(_lv_disp_list) = node;
@@ -108,6 +142,32 @@ void lv_disp_set_active(lv_disp_t * disp)
     lv_obj_invalidate(lv_scr_act());
 }
 
+#if LV_VDB_SIZE && USE_LV_DISP_ROT
+/**
+ * Set the rotation of a display and redraw it.
+ * If the buffer of the rotated pixels can't be allocated the rotation remains unchanged.
+ * @param disp pointer to a display (return value of 'lv_disp_register')
+ * @param rot clockwise rotation from `LV_ROT_...`
+ */
+void lv_disp_set_rot(lv_disp_t * disp, lv_rot_t rot)
+{
+    if(disp->driver.rotated == rot) return;
+
+    /*Allocate the buffer of the rotated pixels for the first rotation*/
+    if(rot != LV_ROT_NONE && disp->driver.rot_buf == NULL) {
+        disp->driver.rot_buf = lv_mem_alloc(LV_VDB_SIZE * sizeof(lv_color_t));
+        if(disp->driver.rot_buf == NULL) {
+            /*Not fatal: keep the current rotation*/
+            LV_LOG_WARN("lv_disp_set_rot: not enough memory for the rotation buffer");
+            return;
+        }
+    }
+
+    disp->driver.rotated = rot;
+    if(disp == active) lv_obj_invalidate(lv_scr_act());
+}
+#endif
+
 /**
  * Get a pointer to the active display
  * @return pointer to the active display
@@ -160,7 +220,9 @@ void lv_disp_flush(int32_t x1, int32_t y1, int32_t x2, int32_t y2, lv_color_t *
     if(active->driver.disp_flush != NULL) {
 
         LV_LOG_TRACE("disp flush  started");
+        LV_TRACE_BEGIN(LV_TRACE_EVT_FLUSH, (x2 - x1 + 1) * (y2 - y1 + 1));
         active->driver.disp_flush(x1, y1, x2, y2, color_p);
+        LV_TRACE_END(LV_TRACE_EVT_FLUSH, 0);
         LV_LOG_TRACE("disp flush ready");
 
     } else {
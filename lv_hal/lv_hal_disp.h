@@ -20,6 +20,9 @@ extern "C" {
 #include "lv_hal.h"
 #include "../lv_misc/lv_color.h"
 #include "../lv_misc/lv_area.h"
+#include "../lv_misc/lv_color_conv.h"
+#include "../lv_misc/lv_rot.h"
+#include "../lv_draw/lv_draw_acc.h"
 
 /*********************
  *      DEFINES
@@ -55,6 +58,31 @@ typedef struct _disp_drv_t {
     /*Optional: Set a pixel in a buffer according to the requirements of the display*/
     void (*vdb_wr)(uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y, lv_color_t color, lv_opa_t opa);
 #endif
+
+#if LV_VDB_SIZE && USE_LV_GPU_2D
+    /*Optional: 2D accelerator to draw into the VDB (e.g. `lv_acc_sw_get()`). Not used with 'vdb_wr' or LV_VDB_PACKED.*/
+    const lv_acc_t * acc;
+#endif
+
+#if LV_VDB_SIZE && USE_LV_FLUSH_CONV
+    /*Optional: Convert the VDB to this pixel format (`LV_COLOR_CONV_...`) before 'disp_flush'.
+     *'disp_flush' gets the converted pixels as 'color_p'*/
+    lv_color_conv_fmt_t conv_fmt;
+
+    /*Buffer for the converted pixels (e.g. in DMA capable memory). Allocated when the driver is registered if NULL.
+     *Size: LV_VDB_SIZE * lv_color_conv_get_px_size(conv_fmt) bytes*/
+    void * conv_buf;
+#endif
+
+#if LV_VDB_SIZE && USE_LV_DISP_ROT
+    /*Optional: Rotate the VDB clockwise (`LV_ROT_...`) before 'disp_flush'. Drawing happens with LV_HOR_RES x LV_VER_RES,
+     *'disp_flush' gets the rotated coordinates and pixels (LV_VER_RES x LV_HOR_RES with 90 and 270 degree).
+     *Use 'lv_disp_set_rot' to change it later.*/
+    lv_rot_t rotated;
+
+    /*Buffer for the rotated pixels. Allocated for the first rotation if NULL. Size: LV_VDB_SIZE * sizeof(lv_color_t) bytes*/
+    lv_color_t * rot_buf;
+#endif
 } lv_disp_drv_t;
 
 typedef struct _disp_t {
@@ -88,6 +116,16 @@ lv_disp_t * lv_disp_drv_register(lv_disp_drv_t *driver);
  */
 void lv_disp_set_active(lv_disp_t * disp);
 
+#if LV_VDB_SIZE && USE_LV_DISP_ROT
+/**
+ * Set the rotation of a display and redraw it.
+ * If the buffer of the rotated pixels can't be allocated the rotation remains unchanged.
+ * @param disp pointer to a display (return value of 'lv_disp_register')
+ * @param rot clockwise rotation from `LV_ROT_...`
+ */
+void lv_disp_set_rot(lv_disp_t * disp, lv_rot_t rot);
+#endif
+
 /**
  * Get a pointer to the active display
  * @return pointer to the active display
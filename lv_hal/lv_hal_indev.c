@@ -11,6 +11,7 @@
 #include "../lv_hal/lv_hal_indev.h"
 #include "../lv_misc/lv_mem.h"
 #include "../lv_misc/lv_gc.h"
+#include "../lv_misc/lv_trace.h"
 
 #if defined(LV_GC_INCLUDE)
 #   include LV_GC_INCLUDE
@@ -121,7 +122,9 @@ bool lv_indev_read(lv_indev_t * indev, lv_indev_data_t * data)
         data->user_data = indev->driver.user_data;
 
         LV_LOG_TRACE("idnev read started");
+        LV_TRACE_BEGIN(LV_TRACE_EVT_INDEV_READ, 0);
         cont = indev->driver.read(data);
+        LV_TRACE_END(LV_TRACE_EVT_INDEV_READ, cont);
         LV_LOG_TRACE("idnev read finished");
     } else {
         LV_LOG_WARN("indev function registered");
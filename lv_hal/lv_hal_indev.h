@@ -83,6 +83,7 @@ typedef struct _lv_indev_proc_t {
             uint8_t drag_range_out      :1;
             uint8_t drag_in_prog        :1;
             uint8_t wait_unil_release   :1;
+            uint8_t cursor_overlay      :1;     /*The cursor is drawn by `lv_overlay`*/
         };
         struct {    /*Keypad data*/
             lv_indev_state_t last_state;
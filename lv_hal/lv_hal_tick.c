@@ -19,6 +19,10 @@
 #include LV_TICK_CUSTOM_INCLUDE
 #endif
 
+#if LV_TICK_US_CUSTOM == 1
+#include LV_TICK_US_CUSTOM_INCLUDE
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -94,6 +98,32 @@ uint32_t lv_tick_elaps(uint32_t prev_tick)
     return prev_tick;
 }
 
+/**
+ * Get a time stamp in microseconds for profiling and smooth timing.
+ * Uses `LV_TICK_US_CUSTOM_SYS_TIME_EXPR` if `LV_TICK_US_CUSTOM == 1`
+ * else falls back to the millisecond tick (`lv_tick_get() * 1000`)
+ * @return the elapsed microseconds (overflows after ~71 minutes)
+ */
+uint32_t lv_tick_get_us(void)
+{
+#if LV_TICK_US_CUSTOM == 0
+    return lv_tick_get() * 1000;    /*Overflows in the same way as a real microsecond counter so `lv_tick_elaps_us` works*/
+#else
+    return (uint32_t)(LV_TICK_US_CUSTOM_SYS_TIME_EXPR);
+#endif
+}
+
+/**
+ * Get the elapsed microseconds since a previous time stamp
+ * @param prev_tick a previous time stamp (return value of `lv_tick_get_us()`)
+ * @return the elapsed microseconds since 'prev_tick'
+ */
+uint32_t lv_tick_elaps_us(uint32_t prev_tick)
+{
+    /*The unsigned subtraction handles the overflow of the time stamp*/
+    return lv_tick_get_us() - prev_tick;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
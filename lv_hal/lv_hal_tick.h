@@ -1,6 +1,7 @@
 /**
  * @file lv_hal_tick.h
  * Provide access to the system tick with 1 millisecond resolution
+ * and to an optional microsecond time source
  */
 
 #ifndef LV_HAL_TICK_H
@@ -55,6 +56,21 @@ uint32_t lv_tick_get(void);
  */
 uint32_t lv_tick_elaps(uint32_t prev_tick);
 
+/**
+ * Get a time stamp in microseconds for profiling and smooth timing.
+ * Uses `LV_TICK_US_CUSTOM_SYS_TIME_EXPR` if `LV_TICK_US_CUSTOM == 1`
+ * else falls back to the millisecond tick (`lv_tick_get() * 1000`)
+ * @return the elapsed microseconds (overflows after ~71 minutes)
+ */
+uint32_t lv_tick_get_us(void);
+
+/**
+ * Get the elapsed microseconds since a previous time stamp
+ * @param prev_tick a previous time stamp (return value of `lv_tick_get_us()`)
+ * @return the elapsed microseconds since 'prev_tick'
+ */
+uint32_t lv_tick_elaps_us(uint32_t prev_tick);
+
 /**********************
  *      MACROS
  **********************/
@@ -40,7 +40,8 @@ static bool anim_ready_handler(lv_anim_t * a);
 /**********************
  *  STATIC VARIABLES
  **********************/
-static uint32_t last_task_run;
+static uint32_t last_task_run;             /*Time stamp of the last `anim_task` run in microseconds*/
+static uint32_t elaps_rem;                  /*Elapsed microseconds not yet applied to the animations*/
 static bool anim_list_changed;
 
 /**********************
@@ -57,7 +58,8 @@ static bool anim_list_changed;
 void lv_anim_init(void)
 {
     lv_ll_init(&LV_GC_ROOT(_lv_anim_ll), sizeof(lv_anim_t));
-    last_task_run = lv_tick_get();
+    last_task_run = lv_tick_get_us();
+    elaps_rem = 0;
     lv_task_create(anim_task, LV_REFR_PERIOD, LV_TASK_PRIO_MID, NULL);
 }
 
@@ -361,7 +363,14 @@ static void anim_task(void * param)
         a->has_run = 0;
     }
 
-    uint32_t elaps = lv_tick_elaps(last_task_run);
+    /* Measure the elapsed time in microseconds and keep the sub-millisecond remainder
+     * for the next run so the animations don't drift*/
+    uint32_t now = lv_tick_get_us();
+    elaps_rem += now - last_task_run;
+    last_task_run = now;
+    uint32_t elaps = elaps_rem / 1000;
+    elaps_rem -= elaps * 1000;
+
     a = lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
 
     while(a != NULL) {
@@ -393,8 +402,6 @@ static void anim_task(void * param)
         if(anim_list_changed) a = lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
         else a = lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
     }
-
-    last_task_run = lv_tick_get();
 }
 
 /**
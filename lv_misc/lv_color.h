@@ -20,10 +20,6 @@ extern "C" {
 #endif
 
 /*Error checking*/
-#if LV_COLOR_DEPTH == 24
-#error "LV_COLOR_DEPTH  24 is deprecated. Use LV_COLOR_DEPTH  32 instead (lv_conf.h)"
-#endif
-
 #if LV_COLOR_DEPTH != 32 && LV_COLOR_SCREEN_TRANSP != 0
 #error "LV_COLOR_SCREEN_TRANSP requires LV_COLOR_DEPTH == 32. Set it in lv_conf.h"
 #endif
@@ -38,6 +34,10 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+#ifndef LV_ATTRIBUTE_PACKED
+#define LV_ATTRIBUTE_PACKED __attribute__((packed))
+#endif
+
 #define LV_COLOR_WHITE   LV_COLOR_MAKE(0xFF,0xFF,0xFF)
 #define LV_COLOR_SILVER  LV_COLOR_MAKE(0xC0,0xC0,0xC0)
 #define LV_COLOR_GRAY    LV_COLOR_MAKE(0x80,0x80,0x80)
@@ -82,10 +82,12 @@ enum {
 #define LV_COLOR_SIZE           8
 #elif LV_COLOR_DEPTH == 16
 #define LV_COLOR_SIZE           16
+#elif LV_COLOR_DEPTH == 24
+#define LV_COLOR_SIZE           24
 #elif LV_COLOR_DEPTH == 32
 #define LV_COLOR_SIZE           32
 #else
-#error "Invalid LV_COLOR_DEPTH in lv_conf.h! Set it to 1, 8, 16 or 32!"
+#error "Invalid LV_COLOR_DEPTH in lv_conf.h! Set it to 1, 8, 16, 24 or 32!"
 #endif
 
 /**********************
@@ -129,6 +131,18 @@ typedef union
     uint16_t full;
 } lv_color16_t;
 
+/*Packed to 3 bytes so arrays of it (VDB, images) have no padding*/
+typedef union LV_ATTRIBUTE_PACKED
+{
+    struct
+    {
+        uint8_t blue;
+        uint8_t green;
+        uint8_t red;
+    };
+    uint32_t full :24;
+} lv_color24_t;
+
 typedef union
 {
     struct
@@ -150,11 +164,14 @@ typedef lv_color8_t lv_color_t;
 #elif LV_COLOR_DEPTH == 16
 typedef uint16_t lv_color_int_t;
 typedef lv_color16_t lv_color_t;
+#elif LV_COLOR_DEPTH == 24
+typedef uint32_t lv_color_int_t;
+typedef lv_color24_t lv_color_t;
 #elif LV_COLOR_DEPTH == 32
 typedef uint32_t lv_color_int_t;
 typedef lv_color32_t lv_color_t;
 #else
-#error "Invalid LV_COLOR_DEPTH in lv_conf.h! Set it to 1, 8, 16 or 32!"
+#error "Invalid LV_COLOR_DEPTH in lv_conf.h! Set it to 1, 8, 16, 24 or 32!"
 #endif
 
 typedef uint8_t lv_opa_t;
@@ -211,7 +228,7 @@ static inline uint8_t lv_color_to1(lv_color_t color)
     } else {
         return 0;
     }
-#elif LV_COLOR_DEPTH == 32
+#elif LV_COLOR_DEPTH == 24 || LV_COLOR_DEPTH == 32
     if((color.red   & 0x80) ||
             (color.green & 0x80) ||
             (color.blue  & 0x80)) {
@@ -244,7 +261,7 @@ static inline uint8_t lv_color_to8(lv_color_t color)
     ret.blue = color.blue >> 3;     /* 5 - 2  = 3*/
     return ret.full;
 #  endif
-#elif LV_COLOR_DEPTH == 32
+#elif LV_COLOR_DEPTH == 24 || LV_COLOR_DEPTH == 32
     lv_color8_t ret;
     ret.red = color.red >> 5;       /* 8 - 3  = 5*/
     ret.green = color.green >> 5;   /* 8 - 3  = 5*/
@@ -274,7 +291,7 @@ static inline uint16_t lv_color_to16(lv_color_t color)
     return ret.full;
 #elif LV_COLOR_DEPTH == 16
     return color.full;
-#elif LV_COLOR_DEPTH == 32
+#elif LV_COLOR_DEPTH == 24 || LV_COLOR_DEPTH == 32
     lv_color16_t ret;
 #  if LV_COLOR_16_SWAP == 0
     ret.red = color.red >> 3;       /* 8 - 5  = 3*/
@@ -318,6 +335,13 @@ static inline uint32_t lv_color_to32(lv_color_t color)
     ret.alpha = 0xFF;
     return ret.full;
 #  endif
+#elif LV_COLOR_DEPTH == 24
+    lv_color32_t ret;
+    ret.red = color.red;
+    ret.green = color.green;
+    ret.blue = color.blue;
+    ret.alpha = 0xFF;
+    return ret.full;
 #elif LV_COLOR_DEPTH == 32
     return color.full;
 #endif
@@ -327,7 +351,7 @@ static inline lv_color_t lv_color_mix(lv_color_t c1, lv_color_t c2, uint8_t mix)
 {
     lv_color_t ret;
 #if LV_COLOR_DEPTH != 1
-    /*LV_COLOR_DEPTH == 8, 16 or 32*/
+    /*LV_COLOR_DEPTH == 8, 16, 24 or 32*/
     ret.red =   (uint16_t)((uint16_t) c1.red * mix + (c2.red * (255 - mix))) >> 8;
 #  if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
     /*If swapped Green is in 2 parts*/
@@ -377,6 +401,8 @@ static inline uint8_t lv_color_brightness(lv_color_t color)
 #  else
 #    define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{g8 >> 5, r8 >> 3, b8 >> 3, (g8 >> 2) & 0x7}})
 #  endif
+#elif LV_COLOR_DEPTH == 24
+#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{b8, g8, r8}})
 #elif LV_COLOR_DEPTH == 32
 #define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{b8, g8, r8, 0xff}})            /*Fix 0xff alpha*/
 #endif
@@ -387,6 +413,8 @@ static inline uint8_t lv_color_brightness(lv_color_t color)
 #define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{r8 >> 6, g8 >> 5, b8 >> 5}})
 #elif LV_COLOR_DEPTH == 16
 #define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{r8 >> 3, g8 >> 2, b8 >> 3}})
+#elif LV_COLOR_DEPTH == 24
+#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{b8, g8, r8}})                  /*Byte fields: same on any endianness*/
 #elif LV_COLOR_DEPTH == 32
 #define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{0xff, r8, g8, b8}})            /*Fix 0xff alpha*/
 #endif
@@ -0,0 +1,274 @@
+/**
+ * @file lv_color_conv.c
+ * Convert arrays of `lv_color_t` to the pixel format of a display
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_color_conv.h"
+#if USE_LV_FLUSH_CONV
+
+#include <stddef.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void conv_rgb565(void * dest, const lv_color_t * src, uint32_t px_num);
+static void conv_rgb565_swap(void * dest, const lv_color_t * src, uint32_t px_num);
+static void conv_bgr565(void * dest, const lv_color_t * src, uint32_t px_num);
+static void conv_rgb666(void * dest, const lv_color_t * src, uint32_t px_num);
+static void conv_rgb888(void * dest, const lv_color_t * src, uint32_t px_num);
+static void conv_xrgb8888(void * dest, const lv_color_t * src, uint32_t px_num);
+static void conv_xbgr8888(void * dest, const lv_color_t * src, uint32_t px_num);
+static inline uint16_t px_rgb565(lv_color_t c);
+static inline uint32_t px_xrgb8888(lv_color_t c);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const lv_color_conv_cb_t conv_builtin[_LV_COLOR_CONV_NUM] = {
+    NULL,
+    conv_rgb565,
+    conv_rgb565_swap,
+    conv_bgr565,
+    conv_rgb666,
+    conv_rgb888,
+    conv_xrgb8888,
+    conv_xbgr8888,
+};
+
+static const uint8_t conv_px_size[_LV_COLOR_CONV_NUM] = {
+    sizeof(lv_color_t), 2, 2, 2, 3, 3, 4, 4
+};
+
+static lv_color_conv_cb_t conv_custom[_LV_COLOR_CONV_NUM];
+
+/**********************
+ *      MACROS
+ **********************/
+
+/*Process two RGB565 pixels in a 32 bit word*/
+#define SWAP16_X2(x)    ((((x) & 0xFF00FF00) >> 8) | (((x) & 0x00FF00FF) << 8))
+#define BGR565_X2(x)    (((x) & 0x07E007E0) | (((x) & 0x001F001F) << 11) | (((x) >> 11) & 0x001F001F))
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Replace the converter of a pixel format. Useful to register a platform specific
+ * (e.g. SIMD or DMA2D) converter instead of the built-in one.
+ * @param fmt a pixel format from `LV_COLOR_CONV_...`
+ * @param cb the new converter. NULL to restore the built-in converter.
+ */
+void lv_color_conv_set_cb(lv_color_conv_fmt_t fmt, lv_color_conv_cb_t cb)
+{
+    if(fmt == LV_COLOR_CONV_NONE || fmt >= _LV_COLOR_CONV_NUM) return;
+
+    conv_custom[fmt] = cb;
+}
+
+/**
+ * Get the converter of a pixel format
+ * @param fmt a pixel format from `LV_COLOR_CONV_...`
+ * @return the converter or NULL with `LV_COLOR_CONV_NONE` or an invalid format
+ */
+lv_color_conv_cb_t lv_color_conv_get_cb(lv_color_conv_fmt_t fmt)
+{
+    if(fmt >= _LV_COLOR_CONV_NUM) return NULL;
+
+    if(conv_custom[fmt]) return conv_custom[fmt];
+    else return conv_builtin[fmt];
+}
+
+/**
+ * Get the size of a pixel in a pixel format
+ * @param fmt a pixel format from `LV_COLOR_CONV_...`
+ * @return size of a pixel in bytes
+ */
+uint8_t lv_color_conv_get_px_size(lv_color_conv_fmt_t fmt)
+{
+    if(fmt >= _LV_COLOR_CONV_NUM) return sizeof(lv_color_t);
+
+    return conv_px_size[fmt];
+}
+
+/**
+ * Convert pixels to a pixel format
+ * @param fmt the pixel format of `dest` from `LV_COLOR_CONV_...`
+ * @param dest the buffer to write. `px_num * lv_color_conv_get_px_size(fmt)` bytes.
+ * @param src the pixels to convert
+ * @param px_num number of pixels to convert
+ */
+void lv_color_conv(lv_color_conv_fmt_t fmt, void * dest, const lv_color_t * src, uint32_t px_num)
+{
+    lv_color_conv_cb_t cb = lv_color_conv_get_cb(fmt);
+    if(cb) cb(dest, src, px_num);
+    else memcpy(dest, src, px_num * sizeof(lv_color_t));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void conv_rgb565(void * dest, const lv_color_t * src, uint32_t px_num)
+{
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+    memcpy(dest, src, px_num * sizeof(lv_color_t));
+#else
+    uint16_t * d = dest;
+    uint32_t i;
+    for(i = 0; i < px_num; i++) d[i] = px_rgb565(src[i]);
+#endif
+}
+
+static void conv_rgb565_swap(void * dest, const lv_color_t * src, uint32_t px_num)
+{
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
+    memcpy(dest, src, px_num * sizeof(lv_color_t));
+#else
+    uint16_t * d = dest;
+    uint32_t i = 0;
+
+#if LV_COLOR_DEPTH == 16
+    /*Swap two pixels at once if both buffers can be read as words*/
+    const uint16_t * s = (const uint16_t *)src;
+    if((((uintptr_t)d ^ (uintptr_t)s) & 0x3) == 0) {
+        if(((uintptr_t)d & 0x3) && px_num > 0) {
+            d[0] = (uint16_t)((s[0] >> 8) | (s[0] << 8));
+            i = 1;
+        }
+        uint32_t * d32 = (uint32_t *)&d[i];
+        const uint32_t * s32 = (const uint32_t *)&s[i];
+        uint32_t w_num = (px_num - i) >> 1;
+        uint32_t w;
+        for(w = 0; w < w_num; w++) d32[w] = SWAP16_X2(s32[w]);
+        i += w_num << 1;
+    }
+#endif
+
+    for(; i < px_num; i++) {
+        uint16_t v = px_rgb565(src[i]);
+        d[i] = (uint16_t)((v >> 8) | (v << 8));
+    }
+#endif
+}
+
+static void conv_bgr565(void * dest, const lv_color_t * src, uint32_t px_num)
+{
+    uint16_t * d = dest;
+    uint32_t i = 0;
+
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+    /*Reorder two pixels at once if both buffers can be read as words*/
+    const uint16_t * s = (const uint16_t *)src;
+    if((((uintptr_t)d ^ (uintptr_t)s) & 0x3) == 0) {
+        if(((uintptr_t)d & 0x3) && px_num > 0) {
+            d[0] = (uint16_t)BGR565_X2((uint32_t)s[0]);
+            i = 1;
+        }
+        uint32_t * d32 = (uint32_t *)&d[i];
+        const uint32_t * s32 = (const uint32_t *)&s[i];
+        uint32_t w_num = (px_num - i) >> 1;
+        uint32_t w;
+        for(w = 0; w < w_num; w++) d32[w] = BGR565_X2(s32[w]);
+        i += w_num << 1;
+    }
+#endif
+
+    for(; i < px_num; i++) {
+        uint32_t v = px_rgb565(src[i]);
+        d[i] = (uint16_t)BGR565_X2(v);
+    }
+}
+
+static void conv_rgb666(void * dest, const lv_color_t * src, uint32_t px_num)
+{
+    uint8_t * d = dest;
+    uint32_t i;
+    for(i = 0; i < px_num; i++) {
+        uint32_t v = px_xrgb8888(src[i]);
+        d[0] = (v >> 16) & 0xFC;
+        d[1] = (v >> 8) & 0xFC;
+        d[2] = v & 0xFC;
+        d += 3;
+    }
+}
+
+static void conv_rgb888(void * dest, const lv_color_t * src, uint32_t px_num)
+{
+    uint8_t * d = dest;
+    uint32_t i;
+    for(i = 0; i < px_num; i++) {
+        uint32_t v = px_xrgb8888(src[i]);
+        d[0] = (v >> 16) & 0xFF;
+        d[1] = (v >> 8) & 0xFF;
+        d[2] = v & 0xFF;
+        d += 3;
+    }
+}
+
+static void conv_xrgb8888(void * dest, const lv_color_t * src, uint32_t px_num)
+{
+    uint32_t * d = dest;
+    uint32_t i;
+    for(i = 0; i < px_num; i++) d[i] = px_xrgb8888(src[i]);
+}
+
+static void conv_xbgr8888(void * dest, const lv_color_t * src, uint32_t px_num)
+{
+    uint32_t * d = dest;
+    uint32_t i;
+    for(i = 0; i < px_num; i++) {
+        uint32_t v = px_xrgb8888(src[i]);
+        d[i] = (v & 0xFF00FF00) | ((v >> 16) & 0xFF) | ((v & 0xFF) << 16);
+    }
+}
+
+/**
+ * Get a color as RGB565 in native byte order
+ * @param c a color
+ * @return the RGB565 value
+ */
+static inline uint16_t px_rgb565(lv_color_t c)
+{
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+    return c.full;
+#elif LV_COLOR_DEPTH == 16
+    return (uint16_t)((c.full >> 8) | (c.full << 8));
+#else
+    uint32_t v = px_xrgb8888(c);
+    return (uint16_t)(((v >> 8) & 0xF800) | ((v >> 5) & 0x07E0) | ((v >> 3) & 0x001F));
+#endif
+}
+
+/**
+ * Get a color as XRGB8888. The channels are expanded the same way as with `lv_color_to32`.
+ * @param c a color
+ * @return the XRGB8888 value (0xFFRRGGBB)
+ */
+static inline uint32_t px_xrgb8888(lv_color_t c)
+{
+#if LV_COLOR_DEPTH == 16
+    uint32_t v = px_rgb565(c);
+    return 0xFF000000 | ((v & 0xF800) << 8) | ((v & 0x07E0) << 5) | ((v & 0x001F) << 3);
+#elif LV_COLOR_DEPTH == 24
+    return 0xFF000000 | ((uint32_t)c.red << 16) | ((uint32_t)c.green << 8) | c.blue;
+#elif LV_COLOR_DEPTH == 32
+    return c.full | 0xFF000000;
+#else
+    return lv_color_to32(c) | 0xFF000000;
+#endif
+}
+
+#endif /*USE_LV_FLUSH_CONV*/
@@ -0,0 +1,100 @@
+/**
+ * @file lv_color_conv.h
+ * Convert arrays of `lv_color_t` to the pixel format of a display
+ */
+
+#ifndef LV_COLOR_CONV_H
+#define LV_COLOR_CONV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifdef LV_CONF_INCLUDE_SIMPLE
+#include "lv_conf.h"
+#else
+#include "../../lv_conf.h"
+#endif
+
+#if USE_LV_FLUSH_CONV
+
+#include <stdint.h>
+#include "lv_color.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Pixel formats of the displays. The multi byte formats are in the native byte order if not stated otherwise.*/
+enum {
+    LV_COLOR_CONV_NONE = 0,         /*Keep `lv_color_t`*/
+    LV_COLOR_CONV_RGB565,           /*16 bit: RRRRRGGG GGGBBBBB*/
+    LV_COLOR_CONV_RGB565_SWAP,      /*16 bit RGB565 with swapped bytes (big endian). E.g. displays with 8 bit interface*/
+    LV_COLOR_CONV_BGR565,           /*16 bit: BBBBBGGG GGGRRRRR*/
+    LV_COLOR_CONV_RGB666,           /*3 bytes: R, G, B with 6 bit on the upper bits of each byte. E.g. 18 bit SPI displays*/
+    LV_COLOR_CONV_RGB888,           /*3 bytes: R, G, B*/
+    LV_COLOR_CONV_XRGB8888,         /*32 bit: 0xFFRRGGBB*/
+    LV_COLOR_CONV_XBGR8888,         /*32 bit: 0xFFBBGGRR*/
+    _LV_COLOR_CONV_NUM
+};
+typedef uint8_t lv_color_conv_fmt_t;
+
+/**
+ * Convert `px_num` pixels from `src` to `dest`. `src` is aligned as an `lv_color_t` array,
+ * `dest` as the returned `lv_mem_alloc` memory. The buffers don't overlap.
+ */
+typedef void (*lv_color_conv_cb_t)(void * dest, const lv_color_t * src, uint32_t px_num);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Replace the converter of a pixel format. Useful to register a platform specific
+ * (e.g. SIMD or DMA2D) converter instead of the built-in one.
+ * @param fmt a pixel format from `LV_COLOR_CONV_...`
+ * @param cb the new converter. NULL to restore the built-in converter.
+ */
+void lv_color_conv_set_cb(lv_color_conv_fmt_t fmt, lv_color_conv_cb_t cb);
+
+/**
+ * Get the converter of a pixel format
+ * @param fmt a pixel format from `LV_COLOR_CONV_...`
+ * @return the converter or NULL with `LV_COLOR_CONV_NONE` or an invalid format
+ */
+lv_color_conv_cb_t lv_color_conv_get_cb(lv_color_conv_fmt_t fmt);
+
+/**
+ * Get the size of a pixel in a pixel format
+ * @param fmt a pixel format from `LV_COLOR_CONV_...`
+ * @return size of a pixel in bytes
+ */
+uint8_t lv_color_conv_get_px_size(lv_color_conv_fmt_t fmt);
+
+/**
+ * Convert pixels to a pixel format
+ * @param fmt the pixel format of `dest` from `LV_COLOR_CONV_...`
+ * @param dest the buffer to write. `px_num * lv_color_conv_get_px_size(fmt)` bytes.
+ * @param src the pixels to convert
+ * @param px_num number of pixels to convert
+ */
+void lv_color_conv(lv_color_conv_fmt_t fmt, void * dest, const lv_color_t * src, uint32_t px_num);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*USE_LV_FLUSH_CONV*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_COLOR_CONV_H*/
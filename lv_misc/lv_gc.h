@@ -35,6 +35,8 @@ extern "C" {
     prefix lv_ll_t _lv_drv_ll;\
     prefix lv_ll_t _lv_file_ll;\
     prefix lv_ll_t _lv_anim_ll;\
+    prefix lv_ll_t _lv_lang_ll;         /*Linked list of the language dependent objects*/ \
+    prefix lv_ll_t _lv_ta_blink_ll;     /*Linked list of the text areas with blinking cursor*/ \
     prefix void * _lv_def_scr;\
     prefix void * _lv_act_scr;\
     prefix void * _lv_top_layer;\
@@ -42,6 +44,7 @@ extern "C" {
     prefix void * _lv_task_act;\
     prefix void * _lv_indev_list;\
     prefix void * _lv_disp_list;\
+    prefix void * _lv_lang_txt_buf;     /*The texts of the active language*/ \
     
     
 #define LV_NO_PREFIX
@@ -7,10 +7,13 @@ CSRCS += lv_anim.c
 CSRCS += lv_mem.c
 CSRCS += lv_ll.c
 CSRCS += lv_color.c
+CSRCS += lv_color_conv.c
+CSRCS += lv_rot.c
 CSRCS += lv_txt.c
 CSRCS += lv_ufs.c
 CSRCS += lv_math.c
 CSRCS += lv_log.c
+CSRCS += lv_trace.c
 CSRCS += lv_gc.c
 
 DEPPATH += --dep-path $(LVGL_DIR)/lvgl/lv_misc
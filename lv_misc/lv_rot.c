@@ -0,0 +1,202 @@
+/**
+ * @file lv_rot.c
+ * Rotate color maps and areas by 90, 180 or 270 degrees
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_rot.h"
+#if USE_LV_DISP_ROT
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Rotate the map in blocks of this size so the read rows and the written columns stay in the cache*/
+#ifndef LV_ROT_BLOCK
+#define LV_ROT_BLOCK    16
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void rot_90(lv_color_t * dest, const lv_color_t * src, lv_coord_t w, lv_coord_t h);
+static void rot_270(lv_color_t * dest, const lv_color_t * src, lv_coord_t w, lv_coord_t h);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Rotate a color map
+ * @param dest buffer for the rotated map. Its width is `h` with `LV_ROT_90` and `LV_ROT_270`.
+ *             It can't overlap with `src`.
+ * @param src the color map to rotate
+ * @param w width of `src`
+ * @param h height of `src`
+ * @param rot rotation from `LV_ROT_...`
+ */
+void lv_rot_map(lv_color_t * dest, const lv_color_t * src, lv_coord_t w, lv_coord_t h, lv_rot_t rot)
+{
+    uint32_t px_num = (uint32_t)w * h;
+    uint32_t i;
+
+    switch(rot) {
+        case LV_ROT_90:
+            rot_90(dest, src, w, h);
+            break;
+        case LV_ROT_180:
+            /*It's simply the reversed map*/
+            for(i = 0; i < px_num; i++) dest[px_num - 1 - i] = src[i];
+            break;
+        case LV_ROT_270:
+            rot_270(dest, src, w, h);
+            break;
+        default:
+            memcpy(dest, src, px_num * sizeof(lv_color_t));
+            break;
+    }
+}
+
+/**
+ * Rotate an area together with the space it is in
+ * @param area pointer to an area to rotate. The result is stored here too.
+ * @param w width of the space (e.g. horizontal resolution)
+ * @param h height of the space (e.g. vertical resolution)
+ * @param rot rotation from `LV_ROT_...`
+ */
+void lv_rot_area(lv_area_t * area, lv_coord_t w, lv_coord_t h, lv_rot_t rot)
+{
+    lv_area_t a;
+    lv_area_copy(&a, area);
+
+    switch(rot) {
+        case LV_ROT_90:
+            area->x1 = h - 1 - a.y2;
+            area->x2 = h - 1 - a.y1;
+            area->y1 = a.x1;
+            area->y2 = a.x2;
+            break;
+        case LV_ROT_180:
+            area->x1 = w - 1 - a.x2;
+            area->x2 = w - 1 - a.x1;
+            area->y1 = h - 1 - a.y2;
+            area->y2 = h - 1 - a.y1;
+            break;
+        case LV_ROT_270:
+            area->x1 = a.y1;
+            area->x2 = a.y2;
+            area->y1 = w - 1 - a.x2;
+            area->y2 = w - 1 - a.x1;
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * Rotate an area back to where it was before `lv_rot_area`
+ * @param area pointer to a rotated area. The result is stored here too.
+ * @param w width of the space before the rotation (the same as with `lv_rot_area`)
+ * @param h height of the space before the rotation (the same as with `lv_rot_area`)
+ * @param rot the rotation which was applied from `LV_ROT_...`
+ */
+void lv_rot_area_inv(lv_area_t * area, lv_coord_t w, lv_coord_t h, lv_rot_t rot)
+{
+    /*Rotate further to a full turn in the rotated space*/
+    switch(rot) {
+        case LV_ROT_90:
+            lv_rot_area(area, h, w, LV_ROT_270);
+            break;
+        case LV_ROT_180:
+            lv_rot_area(area, w, h, LV_ROT_180);
+            break;
+        case LV_ROT_270:
+            lv_rot_area(area, h, w, LV_ROT_90);
+            break;
+        default:
+            break;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Rotate a color map by 90 degrees clockwise: (x, y) -> (h - 1 - y, x)
+ * @param dest buffer for the rotated map (`h` wide, `w` high)
+ * @param src the color map to rotate
+ * @param w width of `src`
+ * @param h height of `src`
+ */
+static void rot_90(lv_color_t * dest, const lv_color_t * src, lv_coord_t w, lv_coord_t h)
+{
+    lv_coord_t bx;
+    lv_coord_t by;
+    lv_coord_t x;
+    lv_coord_t y;
+
+    for(by = 0; by < h; by += LV_ROT_BLOCK) {
+        lv_coord_t by_end = by + LV_ROT_BLOCK < h ? by + LV_ROT_BLOCK : h;
+        for(bx = 0; bx < w; bx += LV_ROT_BLOCK) {
+            lv_coord_t bx_end = bx + LV_ROT_BLOCK < w ? bx + LV_ROT_BLOCK : w;
+            for(x = bx; x < bx_end; x++) {
+                /*A source column of the block is a part of a destination row*/
+                lv_color_t * d = &dest[(uint32_t)x * h + h - 1 - by];
+                const lv_color_t * s = &src[(uint32_t)by * w + x];
+                for(y = by; y < by_end; y++) {
+                    *d = *s;
+                    d--;
+                    s += w;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Rotate a color map by 270 degrees clockwise: (x, y) -> (y, w - 1 - x)
+ * @param dest buffer for the rotated map (`h` wide, `w` high)
+ * @param src the color map to rotate
+ * @param w width of `src`
+ * @param h height of `src`
+ */
+static void rot_270(lv_color_t * dest, const lv_color_t * src, lv_coord_t w, lv_coord_t h)
+{
+    lv_coord_t bx;
+    lv_coord_t by;
+    lv_coord_t x;
+    lv_coord_t y;
+
+    for(by = 0; by < h; by += LV_ROT_BLOCK) {
+        lv_coord_t by_end = by + LV_ROT_BLOCK < h ? by + LV_ROT_BLOCK : h;
+        for(bx = 0; bx < w; bx += LV_ROT_BLOCK) {
+            lv_coord_t bx_end = bx + LV_ROT_BLOCK < w ? bx + LV_ROT_BLOCK : w;
+            for(x = bx; x < bx_end; x++) {
+                /*A source column of the block is a part of a destination row*/
+                lv_color_t * d = &dest[(uint32_t)(w - 1 - x) * h + by];
+                const lv_color_t * s = &src[(uint32_t)by * w + x];
+                for(y = by; y < by_end; y++) {
+                    *d = *s;
+                    d++;
+                    s += w;
+                }
+            }
+        }
+    }
+}
+
+#endif /*USE_LV_DISP_ROT*/
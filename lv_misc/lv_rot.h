@@ -0,0 +1,88 @@
+/**
+ * @file lv_rot.h
+ * Rotate color maps and areas by 90, 180 or 270 degrees
+ */
+
+#ifndef LV_ROT_H
+#define LV_ROT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifdef LV_CONF_INCLUDE_SIMPLE
+#include "lv_conf.h"
+#else
+#include "../../lv_conf.h"
+#endif
+
+#if USE_LV_DISP_ROT
+
+#include <stdint.h>
+#include "lv_color.h"
+#include "lv_area.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Clockwise rotations*/
+enum {
+    LV_ROT_NONE = 0,
+    LV_ROT_90,
+    LV_ROT_180,
+    LV_ROT_270,
+};
+typedef uint8_t lv_rot_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Rotate a color map
+ * @param dest buffer for the rotated map. Its width is `h` with `LV_ROT_90` and `LV_ROT_270`.
+ *             It can't overlap with `src`.
+ * @param src the color map to rotate
+ * @param w width of `src`
+ * @param h height of `src`
+ * @param rot rotation from `LV_ROT_...`
+ */
+void lv_rot_map(lv_color_t * dest, const lv_color_t * src, lv_coord_t w, lv_coord_t h, lv_rot_t rot);
+
+/**
+ * Rotate an area together with the space it is in
+ * @param area pointer to an area to rotate. The result is stored here too.
+ * @param w width of the space (e.g. horizontal resolution)
+ * @param h height of the space (e.g. vertical resolution)
+ * @param rot rotation from `LV_ROT_...`
+ */
+void lv_rot_area(lv_area_t * area, lv_coord_t w, lv_coord_t h, lv_rot_t rot);
+
+/**
+ * Rotate an area back to where it was before `lv_rot_area`
+ * @param area pointer to a rotated area. The result is stored here too.
+ * @param w width of the space before the rotation (the same as with `lv_rot_area`)
+ * @param h height of the space before the rotation (the same as with `lv_rot_area`)
+ * @param rot the rotation which was applied from `LV_ROT_...`
+ */
+void lv_rot_area_inv(lv_area_t * area, lv_coord_t w, lv_coord_t h, lv_rot_t rot);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*USE_LV_DISP_ROT*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_ROT_H*/
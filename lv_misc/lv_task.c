@@ -11,6 +11,7 @@
 #include "lv_task.h"
 #include "../lv_hal/lv_hal_tick.h"
 #include "lv_gc.h"
+#include "lv_trace.h"
 
 #if defined(LV_GC_INCLUDE)
 #   include LV_GC_INCLUDE
@@ -69,13 +70,14 @@ LV_ATTRIBUTE_TASK_HANDLER void lv_task_handler(void)
     if(task_handler_mutex) return;
     task_handler_mutex = true;
 
+    /*Measure in microseconds because a task handler run is typically shorter than 1 ms*/
     static uint32_t idle_period_start = 0;
     static uint32_t handler_start = 0;
     static uint32_t busy_time = 0;
 
     if(lv_task_run == false) return;
 
-    handler_start = lv_tick_get();
+    handler_start = lv_tick_get_us();
 
     /* Run all task from the highest to the lowest priority
      * If a lower priority task is executed check task again from the highest priority
@@ -136,14 +138,14 @@ LV_ATTRIBUTE_TASK_HANDLER void lv_task_handler(void)
         }
     } while(!end_flag);
 
-    busy_time += lv_tick_elaps(handler_start);
-    uint32_t idle_period_time = lv_tick_elaps(idle_period_start);
-    if(idle_period_time >= IDLE_MEAS_PERIOD) {
+    busy_time += lv_tick_elaps_us(handler_start);
+    uint32_t idle_period_time = lv_tick_elaps_us(idle_period_start);
+    if(idle_period_time >= IDLE_MEAS_PERIOD * 1000) {
 
-        idle_last = (uint32_t)((uint32_t)busy_time * 100) / IDLE_MEAS_PERIOD;   /*Calculate the busy percentage*/
-        idle_last = idle_last > 100 ? 0 : 100 - idle_last;                      /*But we need idle time*/
+        uint32_t busy_prc = busy_time / (idle_period_time / 100);               /*Calculate the busy percentage*/
+        idle_last = busy_prc > 100 ? 0 : 100 - busy_prc;                        /*But we need idle time*/
         busy_time = 0;
-        idle_period_start = lv_tick_get();
+        idle_period_start = lv_tick_get_us();
 
 
     }
@@ -316,7 +318,9 @@ static bool lv_task_exec(lv_task_t * lv_task_p)
         lv_task_p->last_run = lv_tick_get();
         task_deleted = false;
         task_created = false;
+        LV_TRACE_BEGIN(LV_TRACE_EVT_TASK, lv_task_p->prio);
         lv_task_p->task(lv_task_p->param);
+        LV_TRACE_END(LV_TRACE_EVT_TASK, 0);
 
         /*Delete if it was a one shot lv_task*/
         if(task_deleted == false) {			/*The task might be deleted by itself as well*/
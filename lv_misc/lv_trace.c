@@ -0,0 +1,159 @@
+/**
+ * @file lv_trace.c
+ * Binary trace ring buffer
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_trace.h"
+#if USE_LV_TRACE
+
+#include <stddef.h>
+#include "../lv_hal/lv_hal_tick.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_trace_rec_t trace_buf[LV_TRACE_BUF_SIZE];
+static uint32_t trace_wr;           /*Index of the next record to write*/
+static uint32_t trace_cnt;          /*Number of valid records*/
+static bool trace_en = true;
+static uint32_t (*time_cb)(void);
+static uint32_t time_freq = 1000000;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Enable or disable the recording of events. Recording is enabled by default.
+ * @param en true: record the events; false: ignore the events
+ */
+void lv_trace_enable(bool en)
+{
+    trace_en = en;
+}
+
+/**
+ * Set a custom time source for the time stamps (`lv_tick_get_us` is used by default)
+ * @param cb a function returning the current time, NULL to use `lv_tick_get_us`
+ * @param freq time units per second of `cb` (e.g. 1000000 for microseconds)
+ */
+void lv_trace_set_time_cb(uint32_t (*cb)(void), uint32_t freq)
+{
+    time_cb = cb;
+    time_freq = cb ? freq : 1000000;
+}
+
+/**
+ * Add an event to the ring buffer. If the buffer is full the oldest event is overwritten.
+ * Use the `LV_TRACE_BEGIN/END/INSTANT` macros instead to let them removed when `USE_LV_TRACE == 0`
+ * @param evt ID of the event (`LV_TRACE_EVT_...`)
+ * @param phase begin, end or instant (`LV_TRACE_PHASE_...`)
+ * @param payload an event specific number
+ */
+void lv_trace_add(lv_trace_evt_t evt, lv_trace_phase_t phase, int32_t payload)
+{
+    if(trace_en == false) return;
+
+    lv_trace_rec_t * rec = &trace_buf[trace_wr];
+    rec->time = time_cb ? time_cb() : lv_tick_get_us();
+    rec->payload = payload;
+    rec->evt = evt;
+    rec->phase = phase;
+    rec->reserved = 0;
+
+    trace_wr++;
+    if(trace_wr >= LV_TRACE_BUF_SIZE) trace_wr = 0;
+    if(trace_cnt < LV_TRACE_BUF_SIZE) trace_cnt++;
+}
+
+/**
+ * Remove all records from the buffer
+ */
+void lv_trace_clear(void)
+{
+    trace_wr = 0;
+    trace_cnt = 0;
+}
+
+/**
+ * Get the number of records in the buffer
+ * @return number of stored records
+ */
+uint32_t lv_trace_get_cnt(void)
+{
+    return trace_cnt;
+}
+
+/**
+ * Get a record from the buffer
+ * @param id index of the record. 0: the oldest, `lv_trace_get_cnt() - 1`: the latest
+ * @return pointer to the record or NULL if `id` is invalid
+ */
+const lv_trace_rec_t * lv_trace_get_rec(uint32_t id)
+{
+    if(id >= trace_cnt) return NULL;
+
+    /*The oldest record is at `trace_wr` if the buffer is already wrapped around*/
+    uint32_t first = trace_cnt < LV_TRACE_BUF_SIZE ? 0 : trace_wr;
+    id += first;
+    if(id >= LV_TRACE_BUF_SIZE) id -= LV_TRACE_BUF_SIZE;
+
+    return &trace_buf[id];
+}
+
+/**
+ * Write the content of the buffer (a `lv_trace_header_t` and the records from the oldest)
+ * with a callback. The output can be converted to Chrome trace JSON with `lv_trace_decoder.py`
+ * @param write_cb called with chunks of the binary data (e.g. write to a file or UART)
+ */
+void lv_trace_dump(void (*write_cb)(const void * data, uint32_t len))
+{
+    if(write_cb == NULL) return;
+
+    /*Don't record new events while dumping*/
+    bool en_save = trace_en;
+    trace_en = false;
+
+    lv_trace_header_t header;
+    header.magic = LV_TRACE_MAGIC;
+    header.version = LV_TRACE_VERSION;
+    header.rec_size = sizeof(lv_trace_rec_t);
+    header.rec_cnt = trace_cnt;
+    header.time_freq = time_freq;
+    write_cb(&header, sizeof(header));
+
+    /*Write the records in max. two chunks: from the oldest to the end of the buffer and from the start*/
+    if(trace_cnt < LV_TRACE_BUF_SIZE) {
+        if(trace_cnt) write_cb(trace_buf, trace_cnt * sizeof(lv_trace_rec_t));
+    } else {
+        write_cb(&trace_buf[trace_wr], (LV_TRACE_BUF_SIZE - trace_wr) * sizeof(lv_trace_rec_t));
+        if(trace_wr) write_cb(trace_buf, trace_wr * sizeof(lv_trace_rec_t));
+    }
+
+    trace_en = en_save;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#endif /*USE_LV_TRACE*/
@@ -0,0 +1,151 @@
+/**
+ * @file lv_trace.h
+ * Binary trace ring buffer. Records compact begin/end/instant events
+ * with a time stamp and a small integer payload without any string formatting.
+ */
+
+#ifndef LV_TRACE_H
+#define LV_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifdef LV_CONF_INCLUDE_SIMPLE
+#include "lv_conf.h"
+#else
+#include "../../lv_conf.h"
+#endif
+#include <stdint.h>
+#include <stdbool.h>
+
+#if USE_LV_TRACE
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_TRACE_MAGIC      0x5254564C      /*"LVTR" in little endian*/
+#define LV_TRACE_VERSION    1
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Built-in event IDs. The application can add its own from `LV_TRACE_EVT_USER`*/
+enum
+{
+    LV_TRACE_EVT_NONE = 0,
+    LV_TRACE_EVT_REFR,          /*A whole `lv_refr_task` run. Payload: number of invalid areas*/
+    LV_TRACE_EVT_REFR_AREA,     /*Refreshing a joined area. Payload: area size in pixels*/
+    LV_TRACE_EVT_DESIGN,        /*A design function call. Payload: `lv_design_mode_t`*/
+    LV_TRACE_EVT_TASK,          /*An `lv_task` execution. Payload: priority of the task*/
+    LV_TRACE_EVT_FLUSH,         /*`disp_flush` of the driver. Payload: number of pixels*/
+    LV_TRACE_EVT_INDEV_READ,    /*`read` of an input device driver. Payload: the return value of `read`*/
+    LV_TRACE_EVT_USER = 0x100,  /*First ID for application specific events*/
+};
+typedef uint16_t lv_trace_evt_t;
+
+enum
+{
+    LV_TRACE_PHASE_BEGIN = 0,
+    LV_TRACE_PHASE_END,
+    LV_TRACE_PHASE_INSTANT,
+};
+typedef uint8_t lv_trace_phase_t;
+
+/*One record in the ring buffer (12 bytes)*/
+typedef struct
+{
+    uint32_t time;              /*Time stamp in the units of the time source*/
+    int32_t payload;            /*Event specific small integer*/
+    lv_trace_evt_t evt;
+    lv_trace_phase_t phase;
+    uint8_t reserved;
+} lv_trace_rec_t;
+
+/*Header written by `lv_trace_dump` before the records*/
+typedef struct
+{
+    uint32_t magic;             /*LV_TRACE_MAGIC*/
+    uint16_t version;           /*LV_TRACE_VERSION*/
+    uint16_t rec_size;          /*sizeof(lv_trace_rec_t)*/
+    uint32_t rec_cnt;           /*Number of records following the header*/
+    uint32_t time_freq;         /*Time stamp units per second (e.g. 1000 for milliseconds)*/
+} lv_trace_header_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Enable or disable the recording of events. Recording is enabled by default.
+ * @param en true: record the events; false: ignore the events
+ */
+void lv_trace_enable(bool en);
+
+/**
+ * Set a custom time source for the time stamps (`lv_tick_get_us` is used by default)
+ * @param time_cb a function returning the current time, NULL to use `lv_tick_get_us`
+ * @param time_freq time units per second of `time_cb` (e.g. 1000000 for microseconds)
+ */
+void lv_trace_set_time_cb(uint32_t (*time_cb)(void), uint32_t time_freq);
+
+/**
+ * Add an event to the ring buffer. If the buffer is full the oldest event is overwritten.
+ * Use the `LV_TRACE_BEGIN/END/INSTANT` macros instead to let them removed when `USE_LV_TRACE == 0`
+ * @param evt ID of the event (`LV_TRACE_EVT_...`)
+ * @param phase begin, end or instant (`LV_TRACE_PHASE_...`)
+ * @param payload an event specific number
+ */
+void lv_trace_add(lv_trace_evt_t evt, lv_trace_phase_t phase, int32_t payload);
+
+/**
+ * Remove all records from the buffer
+ */
+void lv_trace_clear(void);
+
+/**
+ * Get the number of records in the buffer
+ * @return number of stored records
+ */
+uint32_t lv_trace_get_cnt(void);
+
+/**
+ * Get a record from the buffer
+ * @param id index of the record. 0: the oldest, `lv_trace_get_cnt() - 1`: the latest
+ * @return pointer to the record or NULL if `id` is invalid
+ */
+const lv_trace_rec_t * lv_trace_get_rec(uint32_t id);
+
+/**
+ * Write the content of the buffer (a `lv_trace_header_t` and the records from the oldest)
+ * with a callback. The output can be converted to Chrome trace JSON with `lv_trace_decoder.py`
+ * @param write_cb called with chunks of the binary data (e.g. write to a file or UART)
+ */
+void lv_trace_dump(void (*write_cb)(const void * data, uint32_t len));
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define LV_TRACE_BEGIN(evt, payload)    lv_trace_add(evt, LV_TRACE_PHASE_BEGIN, payload)
+#define LV_TRACE_END(evt, payload)      lv_trace_add(evt, LV_TRACE_PHASE_END, payload)
+#define LV_TRACE_INSTANT(evt, payload)  lv_trace_add(evt, LV_TRACE_PHASE_INSTANT, payload)
+
+#else /*USE_LV_TRACE*/
+
+/*Do nothing if `USE_LV_TRACE  0`*/
+#define LV_TRACE_BEGIN(evt, payload)    {;}
+#define LV_TRACE_END(evt, payload)      {;}
+#define LV_TRACE_INSTANT(evt, payload)  {;}
+
+#endif /*USE_LV_TRACE*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_TRACE_H*/
@@ -10,6 +10,7 @@
 #include "lv_arc.h"
 #if USE_LV_ARC != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_misc/lv_math.h"
 #include "../lv_draw/lv_draw_arc.h"
 #include "../lv_themes/lv_theme.h"
@@ -18,6 +19,8 @@
 /*********************
  *      DEFINES
  *********************/
+/*The angle `a` [0..360) measured from the `ref` angle*/
+#define LV_ARC_REL_ANGLE(a, ref)    ((a) >= (ref) ? (a) - (ref) : (a) + 360 - (ref))
 
 /**********************
  *      TYPEDEFS
@@ -28,6 +31,7 @@
  **********************/
 static bool lv_arc_design(lv_obj_t * arc, const lv_area_t * mask, lv_design_mode_t mode);
 static lv_res_t lv_arc_signal(lv_obj_t * arc, lv_signal_t sign, void * param);
+static void lv_arc_invalidate_sector(lv_obj_t * arc, int16_t start, int16_t end);
 
 /**********************
  *  STATIC VARIABLES
@@ -64,12 +68,19 @@ lv_obj_t * lv_arc_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(ext);
     if(ext == NULL) return NULL;
 
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_arc);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_arc);
+        lv_signal_reg(lv_arc_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
     if(ancestor_design == NULL) ancestor_design = lv_obj_get_design_func(new_arc);
 
     /*Initialize the allocated 'ext' */
     ext->angle_start = 45;
     ext->angle_end = 315;
+    ext->angle_map = NULL;
+    ext->angle_map_r = 0;
+    ext->angle_cache = 0;
 
     /*The signal and design functions are not copied so set them here*/
     lv_obj_set_signal_func(new_arc, lv_arc_signal);
@@ -91,6 +102,7 @@ lv_obj_t * lv_arc_create(lv_obj_t * par, const lv_obj_t * copy)
         lv_arc_ext_t * copy_ext = lv_obj_get_ext_attr(copy);
         ext->angle_start = copy_ext->angle_start;
         ext->angle_end = copy_ext->angle_end;
+        ext->angle_cache = copy_ext->angle_cache;
 
         /*Refresh the style with new signal function*/
         lv_obj_refresh_style(new_arc);
@@ -127,10 +139,57 @@ void lv_arc_set_angles(lv_obj_t * arc, uint16_t start, uint16_t end)
     if(start > 360) start = 360;
     if(end > 360) end = 360;
 
+    uint16_t old_start = ext->angle_start;
+    uint16_t old_end = ext->angle_end;
+    if(old_start == start && old_end == end) return;
+
     ext->angle_start = start;
     ext->angle_end = end;
 
-    lv_obj_invalidate(arc);
+    /*360 deg and equal start and end angles are special cases so simply redraw everything*/
+    if(old_start == old_end || start == end || old_start == 360 || old_end == 360 || start == 360 || end == 360) {
+        lv_obj_invalidate(arc);
+        return;
+    }
+
+    /* Measure the angles from the old or the new start angle to handle the arcs going through 0 deg too
+     * (e.g. spinning arcs). If none of the arcs goes through the reference angle only the sectors
+     * between the old and new start and end angles can change. Else the arc "turns over" and everything can change.*/
+    uint16_t ref = old_start;
+    if(LV_ARC_REL_ANGLE(start, ref) > LV_ARC_REL_ANGLE(end, ref)) ref = start;
+
+    int16_t old_start_rel = LV_ARC_REL_ANGLE(old_start, ref);
+    int16_t old_end_rel = LV_ARC_REL_ANGLE(old_end, ref);
+    int16_t start_rel = LV_ARC_REL_ANGLE(start, ref);
+    int16_t end_rel = LV_ARC_REL_ANGLE(end, ref);
+
+    if(old_start_rel > old_end_rel || start_rel > end_rel) {
+        lv_obj_invalidate(arc);
+    } else {
+        if(old_start != start) lv_arc_invalidate_sector(arc, LV_MATH_MIN(old_start_rel, start_rel) + ref,
+                                                            LV_MATH_MAX(old_start_rel, start_rel) + ref);
+        if(old_end != end) lv_arc_invalidate_sector(arc, LV_MATH_MIN(old_end_rel, end_rel) + ref,
+                                                        LV_MATH_MAX(old_end_rel, end_rel) + ref);
+    }
+}
+
+/**
+ * Enable or disable the caching of the pixel angles. With cache the angle of the pixels is
+ * calculated only once (needs radius^2 bytes RAM) which speeds up the drawing of continuously
+ * changing arcs (e.g. pre loaders).
+ * @param arc pointer to an arc object
+ * @param en true: enable the cache; false: disable it and free the cached angles
+ */
+void lv_arc_set_angle_cache(lv_obj_t * arc, bool en)
+{
+    lv_arc_ext_t * ext = lv_obj_get_ext_attr(arc);
+
+    ext->angle_cache = en ? 1 : 0;
+    if(en == false && ext->angle_map) {
+        lv_mem_free(ext->angle_map);
+        ext->angle_map = NULL;
+        ext->angle_map_r = 0;
+    }
 }
 
 /**
@@ -176,6 +235,17 @@ uint16_t lv_arc_get_angle_end(lv_obj_t * arc)
     return ext->angle_end;
 }
 
+/**
+ * Get whether the pixel angles are cached
+ * @param arc pointer to an arc object
+ * @return true: the cache is enabled
+ */
+bool lv_arc_get_angle_cache(const lv_obj_t * arc)
+{
+    lv_arc_ext_t * ext = lv_obj_get_ext_attr(arc);
+    return ext->angle_cache == 0 ? false : true;
+}
+
 /**
  * Get style of a arc.
  * @param arc pointer to arc object
@@ -235,7 +305,25 @@ static bool lv_arc_design(lv_obj_t * arc, const lv_area_t * mask, lv_design_mode
         lv_coord_t x = arc->coords.x1 + lv_obj_get_width(arc) / 2;
         lv_coord_t y = arc->coords.y1 + lv_obj_get_height(arc) / 2;
         lv_opa_t opa_scale = lv_obj_get_opa_scale(arc);
-        lv_draw_arc(x, y, r, mask, ext->angle_start, ext->angle_end, style, opa_scale);
+
+        /*Calculate the angles of the pixels only once if enabled*/
+        if(ext->angle_cache && ext->angle_map_r != r && r > 0) {
+            if(ext->angle_map) lv_mem_free(ext->angle_map);
+            ext->angle_map = lv_mem_alloc(LV_DRAW_ARC_ANGLE_MAP_SIZE(r));
+            lv_mem_assert(ext->angle_map);
+            if(ext->angle_map) {
+                lv_draw_arc_fill_angle_map(ext->angle_map, r);
+                ext->angle_map_r = r;
+            } else {
+                ext->angle_map_r = 0;
+            }
+        }
+
+        if(ext->angle_cache && ext->angle_map && ext->angle_map_r == r) {
+            lv_draw_arc_cached(x, y, r, mask, ext->angle_start, ext->angle_end, style, opa_scale, ext->angle_map);
+        } else {
+            lv_draw_arc(x, y, r, mask, ext->angle_start, ext->angle_end, style, opa_scale);
+        }
 
 
         /*Draw circle on the ends if enabled */
@@ -277,6 +365,70 @@ static bool lv_arc_design(lv_obj_t * arc, const lv_area_t * mask, lv_design_mode
     return true;
 }
 
+/**
+ * Invalidate the bounding box of a sector of an arc
+ * @param arc pointer to an arc object
+ * @param start start angle of the sector
+ * @param end end angle of the sector (>= `start`)
+ */
+static void lv_arc_invalidate_sector(lv_obj_t * arc, int16_t start, int16_t end)
+{
+    lv_obj_update_coords(arc);
+    lv_style_t * style = lv_arc_get_style(arc, LV_ARC_STYLE_MAIN);
+
+    /*Same geometry as in the design function*/
+    lv_coord_t r_out = (LV_MATH_MIN(lv_obj_get_width(arc), lv_obj_get_height(arc))) / 2;
+    lv_coord_t r_in = r_out - style->line.width;
+    if(r_in < 0) r_in = 0;
+    lv_coord_t x = arc->coords.x1 + lv_obj_get_width(arc) / 2;
+    lv_coord_t y = arc->coords.y1 + lv_obj_get_height(arc) / 2;
+
+    /*The pixels are assigned to integer degrees so add 1 degree on both sides*/
+    start--;
+    end++;
+
+    /*The end points on the outer and inner radius*/
+    lv_area_t area;
+    area.x1 = LV_COORD_MAX;
+    area.y1 = LV_COORD_MAX;
+    area.x2 = LV_COORD_MIN;
+    area.y2 = LV_COORD_MIN;
+
+    int16_t angles[2] = {start, end};
+    lv_coord_t radii[2] = {r_out, r_in};
+    uint8_t i;
+    uint8_t j;
+    for(i = 0; i < 2; i++) {
+        for(j = 0; j < 2; j++) {
+            lv_coord_t px = (radii[j] * lv_trigo_sin(angles[i])) >> LV_TRIGO_SHIFT;
+            lv_coord_t py = (radii[j] * lv_trigo_sin(angles[i] + 90)) >> LV_TRIGO_SHIFT;
+            area.x1 = LV_MATH_MIN(area.x1, px);
+            area.y1 = LV_MATH_MIN(area.y1, py);
+            area.x2 = LV_MATH_MAX(area.x2, px);
+            area.y2 = LV_MATH_MAX(area.y2, py);
+        }
+    }
+
+    /*The extreme points on the axes if they are in the sector (0: bottom, 90: right, 180: top, 270: left)*/
+    int16_t a;
+    for(a = 0; a <= 360 + 270; a += 90) {
+        if(a < start || a > end) continue;
+        if(a % 360 == 0) area.y2 = r_out;
+        else if(a % 360 == 90) area.x2 = r_out;
+        else if(a % 360 == 180) area.y1 = -r_out;
+        else area.x1 = -r_out;
+    }
+
+    /*Add the rounded ends and some extra space for the rounding*/
+    lv_coord_t ext_size = style->line.width / 2 + 2;
+    area.x1 += x - ext_size;
+    area.y1 += y - ext_size;
+    area.x2 += x + ext_size;
+    area.y2 += y + ext_size;
+
+    lv_obj_invalidate_area(arc, &area);
+}
+
 /**
  * Signal function of the arc
  * @param arc pointer to a arc object
@@ -289,12 +441,16 @@ static lv_res_t lv_arc_signal(lv_obj_t * arc, lv_signal_t sign, void * param)
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(arc, sign, param);
+    res = lv_signal_call(ancestor_signal, arc, sign, param);
     if(res != LV_RES_OK) return res;
 
 
     if(sign == LV_SIGNAL_CLEANUP) {
-        /*Nothing to cleanup. (No dynamically allocated memory in 'ext')*/
+        lv_arc_ext_t * ext = lv_obj_get_ext_attr(arc);
+        if(ext->angle_map) {
+            lv_mem_free(ext->angle_map);
+            ext->angle_map = NULL;
+        }
     } else if(sign == LV_SIGNAL_GET_TYPE) {
         lv_obj_type_t * buf = param;
         uint8_t i;
@@ -36,6 +36,9 @@ typedef struct {
     /*New data for this type */
     lv_coord_t angle_start;
     lv_coord_t angle_end;
+    uint8_t * angle_map;        /*Pre-calculated angles of the pixels (Handled by the library)*/
+    uint16_t angle_map_r;       /*The radius `angle_map` was calculated for*/
+    uint8_t angle_cache :1;     /*1: draw the arc with pre-calculated pixel angles*/
 } lv_arc_ext_t;
 
 
@@ -76,6 +79,15 @@ lv_obj_t * lv_arc_create(lv_obj_t * par, const lv_obj_t * copy);
  */
 void lv_arc_set_angles(lv_obj_t * arc, uint16_t start, uint16_t end);
 
+/**
+ * Enable or disable the caching of the pixel angles. With cache the angle of the pixels is
+ * calculated only once (needs radius^2 bytes RAM) which speeds up the drawing of continuously
+ * changing arcs (e.g. pre loaders).
+ * @param arc pointer to an arc object
+ * @param en true: enable the cache; false: disable it and free the cached angles
+ */
+void lv_arc_set_angle_cache(lv_obj_t * arc, bool en);
+
 /**
  * Set a style of a arc.
  * @param arc pointer to arc object
@@ -102,6 +114,13 @@ uint16_t lv_arc_get_angle_start(lv_obj_t * arc);
  */
 uint16_t lv_arc_get_angle_end(lv_obj_t * arc);
 
+/**
+ * Get whether the pixel angles are cached
+ * @param arc pointer to an arc object
+ * @return true: the cache is enabled
+ */
+bool lv_arc_get_angle_cache(const lv_obj_t * arc);
+
 /**
  * Get style of a arc.
  * @param arc pointer to arc object
@@ -11,9 +11,11 @@
 #include "lv_bar.h"
 #if USE_LV_BAR != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_draw/lv_draw.h"
 #include "../lv_themes/lv_theme.h"
 #include "../lv_misc/lv_anim.h"
+#include "../lv_misc/lv_math.h"
 #include <stdio.h>
 
 /*********************
@@ -29,6 +31,8 @@
  **********************/
 static bool lv_bar_design(lv_obj_t * bar, const lv_area_t * mask, lv_design_mode_t mode);
 static lv_res_t lv_bar_signal(lv_obj_t * bar, lv_signal_t sign, void * param);
+static bool lv_bar_get_indic_area(const lv_obj_t * bar, int16_t value, lv_area_t * indic_area);
+static void lv_bar_invalidate_value(lv_obj_t * bar, int16_t old_value);
 
 /**********************
  *  STATIC VARIABLES
@@ -59,7 +63,11 @@ lv_obj_t * lv_bar_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(new_bar);
     if(new_bar == NULL) return NULL;
 
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_bar);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_bar);
+        lv_signal_reg(lv_bar_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_REFR_EXT_SIZE) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
     if(ancestor_design_f == NULL) ancestor_design_f = lv_obj_get_design_func(new_bar);
 
     /*Allocate the object type specific extended data*/
@@ -121,9 +129,10 @@ void lv_bar_set_value(lv_obj_t * bar, int16_t value)
     lv_bar_ext_t * ext = lv_obj_get_ext_attr(bar);
     if(ext->cur_value == value) return;
 
+    int16_t old_value = ext->cur_value;
     ext->cur_value = value > ext->max_value ? ext->max_value : value;
     ext->cur_value = ext->cur_value < ext->min_value ? ext->min_value : ext->cur_value;
-    lv_obj_invalidate(bar);
+    lv_bar_invalidate_value(bar, old_value);
 }
 
 #if USE_LV_ANIMATION
@@ -330,49 +339,9 @@ static bool lv_bar_design(lv_obj_t * bar, const lv_area_t * mask, lv_design_mode
 #endif
         lv_bar_ext_t * ext = lv_obj_get_ext_attr(bar);
 
-        if(ext->cur_value != ext->min_value || ext->sym) {
+        lv_area_t indic_area;
+        if(lv_bar_get_indic_area(bar, ext->cur_value, &indic_area)) {
             lv_style_t * style_indic = lv_bar_get_style(bar, LV_BAR_STYLE_INDIC);
-            lv_area_t indic_area;
-            lv_area_copy(&indic_area, &bar->coords);
-            indic_area.x1 += style_indic->body.padding.hor;
-            indic_area.x2 -= style_indic->body.padding.hor;
-            indic_area.y1 += style_indic->body.padding.ver;
-            indic_area.y2 -= style_indic->body.padding.ver;
-
-            lv_coord_t w = lv_area_get_width(&indic_area);
-            lv_coord_t h = lv_area_get_height(&indic_area);
-
-            if(w >= h) {
-                /*Horizontal*/
-                indic_area.x2 = (int32_t)((int32_t)w * (ext->cur_value - ext->min_value)) / (ext->max_value - ext->min_value);
-                indic_area.x2 = indic_area.x1 + indic_area.x2 - 1;
-
-                if(ext->sym && ext->min_value < 0 && ext->max_value > 0) {
-                    /*Calculate the coordinate of the zero point*/
-                    lv_coord_t zero;
-                    zero = indic_area.x1 + (-ext->min_value * w) / (ext->max_value - ext->min_value);
-                    if(indic_area.x2 > zero) indic_area.x1 = zero;
-                    else {
-                        indic_area.x1 = indic_area.x2;
-                        indic_area.x2 = zero;
-                    }
-                }
-            } else {
-                indic_area.y1 = (int32_t)((int32_t)h * (ext->cur_value - ext->min_value)) / (ext->max_value - ext->min_value);
-                indic_area.y1 = indic_area.y2 - indic_area.y1 + 1;
-
-                if(ext->sym && ext->min_value < 0 && ext->max_value > 0) {
-                    /*Calculate the coordinate of the zero point*/
-                    lv_coord_t zero;
-                    zero = indic_area.y2 - (-ext->min_value * h) / (ext->max_value - ext->min_value);
-                    if(indic_area.y1 < zero) indic_area.y2 = zero;
-                    else {
-                        indic_area.y2 = indic_area.y1;
-                        indic_area.y1 = zero;
-                    }
-                }
-            }
-
 
             /*Draw the indicator*/
             lv_draw_rect(&indic_area, mask, style_indic, opa_scale);
@@ -395,6 +364,152 @@ static bool lv_bar_design(lv_obj_t * bar, const lv_area_t * mask, lv_design_mode
     return true;
 }
 
+/**
+ * Get the area of the indicator of a bar with a given value
+ * @param bar pointer to a bar object
+ * @param value get the indicator of this value
+ * @param indic_area store the area of the indicator here
+ * @return true: the indicator is drawn; false: the indicator is not visible with this value
+ */
+static bool lv_bar_get_indic_area(const lv_obj_t * bar, int16_t value, lv_area_t * indic_area)
+{
+    lv_bar_ext_t * ext = lv_obj_get_ext_attr(bar);
+    if(value == ext->min_value && ext->sym == 0) return false;
+
+    lv_style_t * style_indic = lv_bar_get_style(bar, LV_BAR_STYLE_INDIC);
+    lv_area_copy(indic_area, &bar->coords);
+    indic_area->x1 += style_indic->body.padding.hor;
+    indic_area->x2 -= style_indic->body.padding.hor;
+    indic_area->y1 += style_indic->body.padding.ver;
+    indic_area->y2 -= style_indic->body.padding.ver;
+
+    lv_coord_t w = lv_area_get_width(indic_area);
+    lv_coord_t h = lv_area_get_height(indic_area);
+
+    if(w >= h) {
+        /*Horizontal*/
+        indic_area->x2 = (int32_t)((int32_t)w * (value - ext->min_value)) / (ext->max_value - ext->min_value);
+        indic_area->x2 = indic_area->x1 + indic_area->x2 - 1;
+
+        if(ext->sym && ext->min_value < 0 && ext->max_value > 0) {
+            /*Calculate the coordinate of the zero point*/
+            lv_coord_t zero;
+            zero = indic_area->x1 + (-ext->min_value * w) / (ext->max_value - ext->min_value);
+            if(indic_area->x2 > zero) indic_area->x1 = zero;
+            else {
+                indic_area->x1 = indic_area->x2;
+                indic_area->x2 = zero;
+            }
+        }
+    } else {
+        indic_area->y1 = (int32_t)((int32_t)h * (value - ext->min_value)) / (ext->max_value - ext->min_value);
+        indic_area->y1 = indic_area->y2 - indic_area->y1 + 1;
+
+        if(ext->sym && ext->min_value < 0 && ext->max_value > 0) {
+            /*Calculate the coordinate of the zero point*/
+            lv_coord_t zero;
+            zero = indic_area->y2 - (-ext->min_value * h) / (ext->max_value - ext->min_value);
+            if(indic_area->y1 < zero) indic_area->y2 = zero;
+            else {
+                indic_area->y2 = indic_area->y1;
+                indic_area->y1 = zero;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Invalidate only the part of a bar which is changed by a new value:
+ * the segment between the old and new end of the indicator.
+ * @param bar pointer to a bar object
+ * @param old_value the value before the change (the new value is already set)
+ */
+static void lv_bar_invalidate_value(lv_obj_t * bar, int16_t old_value)
+{
+    /*The derived objects (e.g. slider) draw more things which depend on the value*/
+    if(lv_obj_get_design_func(bar) != lv_bar_design) {
+        lv_obj_invalidate(bar);
+        return;
+    }
+
+    lv_obj_update_coords(bar);
+
+    lv_bar_ext_t * ext = lv_obj_get_ext_attr(bar);
+    lv_area_t old_area;
+    lv_area_t new_area;
+    bool old_vis = lv_bar_get_indic_area(bar, old_value, &old_area);
+    bool new_vis = lv_bar_get_indic_area(bar, ext->cur_value, &new_area);
+    if(old_vis == false && new_vis == false) return;
+
+    lv_style_t * style_indic = lv_bar_get_style(bar, LV_BAR_STYLE_INDIC);
+    lv_coord_t ext_size = style_indic->body.shadow.width + 1;   /*+1 for anti-aliasing*/
+    lv_area_t * area_ref = new_vis ? &new_area : &old_area;
+    bool hor = lv_area_get_width(&bar->coords) - 2 * style_indic->body.padding.hor >=
+               lv_area_get_height(&bar->coords) - 2 * style_indic->body.padding.ver;
+
+    /*The rounded ends of the indicator are redrawn too*/
+    lv_coord_t r = style_indic->body.radius;
+    lv_coord_t cross = hor ? lv_area_get_height(area_ref) : lv_area_get_width(area_ref);
+    if(r > cross / 2) r = cross / 2;
+
+    /*Redraw the whole indicators if the value changes their look not only their length:
+     * they appear/disappear, they are too short for the radius or the gradient runs along them*/
+    bool full = false;
+    if(old_vis == false || new_vis == false) full = true;
+    else if(hor && (lv_area_get_width(&old_area) <= 2 * r || lv_area_get_width(&new_area) <= 2 * r)) full = true;
+    else if(!hor && (lv_area_get_height(&old_area) <= 2 * r || lv_area_get_height(&new_area) <= 2 * r)) full = true;
+    else if(!hor && style_indic->body.main_color.full != style_indic->body.grad_color.full) full = true;
+
+    lv_area_t inv_area;
+    if(full) {
+        if(old_vis && new_vis) lv_area_join(&inv_area, &old_area, &new_area);
+        else lv_area_copy(&inv_area, area_ref);
+        inv_area.x1 -= ext_size;
+        inv_area.y1 -= ext_size;
+        inv_area.x2 += ext_size;
+        inv_area.y2 += ext_size;
+        lv_obj_invalidate_area(bar, &inv_area);
+        return;
+    }
+
+    /*Invalidate a strip around the ends which moved (both can move with a symmetric bar)*/
+    lv_coord_t old_ends[2];
+    lv_coord_t new_ends[2];
+    if(hor) {
+        old_ends[0] = old_area.x1;
+        old_ends[1] = old_area.x2;
+        new_ends[0] = new_area.x1;
+        new_ends[1] = new_area.x2;
+        inv_area.y1 = new_area.y1 - ext_size;
+        inv_area.y2 = new_area.y2 + ext_size;
+    } else {
+        old_ends[0] = old_area.y1;
+        old_ends[1] = old_area.y2;
+        new_ends[0] = new_area.y1;
+        new_ends[1] = new_area.y2;
+        inv_area.x1 = new_area.x1 - ext_size;
+        inv_area.x2 = new_area.x2 + ext_size;
+    }
+
+    uint8_t i;
+    for(i = 0; i < 2; i++) {
+        if(old_ends[i] == new_ends[i]) continue;
+
+        lv_coord_t min = LV_MATH_MIN(old_ends[i], new_ends[i]) - r - ext_size;
+        lv_coord_t max = LV_MATH_MAX(old_ends[i], new_ends[i]) + r + ext_size;
+        if(hor) {
+            inv_area.x1 = min;
+            inv_area.x2 = max;
+        } else {
+            inv_area.y1 = min;
+            inv_area.y2 = max;
+        }
+        lv_obj_invalidate_area(bar, &inv_area);
+    }
+}
+
 /**
  * Signal function of the bar
  * @param bar pointer to a bar object
@@ -407,7 +522,7 @@ static lv_res_t lv_bar_signal(lv_obj_t * bar, lv_signal_t sign, void * param)
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(bar, sign, param);
+    res = lv_signal_call(ancestor_signal, bar, sign, param);
     if(res != LV_RES_OK) return res;
 
     if(sign == LV_SIGNAL_REFR_EXT_SIZE) {
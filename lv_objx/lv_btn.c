@@ -11,6 +11,7 @@
 #if USE_LV_BTN != 0
 
 #include <string.h>
+#include "../lv_core/lv_signal.h"
 #include "../lv_core/lv_group.h"
 #include "../lv_draw/lv_draw.h"
 #include "../lv_themes/lv_theme.h"
@@ -79,7 +80,15 @@ lv_obj_t * lv_btn_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(new_btn);
     if(new_btn == NULL) return NULL;
 
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_btn);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_btn);
+        lv_signal_reg(lv_btn_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_PRESSED) | LV_SIGNAL_BIT(LV_SIGNAL_PRESSING) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_PRESS_LOST) | LV_SIGNAL_BIT(LV_SIGNAL_RELEASED) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_LONG_PRESS) | LV_SIGNAL_BIT(LV_SIGNAL_LONG_PRESS_REP) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_CONTROLL));
+    }
     if(ancestor_design == NULL) ancestor_design = lv_obj_get_design_func(new_btn);
 
     /*Allocate the extended data*/
@@ -529,7 +538,7 @@ static lv_res_t lv_btn_signal(lv_obj_t * btn, lv_signal_t sign, void * param)
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(btn, sign, param);
+    res = lv_signal_call(ancestor_signal, btn, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_btn_ext_t * ext = lv_obj_get_ext_attr(btn);
@@ -9,6 +9,7 @@
 #include "lv_btnm.h"
 #if USE_LV_BTNM != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_core/lv_group.h"
 #include "../lv_draw/lv_draw.h"
 #include "../lv_core/lv_refr.h"
@@ -70,7 +71,16 @@ lv_obj_t * lv_btnm_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(new_btnm);
     if(new_btnm == NULL) return NULL;
 
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_btnm);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_btnm);
+        lv_signal_reg(lv_btnm_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_CORD_CHG) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_STYLE_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_PRESSING) | LV_SIGNAL_BIT(LV_SIGNAL_PRESS_LOST) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_RELEASED) | LV_SIGNAL_BIT(LV_SIGNAL_LONG_PRESS_REP) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_FOCUS) | LV_SIGNAL_BIT(LV_SIGNAL_DEFOCUS) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_CONTROLL) | LV_SIGNAL_BIT(LV_SIGNAL_GET_EDITABLE));
+    }
 
     /*Allocate the object type specific extended data*/
     lv_btnm_ext_t * ext = lv_obj_allocate_ext_attr(new_btnm, sizeof(lv_btnm_ext_t));
@@ -543,7 +553,7 @@ static lv_res_t lv_btnm_signal(lv_obj_t * btnm, lv_signal_t sign, void * param)
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(btnm, sign, param);
+    res = lv_signal_call(ancestor_signal, btnm, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_btnm_ext_t * ext = lv_obj_get_ext_attr(btnm);
@@ -9,6 +9,7 @@
 #include "lv_calendar.h"
 #if USE_LV_CALENDAR != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_draw/lv_draw.h"
 #include "../lv_hal/lv_hal_indev.h"
 #include "../lv_misc/lv_math.h"
@@ -87,7 +88,15 @@ lv_obj_t * lv_calendar_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_calendar_ext_t * ext = lv_obj_allocate_ext_attr(new_calendar, sizeof(lv_calendar_ext_t));
     lv_mem_assert(ext);
     if(ext == NULL) return NULL;
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_calendar);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_calendar);
+        lv_signal_reg(lv_calendar_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_PRESSED) | LV_SIGNAL_BIT(LV_SIGNAL_PRESSING) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_PRESS_LOST) | LV_SIGNAL_BIT(LV_SIGNAL_RELEASED) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_LONG_PRESS) | LV_SIGNAL_BIT(LV_SIGNAL_LONG_PRESS_REP) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_CONTROLL));
+    }
     if(ancestor_design == NULL) ancestor_design = lv_obj_get_design_func(new_calendar);
 
     /*Initialize the allocated 'ext' */
@@ -519,7 +528,7 @@ static lv_res_t lv_calendar_signal(lv_obj_t * calendar, lv_signal_t sign, void *
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(calendar, sign, param);
+    res = lv_signal_call(ancestor_signal, calendar, sign, param);
     if(res != LV_RES_OK) return res;
 
 
@@ -10,6 +10,8 @@
 #include "lv_canvas.h"
 #if USE_LV_CANVAS != 0
 
+#include "../lv_core/lv_signal.h"
+
 /*********************
  *      DEFINES
  *********************/
@@ -56,7 +58,11 @@ lv_obj_t * lv_canvas_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_canvas_ext_t * ext = lv_obj_allocate_ext_attr(new_canvas, sizeof(lv_canvas_ext_t));
     lv_mem_assert(ext);
     if(ext == NULL) return NULL;
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_canvas);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_canvas);
+        lv_signal_reg(lv_canvas_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
     if(ancestor_design == NULL) ancestor_design = lv_obj_get_design_func(new_canvas);
 
     /*Initialize the allocated 'ext' */
@@ -340,7 +346,7 @@ void lv_canvas_mult_buf(lv_obj_t * canvas, void * to_copy, lv_coord_t w, lv_coor
     lv_coord_t j;
     for(i = 0; i < h; i++) {
         for(j = 0; j < w; j++) {
-#if LV_COLOR_DEPTH == 32
+#if LV_COLOR_DEPTH == 24 || LV_COLOR_DEPTH == 32
             canvas_buf_color[j].red = (uint16_t) ((uint16_t) canvas_buf_color[j].red * copy_buf_color[j].red) >> 8;
             canvas_buf_color[j].green = (uint16_t) ((uint16_t) canvas_buf_color[j].green * copy_buf_color[j].green) >> 8;
             canvas_buf_color[j].blue = (uint16_t) ((uint16_t) canvas_buf_color[j].blue * copy_buf_color[j].blue) >> 8;
@@ -572,7 +578,7 @@ static lv_res_t lv_canvas_signal(lv_obj_t * canvas, lv_signal_t sign, void * par
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(canvas, sign, param);
+    res = lv_signal_call(ancestor_signal, canvas, sign, param);
     if(res != LV_RES_OK) return res;
 
     if(sign == LV_SIGNAL_CLEANUP) {
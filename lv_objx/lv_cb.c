@@ -9,6 +9,7 @@
 #include "lv_cb.h"
 #if USE_LV_CB != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_core/lv_group.h"
 #include "../lv_themes/lv_theme.h"
 
@@ -58,7 +59,13 @@ lv_obj_t * lv_cb_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(new_cb);
     if(new_cb == NULL) return NULL;
 
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_cb);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_cb);
+        lv_signal_reg(lv_cb_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_STYLE_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_PRESSED) | LV_SIGNAL_BIT(LV_SIGNAL_PRESS_LOST) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_RELEASED) | LV_SIGNAL_BIT(LV_SIGNAL_CONTROLL));
+    }
     if(ancestor_bg_design == NULL) ancestor_bg_design = lv_obj_get_design_func(new_cb);
 
     lv_cb_ext_t * ext = lv_obj_allocate_ext_attr(new_cb, sizeof(lv_cb_ext_t));
@@ -312,7 +319,7 @@ static lv_res_t lv_cb_signal(lv_obj_t * cb, lv_signal_t sign, void * param)
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(cb, sign, param);
+    res = lv_signal_call(ancestor_signal, cb, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_cb_ext_t * ext = lv_obj_get_ext_attr(cb);
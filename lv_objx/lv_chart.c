@@ -9,6 +9,7 @@
 #include "lv_chart.h"
 #if USE_LV_CHART != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_draw/lv_draw.h"
 #include "../lv_themes/lv_theme.h"
 
@@ -83,7 +84,11 @@ lv_obj_t * lv_chart_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->series.width = 2;
 
     if(ancestor_design_f == NULL) ancestor_design_f = lv_obj_get_design_func(new_chart);
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_chart);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_chart);
+        lv_signal_reg(lv_chart_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
 
     lv_obj_set_signal_func(new_chart, lv_chart_signal);
     lv_obj_set_design_func(new_chart, lv_chart_design);
@@ -505,7 +510,7 @@ static lv_res_t lv_chart_signal(lv_obj_t * chart, lv_signal_t sign, void * param
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(chart, sign, param);
+    res = lv_signal_call(ancestor_signal, chart, sign, param);
     if(res != LV_RES_OK) return res;
 
     if(sign == LV_SIGNAL_CLEANUP) {
@@ -14,6 +14,7 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_draw/lv_draw.h"
 #include "../lv_draw/lv_draw_vbasic.h"
 #include "../lv_themes/lv_theme.h"
@@ -71,7 +72,12 @@ lv_obj_t * lv_cont_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(new_cont);
     if(new_cont == NULL) return NULL;
 
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_cont);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_cont);
+        lv_signal_reg(lv_cont_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CHILD_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_CORD_CHG) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_STYLE_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
 
     lv_obj_allocate_ext_attr(new_cont, sizeof(lv_cont_ext_t));
     lv_cont_ext_t * ext = lv_obj_get_ext_attr(new_cont);
@@ -128,7 +134,7 @@ void lv_cont_set_layout(lv_obj_t * cont, lv_layout_t layout)
     ext->layout = layout;
 
     /*Send a signal to refresh the layout*/
-    cont->signal_func(cont, LV_SIGNAL_CHILD_CHG, NULL);
+    lv_signal_send(cont, LV_SIGNAL_CHILD_CHG, NULL);
 }
 
 
@@ -149,7 +155,7 @@ void lv_cont_set_fit(lv_obj_t * cont, bool hor_en, bool ver_en)
     ext->ver_fit = ver_en == false ? 0 : 1;
 
     /*Send a signal to refresh the layout*/
-    cont->signal_func(cont, LV_SIGNAL_CHILD_CHG, NULL);
+    lv_signal_send(cont, LV_SIGNAL_CHILD_CHG, NULL);
 }
 
 /*=====================
@@ -229,7 +235,7 @@ static lv_res_t lv_cont_signal(lv_obj_t * cont, lv_signal_t sign, void * param)
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(cont, sign, param);
+    res = lv_signal_call(ancestor_signal, cont, sign, param);
     if(res != LV_RES_OK) return res;
 
     if(sign == LV_SIGNAL_STYLE_CHG) { /*Recalculate the padding if the style changed*/
@@ -321,7 +327,7 @@ static void lv_cont_layout_col(lv_obj_t * cont)
     lv_obj_set_protect(cont, LV_PROTECT_CHILD_CHG);
     /* Align the children */
     lv_coord_t last_cord = style->body.padding.ver;
-    LL_READ_BACK(cont->child_ll, child) {
+    for(child = lv_obj_get_child_back(cont, NULL); child != NULL; child = lv_obj_get_child_back(cont, child)) {
         if(lv_obj_get_hidden(child) != false ||
                 lv_obj_is_protected(child, LV_PROTECT_POS) != false) continue;
 
@@ -371,7 +377,7 @@ static void lv_cont_layout_row(lv_obj_t * cont)
 
     /* Align the children */
     lv_coord_t last_cord = style->body.padding.hor;
-    LL_READ_BACK(cont->child_ll, child) {
+    for(child = lv_obj_get_child_back(cont, NULL); child != NULL; child = lv_obj_get_child_back(cont, child)) {
         if(lv_obj_get_hidden(child) != false ||
                 lv_obj_is_protected(child, LV_PROTECT_POS) != false) continue;
 
@@ -393,7 +399,7 @@ static void lv_cont_layout_center(lv_obj_t * cont)
     uint32_t obj_num = 0;
     lv_coord_t h_tot = 0;
 
-    LL_READ(cont->child_ll, child) {
+    for(child = lv_obj_get_child(cont, NULL); child != NULL; child = lv_obj_get_child(cont, child)) {
         if(lv_obj_get_hidden(child) != false ||
                 lv_obj_is_protected(child, LV_PROTECT_POS) != false) continue;
         h_tot += lv_obj_get_height(child) + style->body.padding.inner;
@@ -410,7 +416,7 @@ static void lv_cont_layout_center(lv_obj_t * cont)
 
     /* Align the children */
     lv_coord_t last_cord = - (h_tot / 2);
-    LL_READ_BACK(cont->child_ll, child) {
+    for(child = lv_obj_get_child_back(cont, NULL); child != NULL; child = lv_obj_get_child_back(cont, child)) {
         if(lv_obj_get_hidden(child) != false ||
                 lv_obj_is_protected(child, LV_PROTECT_POS) != false) continue;
 
@@ -437,7 +443,7 @@ static void lv_cont_layout_pretty(lv_obj_t * cont)
     /* Disable child change action because the children will be moved a lot
      * an unnecessary child change signals could be sent*/
 
-    child_rs = lv_ll_get_tail(&cont->child_ll); /*Set the row starter child*/
+    child_rs = lv_obj_get_child_back(cont, NULL); /*Set the row starter child*/
     if(child_rs == NULL) return;    /*Return if no child*/
 
     lv_obj_set_protect(cont, LV_PROTECT_CHILD_CHG);
@@ -456,7 +462,7 @@ static void lv_cont_layout_pretty(lv_obj_t * cont)
                 if(w_row + lv_obj_get_width(child_rc) > w_obj) {
                     /*Step back one child because the last already not fit, so the previous is the closer*/
                     if(child_rc != NULL  && obj_num != 0) {
-                        child_rc = lv_ll_get_next(&cont->child_ll, child_rc);
+                        child_rc = lv_obj_get_child(cont, child_rc);
                     }
                     break;
                 }
@@ -466,7 +472,7 @@ static void lv_cont_layout_pretty(lv_obj_t * cont)
                 if(lv_obj_is_protected(child_rc, LV_PROTECT_FOLLOW)) break; /*If can not be followed by an other object then break here*/
 
             }
-            child_rc = lv_ll_get_prev(&cont->child_ll, child_rc); /*Load the next object*/
+            child_rc = lv_obj_get_child_back(cont, child_rc); /*Load the next object*/
             if(obj_num == 0) child_rs = child_rc; /*If the first object was hidden (or too long) then set the next as first */
         } while(child_rc != NULL);
 
@@ -484,7 +490,7 @@ static void lv_cont_layout_pretty(lv_obj_t * cont)
         /*If there are two object in the row then align them proportionally*/
         else if(obj_num == 2) {
             lv_obj_t * obj1 = child_rs;
-            lv_obj_t * obj2 = lv_ll_get_prev(&cont->child_ll, child_rs);
+            lv_obj_t * obj2 = lv_obj_get_child_back(cont, child_rs);
             w_row = lv_obj_get_width(obj1) + lv_obj_get_width(obj2);
             lv_coord_t pad = (w_obj - w_row) / 3;
             lv_obj_align(obj1, cont, LV_ALIGN_IN_TOP_LEFT, pad, act_y + (h_row - lv_obj_get_height(obj1)) / 2);
@@ -503,14 +509,14 @@ static void lv_cont_layout_pretty(lv_obj_t * cont)
                     act_x += lv_obj_get_width(child_tmp) + new_opad;
                 }
                 if(child_tmp == child_rc) break;
-                child_tmp = lv_ll_get_prev(&cont->child_ll, child_tmp);
+                child_tmp = lv_obj_get_child_back(cont, child_tmp);
             }
 
         }
 
         if(child_rc == NULL) break;
         act_y += style->body.padding.inner + h_row; /*y increment*/
-        child_rs = lv_ll_get_prev(&cont->child_ll, child_rc); /*Go to the next object*/
+        child_rs = lv_obj_get_child_back(cont, child_rc); /*Go to the next object*/
         child_rc = child_rs;
     }
     lv_obj_clear_protect(cont, LV_PROTECT_CHILD_CHG);
@@ -544,7 +550,7 @@ static void lv_cont_layout_grid(lv_obj_t * cont)
     lv_coord_t act_x = style->body.padding.hor;
     lv_coord_t act_y = style->body.padding.ver;
     uint16_t obj_cnt = 0;
-    LL_READ_BACK(cont->child_ll, child) {
+    for(child = lv_obj_get_child_back(cont, NULL); child != NULL; child = lv_obj_get_child_back(cont, child)) {
         if(lv_obj_get_hidden(child) != false ||
                 lv_obj_is_protected(child, LV_PROTECT_POS) != false) continue;
 
@@ -589,13 +595,14 @@ static void lv_cont_refr_autofit(lv_obj_t * cont)
     /*Search the side coordinates of the children*/
     lv_obj_get_coords(cont, &ori);
     lv_obj_get_coords(cont, &new_cords);
+    lv_obj_update_children_coords(cont);
 
     new_cords.x1 = LV_COORD_MAX;
     new_cords.y1 = LV_COORD_MAX;
     new_cords.x2 = LV_COORD_MIN;
     new_cords.y2 = LV_COORD_MIN;
 
-    LL_READ(cont->child_ll, i) {
+    for(i = lv_obj_get_child(cont, NULL); i != NULL; i = lv_obj_get_child(cont, i)) {
         if(lv_obj_get_hidden(i) != false) continue;
         new_cords.x1 = LV_MATH_MIN(new_cords.x1, i->coords.x1);
         new_cords.y1 = LV_MATH_MIN(new_cords.y1, i->coords.y1);
@@ -631,11 +638,12 @@ static void lv_cont_refr_autofit(lv_obj_t * cont)
             lv_obj_invalidate(cont);
 
             /*Notify the object about its new coordinates*/
-            cont->signal_func(cont, LV_SIGNAL_CORD_CHG, &ori);
+            lv_signal_send(cont, LV_SIGNAL_CORD_CHG, &ori);
+            lv_obj_refresh_bound(cont);
 
             /*Inform the parent about the new coordinates*/
             lv_obj_t * par = lv_obj_get_parent(cont);
-            par->signal_func(par, LV_SIGNAL_CHILD_CHG, cont);
+            lv_signal_send(par, LV_SIGNAL_CHILD_CHG, cont);
         }
     }
 }
@@ -10,6 +10,7 @@
 #include "lv_ddlist.h"
 #if USE_LV_DDLIST != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_draw/lv_draw.h"
 #include "../lv_core/lv_group.h"
 #include "../lv_core/lv_indev.h"
@@ -43,6 +44,7 @@ static lv_res_t lv_ddlist_scrl_signal(lv_obj_t * scrl, lv_signal_t sign, void *
 static lv_res_t lv_ddlist_release_action(lv_obj_t * ddlist);
 static void lv_ddlist_refr_size(lv_obj_t * ddlist, bool anim_en);
 static void lv_ddlist_pos_current_option(lv_obj_t * ddlist);
+static uint16_t lv_ddlist_count_options(const char * options);
 
 /**********************
  *  STATIC VARIABLES
@@ -74,8 +76,20 @@ lv_obj_t * lv_ddlist_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(new_ddlist);
     if(new_ddlist == NULL) return NULL;
 
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_ddlist);
-    if(ancestor_scrl_signal == NULL) ancestor_scrl_signal = lv_obj_get_signal_func(lv_page_get_scrl(new_ddlist));
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_ddlist);
+        lv_signal_reg(lv_ddlist_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_STYLE_CHG) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE) | LV_SIGNAL_BIT(LV_SIGNAL_FOCUS) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_DEFOCUS) | LV_SIGNAL_BIT(LV_SIGNAL_CONTROLL) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_GET_EDITABLE));
+    }
+    if(ancestor_scrl_signal == NULL) {
+        ancestor_scrl_signal = lv_obj_get_signal_func(lv_page_get_scrl(new_ddlist));
+        lv_signal_reg(lv_ddlist_scrl_signal, ancestor_scrl_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_REFR_EXT_SIZE) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
     if(ancestor_design == NULL) ancestor_design = lv_obj_get_design_func(new_ddlist);
 
     /*Allocate the drop down list type specific extended data*/
@@ -131,7 +145,9 @@ lv_obj_t * lv_ddlist_create(lv_obj_t * par, const lv_obj_t * copy)
     else {
         lv_ddlist_ext_t * copy_ext = lv_obj_get_ext_attr(copy);
         ext->label = lv_label_create(new_ddlist, copy_ext->label);
-        lv_label_set_text(ext->label, lv_label_get_text(copy_ext->label));
+        lv_label_ext_t * copy_label_ext = lv_obj_get_ext_attr(copy_ext->label);
+        if(copy_label_ext->static_txt == 0) lv_label_set_text(ext->label, lv_label_get_text(copy_ext->label));
+        else lv_label_set_static_text(ext->label, lv_label_get_text(copy_ext->label));
         ext->sel_opt_id = copy_ext->sel_opt_id;
         ext->fix_height = copy_ext->fix_height;
         ext->action = copy_ext->action;
@@ -176,18 +192,28 @@ void lv_ddlist_set_options(lv_obj_t * ddlist, const char * options)
 {
     lv_ddlist_ext_t * ext = lv_obj_get_ext_attr(ddlist);
 
-    /*Count the '\n'-s to determine the number of options*/
-    ext->option_cnt = 0;
-    uint16_t i;
-    for(i = 0; options[i] != '\0'; i++) {
-        if(options[i] == '\n') ext->option_cnt++;
-    }
-    ext->option_cnt++;     /*Last option in the at row*/
+    ext->option_cnt = lv_ddlist_count_options(options);
 
     lv_label_set_text(ext->label, options);
     lv_ddlist_refr_size(ddlist, false);
 }
 
+/**
+ * Set the options in a drop down list from a static string. It will not be saved by the drop down list
+ * so the `options` variable has to be 'alive' while the drop down list exists.
+ * @param ddlist pointer to drop down list object
+ * @param options a string with '\n' separated options. E.g. "One\nTwo\nThree"
+ */
+void lv_ddlist_set_static_options(lv_obj_t * ddlist, const char * options)
+{
+    lv_ddlist_ext_t * ext = lv_obj_get_ext_attr(ddlist);
+
+    ext->option_cnt = lv_ddlist_count_options(options);
+
+    lv_label_set_static_text(ext->label, options);
+    lv_ddlist_refr_size(ddlist, false);
+}
+
 /**
  * Set the selected option
  * @param ddlist pointer to drop down list object
@@ -462,6 +488,24 @@ void lv_ddlist_close(lv_obj_t * ddlist, bool anim_en)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Count the options in an option string
+ * @param options a string with '\n' separated options
+ * @return number of options
+ */
+static uint16_t lv_ddlist_count_options(const char * options)
+{
+    /*Count the '\n'-s to determine the number of options*/
+    uint16_t cnt = 0;
+    uint16_t i;
+    for(i = 0; options[i] != '\0'; i++) {
+        if(options[i] == '\n') cnt++;
+    }
+    cnt++;     /*Last option in the at row*/
+
+    return cnt;
+}
+
 /**
  * Get the text alignment flag for a drop down list.
  * @param ddlist drop down list
@@ -510,6 +554,7 @@ static bool lv_ddlist_design(lv_obj_t * ddlist, const lv_area_t * mask, lv_desig
 
         lv_ddlist_ext_t * ext = lv_obj_get_ext_attr(ddlist);
         lv_opa_t opa_scale = lv_obj_get_opa_scale(ddlist);
+        lv_obj_update_coords(ext->label);     /*The label is drawn later, after the list*/
         /*If the list is opened draw a rectangle under the selected item*/
         if(ext->opened != 0) {
             lv_style_t * style = lv_ddlist_get_style(ddlist, LV_DDLIST_STYLE_BG);
@@ -614,7 +659,7 @@ static lv_res_t lv_ddlist_signal(lv_obj_t * ddlist, lv_signal_t sign, void * par
 {
     lv_res_t res;
     /* Include the ancient signal function */
-    res = ancestor_signal(ddlist, sign, param);
+    res = lv_signal_call(ancestor_signal, ddlist, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_ddlist_ext_t * ext = lv_obj_get_ext_attr(ddlist);
@@ -732,7 +777,7 @@ static lv_res_t lv_ddlist_scrl_signal(lv_obj_t * scrl, lv_signal_t sign, void *
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_scrl_signal(scrl, sign, param);
+    res = lv_signal_call(ancestor_scrl_signal, scrl, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_obj_t * ddlist = lv_obj_get_parent(scrl);
@@ -770,6 +815,7 @@ static lv_res_t lv_ddlist_release_action(lv_obj_t * ddlist)
         lv_indev_t * indev = lv_indev_get_act();
         lv_point_t p;
         lv_indev_get_point(indev, &p);
+        lv_obj_update_coords(ext->label);
         p.x -= ext->label->coords.x1;
         p.y -= ext->label->coords.y1;
         uint16_t letter_i;
@@ -863,6 +909,7 @@ static void lv_ddlist_pos_current_option(lv_obj_t * ddlist)
     lv_obj_t * scrl = lv_page_get_scrl(ddlist);
 
     lv_coord_t h = lv_obj_get_height(ddlist);
+    lv_obj_update_coords(ext->label);
     lv_coord_t line_y1 = ext->sel_opt_id * (font_h + label_style->text.line_space) + ext->label->coords.y1 - scrl->coords.y1;
 
     lv_obj_set_y(scrl, - line_y1 + (h - font_h) / 2);
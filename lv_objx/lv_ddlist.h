@@ -95,6 +95,14 @@ void lv_ddlist_set_draw_arrow(lv_obj_t * ddlist, bool en);
  */
 void lv_ddlist_set_options(lv_obj_t * ddlist, const char * options);
 
+/**
+ * Set the options in a drop down list from a static string. It will not be saved by the drop down list
+ * so the `options` variable has to be 'alive' while the drop down list exists.
+ * @param ddlist pointer to drop down list object
+ * @param options a string with '\n' separated options. E.g. "One\nTwo\nThree"
+ */
+void lv_ddlist_set_static_options(lv_obj_t * ddlist, const char * options);
+
 /**
  * Set the selected option
  * @param ddlist pointer to drop down list object
@@ -10,6 +10,7 @@
 #include "lv_gauge.h"
 #if USE_LV_GAUGE != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_draw/lv_draw.h"
 #include "../lv_themes/lv_theme.h"
 #include "../lv_misc/lv_txt.h"
@@ -38,6 +39,8 @@ static bool lv_gauge_design(lv_obj_t * gauge, const lv_area_t * mask, lv_design_
 static lv_res_t lv_gauge_signal(lv_obj_t * gauge, lv_signal_t sign, void * param);
 static void lv_gauge_draw_scale(lv_obj_t * gauge, const lv_area_t * mask);
 static void lv_gauge_draw_needle(lv_obj_t * gauge, const lv_area_t * mask);
+static void lv_gauge_get_needle_end(const lv_obj_t * gauge, int16_t value, lv_point_t * p_end);
+static void lv_gauge_invalidate_needle(lv_obj_t * gauge, int16_t value);
 
 /**********************
  *  STATIC VARIABLES
@@ -78,7 +81,11 @@ lv_obj_t * lv_gauge_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->values = NULL;
     ext->needle_colors = NULL;
     ext->label_count = LV_GAUGE_DEF_LABEL_COUNT;
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_gauge);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_gauge);
+        lv_signal_reg(lv_gauge_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
     if(ancestor_design == NULL) ancestor_design = lv_obj_get_design_func(new_gauge);
 
     /*The signal and design functions are not copied so set them here*/
@@ -176,10 +183,10 @@ void lv_gauge_set_value(lv_obj_t * gauge, uint8_t needle_id, int16_t value)
     if(value > max) value = max;
     else if(value < min) value = min;
 
+    /*Only the old and the new needle need to be redrawn*/
+    lv_gauge_invalidate_needle(gauge, ext->values[needle_id]);
     ext->values[needle_id] = value;
-
-
-    lv_obj_invalidate(gauge);
+    lv_gauge_invalidate_needle(gauge, value);
 }
 
 
@@ -317,7 +324,7 @@ static lv_res_t lv_gauge_signal(lv_obj_t * gauge, lv_signal_t sign, void * param
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(gauge, sign, param);
+    res = lv_signal_call(ancestor_signal, gauge, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_gauge_ext_t * ext = lv_obj_get_ext_attr(gauge);
@@ -398,17 +405,10 @@ static void lv_gauge_draw_needle(lv_obj_t * gauge, const lv_area_t * mask)
     lv_style_t * style = lv_gauge_get_style(gauge);
     lv_opa_t opa_scale = lv_obj_get_opa_scale(gauge);
 
-    lv_coord_t r = lv_obj_get_width(gauge) / 2 - style->body.padding.hor;
     lv_coord_t x_ofs = lv_obj_get_width(gauge) / 2 + gauge->coords.x1;
     lv_coord_t y_ofs = lv_obj_get_height(gauge) / 2 + gauge->coords.y1;
-    uint16_t angle = lv_lmeter_get_scale_angle(gauge);
-    int16_t angle_ofs = 90 + (360 - angle) / 2;
-    int16_t min = lv_gauge_get_min_value(gauge);
-    int16_t max = lv_gauge_get_max_value(gauge);
     lv_point_t p_mid;
     lv_point_t p_end;
-    lv_point_t p_end_low;
-    lv_point_t p_end_high;
     uint8_t i;
 
     lv_style_copy(&style_needle, style);
@@ -417,28 +417,7 @@ static void lv_gauge_draw_needle(lv_obj_t * gauge, const lv_area_t * mask)
     p_mid.y = y_ofs;
     for(i = 0; i < ext->needle_count; i++) {
         /*Calculate the end point of a needle*/
-        int16_t needle_angle = (ext->values[i] - min) * angle * (1 << LV_GAUGE_INTERPOLATE_SHIFT)  / (max - min); //+ angle_ofs;
-
-
-        int16_t needle_angle_low = (needle_angle >> LV_GAUGE_INTERPOLATE_SHIFT) + angle_ofs;
-        int16_t needle_angle_high = needle_angle_low + 1;
-
-
-        p_end_low.y = (lv_trigo_sin(needle_angle_low) * r) / LV_TRIGO_SIN_MAX + y_ofs;
-        p_end_low.x = (lv_trigo_sin(needle_angle_low + 90) * r) / LV_TRIGO_SIN_MAX + x_ofs;
-
-        p_end_high.y = (lv_trigo_sin(needle_angle_high) * r) / LV_TRIGO_SIN_MAX + y_ofs;
-        p_end_high.x = (lv_trigo_sin(needle_angle_high + 90) * r) / LV_TRIGO_SIN_MAX + x_ofs;
-
-        uint16_t rem = needle_angle & ((1 << LV_GAUGE_INTERPOLATE_SHIFT) - 1);
-        int16_t x_mod = ((LV_MATH_ABS(p_end_high.x  - p_end_low.x)) * rem) >> LV_GAUGE_INTERPOLATE_SHIFT;
-        int16_t y_mod = ((LV_MATH_ABS(p_end_high.y  - p_end_low.y)) * rem) >> LV_GAUGE_INTERPOLATE_SHIFT;
-
-        if(p_end_high.x < p_end_low.x) x_mod = -x_mod;
-        if(p_end_high.y < p_end_low.y) y_mod = -y_mod;
-
-        p_end.x = p_end_low.x + x_mod;
-        p_end.y = p_end_low.y + y_mod;
+        lv_gauge_get_needle_end(gauge, ext->values[i], &p_end);
 
         /*Draw the needle with the corresponding color*/
         if(ext->needle_colors == NULL) style_needle.line.color = LV_GAUGE_DEF_NEEDLE_COLOR;
@@ -463,4 +442,79 @@ static void lv_gauge_draw_needle(lv_obj_t * gauge, const lv_area_t * mask)
     lv_draw_rect(&nm_cord, mask, &style_neddle_mid, lv_obj_get_opa_scale(gauge));
 }
 
+
+/**
+ * Get the end point of a needle
+ * @param gauge pointer to gauge object
+ * @param value the value shown by the needle
+ * @param p_end store the end point of the needle here
+ */
+static void lv_gauge_get_needle_end(const lv_obj_t * gauge, int16_t value, lv_point_t * p_end)
+{
+    lv_style_t * style = lv_gauge_get_style(gauge);
+    lv_coord_t r = lv_obj_get_width(gauge) / 2 - style->body.padding.hor;
+    lv_coord_t x_ofs = lv_obj_get_width(gauge) / 2 + gauge->coords.x1;
+    lv_coord_t y_ofs = lv_obj_get_height(gauge) / 2 + gauge->coords.y1;
+    uint16_t angle = lv_lmeter_get_scale_angle(gauge);
+    int16_t angle_ofs = 90 + (360 - angle) / 2;
+    int16_t min = lv_gauge_get_min_value(gauge);
+    int16_t max = lv_gauge_get_max_value(gauge);
+    lv_point_t p_end_low;
+    lv_point_t p_end_high;
+
+    int16_t needle_angle = (value - min) * angle * (1 << LV_GAUGE_INTERPOLATE_SHIFT)  / (max - min); //+ angle_ofs;
+
+    int16_t needle_angle_low = (needle_angle >> LV_GAUGE_INTERPOLATE_SHIFT) + angle_ofs;
+    int16_t needle_angle_high = needle_angle_low + 1;
+
+    p_end_low.y = (lv_trigo_sin(needle_angle_low) * r) / LV_TRIGO_SIN_MAX + y_ofs;
+    p_end_low.x = (lv_trigo_sin(needle_angle_low + 90) * r) / LV_TRIGO_SIN_MAX + x_ofs;
+
+    p_end_high.y = (lv_trigo_sin(needle_angle_high) * r) / LV_TRIGO_SIN_MAX + y_ofs;
+    p_end_high.x = (lv_trigo_sin(needle_angle_high + 90) * r) / LV_TRIGO_SIN_MAX + x_ofs;
+
+    uint16_t rem = needle_angle & ((1 << LV_GAUGE_INTERPOLATE_SHIFT) - 1);
+    int16_t x_mod = ((LV_MATH_ABS(p_end_high.x  - p_end_low.x)) * rem) >> LV_GAUGE_INTERPOLATE_SHIFT;
+    int16_t y_mod = ((LV_MATH_ABS(p_end_high.y  - p_end_low.y)) * rem) >> LV_GAUGE_INTERPOLATE_SHIFT;
+
+    if(p_end_high.x < p_end_low.x) x_mod = -x_mod;
+    if(p_end_high.y < p_end_low.y) y_mod = -y_mod;
+
+    p_end->x = p_end_low.x + x_mod;
+    p_end->y = p_end_low.y + y_mod;
+}
+
+/**
+ * Invalidate the bounding box of a needle
+ * @param gauge pointer to gauge object
+ * @param value the value shown by the needle
+ */
+static void lv_gauge_invalidate_needle(lv_obj_t * gauge, int16_t value)
+{
+    lv_obj_update_coords(gauge);
+    lv_style_t * style = lv_gauge_get_style(gauge);
+    lv_point_t p_end;
+    lv_gauge_get_needle_end(gauge, value, &p_end);
+
+    lv_area_t area;
+    area.x1 = lv_obj_get_width(gauge) / 2 + gauge->coords.x1;
+    area.y1 = lv_obj_get_height(gauge) / 2 + gauge->coords.y1;
+    area.x2 = area.x1;
+    area.y2 = area.y1;
+
+    if(p_end.x < area.x1) area.x1 = p_end.x;
+    else area.x2 = p_end.x;
+    if(p_end.y < area.y1) area.y1 = p_end.y;
+    else area.y2 = p_end.y;
+
+    /*Add the line width and some extra space for anti-aliasing*/
+    lv_coord_t ext_size = style->line.width / 2 + 2;
+    area.x1 -= ext_size;
+    area.y1 -= ext_size;
+    area.x2 += ext_size;
+    area.y2 += ext_size;
+
+    lv_obj_invalidate_area(gauge, &area);
+}
+
 #endif
@@ -15,6 +15,7 @@
 #endif
 
 #include "../lv_core/lv_lang.h"
+#include "../lv_core/lv_signal.h"
 #include "../lv_themes/lv_theme.h"
 #include "../lv_misc/lv_fs.h"
 #include "../lv_misc/lv_ufs.h"
@@ -65,7 +66,12 @@ lv_obj_t * lv_img_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(new_img);
     if(new_img == NULL) return NULL;
 
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_img);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_img);
+        lv_signal_reg(lv_img_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_STYLE_CHG) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_LANG_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
 
     /*Extend the basic object to image object*/
     lv_img_ext_t * ext = lv_obj_allocate_ext_attr(new_img, sizeof(lv_img_ext_t));
@@ -79,6 +85,7 @@ lv_obj_t * lv_img_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->h = lv_obj_get_height(new_img);
     ext->auto_size = 1;
 #if USE_LV_MULTI_LANG
+    ext->lang_node = NULL;
     ext->lang_txt_id = LV_LANG_TXT_ID_NONE;
 #endif
 
@@ -217,8 +224,17 @@ void lv_img_set_src_id(lv_obj_t * img, uint32_t src_id)
     lv_img_ext_t * ext = lv_obj_get_ext_attr(img);
     ext->lang_txt_id = src_id;
 
+    if(src_id == LV_LANG_TXT_ID_NONE) {
+        lv_lang_obj_unreg(ext->lang_node);
+        ext->lang_node = NULL;
+        return;
+    }
+
+    /*Not a text: don't store it in the language buffer*/
+    ext->lang_node = lv_lang_obj_reg(ext->lang_node, img, src_id, false);
+
     /*Apply the new language*/
-    img->signal_func(img, LV_SIGNAL_LANG_CHG, NULL);
+    lv_signal_send(img, LV_SIGNAL_LANG_CHG, NULL);
 }
 #endif
 
@@ -366,7 +382,7 @@ static lv_res_t lv_img_signal(lv_obj_t * img, lv_signal_t sign, void * param)
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(img, sign, param);
+    res = lv_signal_call(ancestor_signal, img, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_img_ext_t * ext = lv_obj_get_ext_attr(img);
@@ -376,6 +392,10 @@ static lv_res_t lv_img_signal(lv_obj_t * img, lv_signal_t sign, void * param)
             ext->src = NULL;
             ext->src_type = LV_IMG_SRC_UNKNOWN;
         }
+#if USE_LV_MULTI_LANG
+        lv_lang_obj_unreg(ext->lang_node);
+        ext->lang_node = NULL;
+#endif
     } else if(sign == LV_SIGNAL_STYLE_CHG) {
         /*Refresh the file name to refresh the symbol text size*/
         if(ext->src_type == LV_IMG_SRC_SYMBOL) {
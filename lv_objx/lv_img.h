@@ -44,6 +44,7 @@ typedef struct
     lv_coord_t w;               /*Width of the image (Handled by the library)*/
     lv_coord_t h;               /*Height of the image (Handled by the library)*/
 #if USE_LV_MULTI_LANG
+    void * lang_node;           /*Node in the language registry (Handled by the library)*/
     uint16_t lang_txt_id;       /*The ID of the image to display. */
 #endif
     uint8_t src_type  :2;       /*See: lv_img_src_t*/
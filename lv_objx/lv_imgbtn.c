@@ -9,6 +9,8 @@
 #include "lv_imgbtn.h"
 #if USE_LV_IMGBTN != 0
 
+#include "../lv_core/lv_signal.h"
+
 /*********************
  *      DEFINES
  *********************/
@@ -57,7 +59,12 @@ lv_obj_t * lv_imgbtn_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_imgbtn_ext_t * ext = lv_obj_allocate_ext_attr(new_imgbtn, sizeof(lv_imgbtn_ext_t));
     lv_mem_assert(ext);
     if(ext == NULL) return NULL;
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_imgbtn);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_imgbtn);
+        lv_signal_reg(lv_imgbtn_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_STYLE_CHG) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
     if(ancestor_design == NULL) ancestor_design = lv_obj_get_design_func(new_imgbtn);
 
     /*Initialize the allocated 'ext' */
@@ -338,7 +345,7 @@ static lv_res_t lv_imgbtn_signal(lv_obj_t * imgbtn, lv_signal_t sign, void * par
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(imgbtn, sign, param);
+    res = lv_signal_call(ancestor_signal, imgbtn, sign, param);
     if(res != LV_RES_OK) return res;
 
     if(sign == LV_SIGNAL_STYLE_CHG) {
@@ -11,6 +11,7 @@
 #if USE_LV_KB != 0
 
 #include "lv_ta.h"
+#include "../lv_core/lv_signal.h"
 #include "../lv_themes/lv_theme.h"
 
 /*********************
@@ -82,7 +83,11 @@ lv_obj_t * lv_kb_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(new_kb);
     if(new_kb == NULL) return NULL;
 
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_kb);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_kb);
+        lv_signal_reg(lv_kb_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
 
     /*Allocate the keyboard type specific extended data*/
     lv_kb_ext_t * ext = lv_obj_allocate_ext_attr(new_kb, sizeof(lv_kb_ext_t));
@@ -375,7 +380,7 @@ static lv_res_t lv_kb_signal(lv_obj_t * kb, lv_signal_t sign, void * param)
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(kb, sign, param);
+    res = lv_signal_call(ancestor_signal, kb, sign, param);
     if(res != LV_RES_OK) return res;
 
     if(sign == LV_SIGNAL_CLEANUP) {
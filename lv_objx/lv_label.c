@@ -9,6 +9,7 @@
 #include "lv_label.h"
 #if USE_LV_LABEL != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_core/lv_obj.h"
 #include "../lv_core/lv_group.h"
 #include "../lv_core/lv_lang.h"
@@ -72,7 +73,13 @@ lv_obj_t * lv_label_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(new_label);
     if(new_label == NULL) return NULL;
 
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_label);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_label);
+        lv_signal_reg(lv_label_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_CORD_CHG) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_STYLE_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_REFR_EXT_SIZE) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_LANG_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
 
     /*Extend the basic object to a label object*/
     lv_obj_allocate_ext_attr(new_label, sizeof(lv_label_ext_t));
@@ -92,6 +99,7 @@ lv_obj_t * lv_label_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->offset.x = 0;
     ext->offset.y = 0;
 #if USE_LV_MULTI_LANG
+    ext->lang_node = NULL;
     ext->lang_txt_id = LV_LANG_TXT_ID_NONE;
 #endif
     lv_obj_set_design_func(new_label, lv_label_design);
@@ -115,7 +123,7 @@ lv_obj_t * lv_label_create(lv_obj_t * par, const lv_obj_t * copy)
         else lv_label_set_static_text(new_label, lv_label_get_text(copy));
 
         /*In DOT mode save the text byte-to-byte because a '\0' can be in the middle*/
-        if(copy_ext->long_mode == LV_LABEL_LONG_DOT) {
+        if(copy_ext->long_mode == LV_LABEL_LONG_DOT && copy_ext->static_txt == 0) {
             ext->text = lv_mem_realloc(ext->text, lv_mem_get_size(copy_ext->text));
             lv_mem_assert(ext->text);
             if(ext->text == NULL) return NULL;
@@ -125,6 +133,11 @@ lv_obj_t * lv_label_create(lv_obj_t * par, const lv_obj_t * copy)
         memcpy(ext->dot_tmp, copy_ext->dot_tmp, sizeof(ext->dot_tmp));
         ext->dot_end = copy_ext->dot_end;
 
+#if USE_LV_MULTI_LANG
+        /*The text of `copy` might be in the language buffer. Get an own text for the new label.*/
+        if(copy_ext->lang_txt_id != LV_LANG_TXT_ID_NONE) lv_label_set_text_id(new_label, copy_ext->lang_txt_id);
+#endif
+
         /*Refresh the style with new signal function*/
         lv_obj_refresh_style(new_label);
     }
@@ -156,7 +169,7 @@ void lv_label_set_text(lv_obj_t * label, const char * text)
         return;
     }
 
-    if(ext->text == text) {
+    if(ext->text == text && ext->static_txt == 0) {
         /*If set its own text then reallocate it (maybe its size changed)*/
         ext->text = lv_mem_realloc(ext->text, strlen(ext->text) + 1);
         lv_mem_assert(ext->text);
@@ -248,8 +261,21 @@ void lv_label_set_text_id(lv_obj_t * label, uint32_t txt_id)
     lv_label_ext_t * ext = lv_obj_get_ext_attr(label);
     ext->lang_txt_id = txt_id;
 
+    if(txt_id == LV_LANG_TXT_ID_NONE) {
+        /*The text might be in the language buffer which can be freed. Save it.*/
+        if(ext->lang_node && ext->static_txt) {
+            lv_label_revert_dots(label);
+            lv_label_set_text(label, ext->text);
+        }
+        lv_lang_obj_unreg(ext->lang_node);
+        ext->lang_node = NULL;
+        return;
+    }
+
+    ext->lang_node = lv_lang_obj_reg(ext->lang_node, label, txt_id, true);
+
     /*Apply the new language*/
-    label->signal_func(label, LV_SIGNAL_LANG_CHG, NULL);
+    lv_signal_send(label, LV_SIGNAL_LANG_CHG, NULL);
 }
 #endif
 
@@ -727,7 +753,7 @@ static lv_res_t lv_label_signal(lv_obj_t * label, lv_signal_t sign, void * param
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(label, sign, param);
+    res = lv_signal_call(ancestor_signal, label, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_label_ext_t * ext = lv_obj_get_ext_attr(label);
@@ -736,6 +762,10 @@ static lv_res_t lv_label_signal(lv_obj_t * label, lv_signal_t sign, void * param
             lv_mem_free(ext->text);
             ext->text = NULL;
         }
+#if USE_LV_MULTI_LANG
+        lv_lang_obj_unreg(ext->lang_node);
+        ext->lang_node = NULL;
+#endif
     } else if(sign == LV_SIGNAL_STYLE_CHG) {
         /*Revert dots for proper refresh*/
         lv_label_revert_dots(label);
@@ -755,12 +785,20 @@ static lv_res_t lv_label_signal(lv_obj_t * label, lv_signal_t sign, void * param
         }
     } else if(sign == LV_SIGNAL_LANG_CHG) {
 #if USE_LV_MULTI_LANG
-        if(ext->lang_txt_id != LV_LANG_TXT_ID_NONE) {
+        if(param) {
+            /*The text is already in the language buffer (see `lv_lang_set`)*/
+            lv_label_set_static_text(label, param);
+        } else if(ext->lang_txt_id != LV_LANG_TXT_ID_NONE) {
             const char * lang_txt = lv_lang_get_text(ext->lang_txt_id);
             if(lang_txt) {
                 lv_label_set_text(label, lang_txt);
             } else {
                 LV_LOG_WARN("lv_lang_get_text return NULL for a label's text");
+                /*The current text might be in the language buffer which will be freed. Save it.*/
+                if(ext->lang_node && ext->static_txt) {
+                    lv_label_revert_dots(label);
+                    lv_label_set_text(label, ext->text);
+                }
             }
         }
 #endif
@@ -70,6 +70,7 @@ typedef struct
 #endif
 
 #if USE_LV_MULTI_LANG
+    void * lang_node;                /*Node in the language registry (Handled by the library)*/
     uint16_t lang_txt_id;            /*The ID of the text to display*/
 #endif
     uint16_t dot_end;               /*The text end position in dot mode (Handled by the library)*/
@@ -9,6 +9,7 @@
 #include "lv_led.h"
 #if USE_LV_LED != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_themes/lv_theme.h"
 #include "../lv_draw/lv_draw.h"
 
@@ -59,7 +60,11 @@ lv_obj_t * lv_led_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(new_led);
     if(new_led == NULL) return NULL;
 
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_led);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_led);
+        lv_signal_reg(lv_led_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
     if(ancestor_design_f == NULL) ancestor_design_f = lv_obj_get_design_func(new_led);
 
     /*Allocate the object type specific extended data*/
@@ -226,7 +231,7 @@ static lv_res_t lv_led_signal(lv_obj_t * led, lv_signal_t sign, void * param)
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(led, sign, param);
+    res = lv_signal_call(ancestor_signal, led, sign, param);
     if(res != LV_RES_OK) return res;
 
 
@@ -9,6 +9,7 @@
 #include "lv_line.h"
 
 #if USE_LV_LINE != 0
+#include "../lv_core/lv_signal.h"
 #include "../lv_draw/lv_draw.h"
 #include "../lv_misc/lv_math.h"
 #include <stdbool.h>
@@ -57,7 +58,11 @@ lv_obj_t * lv_line_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(new_line);
     if(new_line == NULL) return NULL;
 
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_line);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_line);
+        lv_signal_reg(lv_line_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_REFR_EXT_SIZE) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
 
     /*Extend the basic object to line object*/
     lv_line_ext_t * ext = lv_obj_allocate_ext_attr(new_line, sizeof(lv_line_ext_t));
@@ -280,7 +285,7 @@ static lv_res_t lv_line_signal(lv_obj_t * line, lv_signal_t sign, void * param)
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(line, sign, param);
+    res = lv_signal_call(ancestor_signal, line, sign, param);
     if(res != LV_RES_OK) return res;
 
 
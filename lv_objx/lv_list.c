@@ -9,6 +9,7 @@
 #include "lv_list.h"
 #if USE_LV_LIST != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_core/lv_group.h"
 #include "../lv_themes/lv_theme.h"
 #include "../lv_misc/lv_anim.h"
@@ -39,6 +40,7 @@ static lv_res_t lv_list_signal(lv_obj_t * list, lv_signal_t sign, void * param);
 static lv_res_t lv_list_btn_signal(lv_obj_t * btn, lv_signal_t sign, void * param);
 static void refr_btn_width(lv_obj_t * list);
 static void lv_list_btn_single_selected(lv_obj_t *btn);
+static lv_obj_t * lv_list_add_core(lv_obj_t * list, const void * img_src, const char * txt, bool static_txt, lv_action_t rel_action);
 
 /**********************
  *  STATIC VARIABLES
@@ -77,7 +79,14 @@ lv_obj_t * lv_list_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(new_list);
     if(new_list == NULL) return NULL;
 
-    if(ancestor_page_signal == NULL) ancestor_page_signal = lv_obj_get_signal_func(new_list);
+    if(ancestor_page_signal == NULL) {
+        ancestor_page_signal = lv_obj_get_signal_func(new_list);
+        lv_signal_reg(lv_list_signal, ancestor_page_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CORD_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_STYLE_CHG) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE) | LV_SIGNAL_BIT(LV_SIGNAL_FOCUS) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_DEFOCUS) | LV_SIGNAL_BIT(LV_SIGNAL_CONTROLL) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_GET_EDITABLE));
+    }
 
     lv_list_ext_t * ext = lv_obj_allocate_ext_attr(new_list, sizeof(lv_list_ext_t));
     lv_mem_assert(ext);
@@ -178,68 +187,21 @@ void lv_list_clean(lv_obj_t * obj)
  */
 lv_obj_t * lv_list_add(lv_obj_t * list, const void * img_src, const char * txt, lv_action_t rel_action)
 {
-    lv_style_t * style = lv_obj_get_style(list);
-    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
-    ext->size ++;
-    /*Create a list element with the image an the text*/
-    lv_obj_t * liste;
-    liste = lv_btn_create(list, NULL);
-
-    /*Save the original signal function because it will be required in `lv_list_btn_signal`*/
-    if(ancestor_btn_signal == NULL) ancestor_btn_signal = lv_obj_get_signal_func(liste);
-
-    /*Set the default styles*/
-    lv_btn_set_style(liste, LV_BTN_STYLE_REL, ext->styles_btn[LV_BTN_STATE_REL]);
-    lv_btn_set_style(liste, LV_BTN_STYLE_PR, ext->styles_btn[LV_BTN_STATE_PR]);
-    lv_btn_set_style(liste, LV_BTN_STYLE_TGL_REL, ext->styles_btn[LV_BTN_STATE_TGL_REL]);
-    lv_btn_set_style(liste, LV_BTN_STYLE_TGL_PR, ext->styles_btn[LV_BTN_STATE_TGL_PR]);
-    lv_btn_set_style(liste, LV_BTN_STYLE_INA, ext->styles_btn[LV_BTN_STATE_INA]);
-
-    lv_btn_set_action(liste, LV_BTN_ACTION_CLICK, rel_action);
-    lv_page_glue_obj(liste, true);
-    lv_btn_set_layout(liste, LV_LAYOUT_ROW_M);
-    lv_btn_set_fit(liste, false, true);
-    lv_obj_set_protect(liste, LV_PROTECT_PRESS_LOST);
-    lv_obj_set_signal_func(liste, lv_list_btn_signal);
-
-    /*Make the size adjustment*/
-    lv_coord_t w = lv_obj_get_width(list);
-    lv_style_t  * style_scrl = lv_obj_get_style(lv_page_get_scrl(list));
-    lv_coord_t pad_hor_tot = style->body.padding.hor + style_scrl->body.padding.hor;
-    w -= pad_hor_tot * 2;
-
-    lv_obj_set_width(liste, w);
-#if USE_LV_IMG != 0
-    lv_obj_t * img = NULL;
-    if(img_src) {
-        img = lv_img_create(liste, NULL);
-        lv_img_set_src(img, img_src);
-        lv_obj_set_style(img, ext->style_img);
-        lv_obj_set_click(img, false);
-        if(img_signal == NULL) img_signal = lv_obj_get_signal_func(img);
-    }
-#endif
-    if(txt != NULL) {
-        lv_coord_t btn_hor_pad = ext->styles_btn[LV_BTN_STYLE_REL]->body.padding.hor;
-        lv_obj_t * label = lv_label_create(liste, NULL);
-        lv_label_set_text(label, txt);
-        lv_obj_set_click(label, false);
-        lv_label_set_long_mode(label, LV_LABEL_LONG_ROLL);
-        lv_obj_set_width(label, liste->coords.x2 - label->coords.x1 - btn_hor_pad);
-        if(label_signal == NULL) label_signal = lv_obj_get_signal_func(label);
-    }
-#if USE_LV_GROUP
-    /* If this is the first item to be added to the list and the list is
-     * focussed, select it */
-    {
-        lv_group_t *g = lv_obj_get_group(list);
-        if(ext->size == 1 && lv_group_get_focused(g) == list) {
-            lv_list_set_btn_selected(list, liste);
-        }
-    }
-#endif
+    return lv_list_add_core(list, img_src, txt, false, rel_action);
+}
 
-    return liste;
+/**
+ * Add a list element to the list with a static text. The text will not be saved by the list
+ * so the `txt` variable has to be 'alive' while the list element exists.
+ * @param list pointer to list object
+ * @param img_fn file name of an image before the text (NULL if unused)
+ * @param txt text of the list element (NULL if unused)
+ * @param rel_action pointer to release action function (like with lv_btn)
+ * @return pointer to the new list element which can be customized (a button)
+ */
+lv_obj_t * lv_list_add_static(lv_obj_t * list, const void * img_src, const char * txt, lv_action_t rel_action)
+{
+    return lv_list_add_core(list, img_src, txt, true, rel_action);
 }
 
 /**
@@ -635,6 +597,7 @@ void lv_list_up(const lv_obj_t * list)
     lv_obj_t * e_prev = NULL;
     e = lv_list_get_prev_btn(list, NULL);
     while(e != NULL) {
+        lv_obj_update_coords(e);
         if(e->coords.y2 <= list->coords.y2) {
             if(e_prev != NULL) {
                 lv_coord_t new_y = lv_obj_get_height(list) - (lv_obj_get_y(e_prev) + lv_obj_get_height(e_prev));
@@ -679,6 +642,7 @@ void lv_list_down(const lv_obj_t * list)
     lv_obj_t * e;
     e = lv_list_get_prev_btn(list, NULL);
     while(e != NULL) {
+        lv_obj_update_coords(e);
         if(e->coords.y1 < list->coords.y1) {
             lv_coord_t new_y = -lv_obj_get_y(e);
             lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
@@ -730,6 +694,89 @@ void lv_list_focus(const lv_obj_t * btn, bool anim_en)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Add a list element to the list
+ * @param list pointer to list object
+ * @param img_src image source before the text (NULL if unused)
+ * @param txt text of the list element (NULL if unused)
+ * @param static_txt true: refer to `txt` as a static text; false: save a copy of `txt`
+ * @param rel_action pointer to release action function (like with lv_btn)
+ * @return pointer to the new list element
+ */
+static lv_obj_t * lv_list_add_core(lv_obj_t * list, const void * img_src, const char * txt, bool static_txt, lv_action_t rel_action)
+{
+    lv_style_t * style = lv_obj_get_style(list);
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    ext->size ++;
+    /*Create a list element with the image an the text*/
+    lv_obj_t * liste;
+    liste = lv_btn_create(list, NULL);
+
+    /*Save the original signal function because it will be required in `lv_list_btn_signal`*/
+    if(ancestor_btn_signal == NULL) {
+        ancestor_btn_signal = lv_obj_get_signal_func(liste);
+        lv_signal_reg(lv_list_btn_signal, ancestor_btn_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_PRESS_LOST) | LV_SIGNAL_BIT(LV_SIGNAL_RELEASED) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_FOCUS));
+    }
+
+    /*Set the default styles*/
+    lv_btn_set_style(liste, LV_BTN_STYLE_REL, ext->styles_btn[LV_BTN_STATE_REL]);
+    lv_btn_set_style(liste, LV_BTN_STYLE_PR, ext->styles_btn[LV_BTN_STATE_PR]);
+    lv_btn_set_style(liste, LV_BTN_STYLE_TGL_REL, ext->styles_btn[LV_BTN_STATE_TGL_REL]);
+    lv_btn_set_style(liste, LV_BTN_STYLE_TGL_PR, ext->styles_btn[LV_BTN_STATE_TGL_PR]);
+    lv_btn_set_style(liste, LV_BTN_STYLE_INA, ext->styles_btn[LV_BTN_STATE_INA]);
+
+    lv_btn_set_action(liste, LV_BTN_ACTION_CLICK, rel_action);
+    lv_page_glue_obj(liste, true);
+    lv_btn_set_layout(liste, LV_LAYOUT_ROW_M);
+    lv_btn_set_fit(liste, false, true);
+    lv_obj_set_protect(liste, LV_PROTECT_PRESS_LOST);
+    lv_obj_set_signal_func(liste, lv_list_btn_signal);
+
+    /*Make the size adjustment*/
+    lv_coord_t w = lv_obj_get_width(list);
+    lv_style_t  * style_scrl = lv_obj_get_style(lv_page_get_scrl(list));
+    lv_coord_t pad_hor_tot = style->body.padding.hor + style_scrl->body.padding.hor;
+    w -= pad_hor_tot * 2;
+
+    lv_obj_set_width(liste, w);
+#if USE_LV_IMG != 0
+    lv_obj_t * img = NULL;
+    if(img_src) {
+        img = lv_img_create(liste, NULL);
+        lv_img_set_src(img, img_src);
+        lv_obj_set_style(img, ext->style_img);
+        lv_obj_set_click(img, false);
+        if(img_signal == NULL) img_signal = lv_obj_get_signal_func(img);
+    }
+#endif
+    if(txt != NULL) {
+        lv_coord_t btn_hor_pad = ext->styles_btn[LV_BTN_STYLE_REL]->body.padding.hor;
+        lv_obj_t * label = lv_label_create(liste, NULL);
+        if(static_txt) lv_label_set_static_text(label, txt);
+        else lv_label_set_text(label, txt);
+        lv_obj_set_click(label, false);
+        lv_label_set_long_mode(label, LV_LABEL_LONG_ROLL);
+        lv_obj_update_coords(label);
+        lv_obj_set_width(label, liste->coords.x2 - label->coords.x1 - btn_hor_pad);
+        if(label_signal == NULL) label_signal = lv_obj_get_signal_func(label);
+    }
+#if USE_LV_GROUP
+    /* If this is the first item to be added to the list and the list is
+     * focussed, select it */
+    {
+        lv_group_t *g = lv_obj_get_group(list);
+        if(ext->size == 1 && lv_group_get_focused(g) == list) {
+            lv_list_set_btn_selected(list, liste);
+        }
+    }
+#endif
+
+    return liste;
+}
+
 /**
  * Signal function of the list
  * @param list pointer to a list object
@@ -742,7 +789,7 @@ static lv_res_t lv_list_signal(lv_obj_t * list, lv_signal_t sign, void * param)
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_page_signal(list, sign, param);
+    res = lv_signal_call(ancestor_page_signal, list, sign, param);
     if(res != LV_RES_OK) return res;
 
     if(sign == LV_SIGNAL_CORD_CHG) {
@@ -875,7 +922,7 @@ static lv_res_t lv_list_btn_signal(lv_obj_t * btn, lv_signal_t sign, void * para
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_btn_signal(btn, sign, param);
+    res = lv_signal_call(ancestor_btn_signal, btn, sign, param);
     if(res != LV_RES_OK) return res;
 
     if(sign == LV_SIGNAL_RELEASED) {
@@ -941,6 +988,7 @@ static void refr_btn_width(lv_obj_t * list)
             lv_obj_set_width(btn, btn_w);
             /*Set the label size to roll its text*/
             lv_obj_t * label = lv_list_get_btn_label(btn);
+            lv_obj_update_coords(label);
             lv_obj_set_width(label, btn->coords.x2 - label->coords.x1);
             lv_label_set_text(label, NULL);
         }
@@ -110,6 +110,17 @@ void lv_list_clean(lv_obj_t *obj);
  */
 lv_obj_t * lv_list_add(lv_obj_t * list, const void * img_src, const char * txt, lv_action_t rel_action);
 
+/**
+ * Add a list element to the list with a static text. The text will not be saved by the list
+ * so the `txt` variable has to be 'alive' while the list element exists.
+ * @param list pointer to list object
+ * @param img_fn file name of an image before the text (NULL if unused)
+ * @param txt text of the list element (NULL if unused)
+ * @param rel_action pointer to release action function (like with lv_btn)
+ * @return pointer to the new list element which can be customized (a button)
+ */
+lv_obj_t * lv_list_add_static(lv_obj_t * list, const void * img_src, const char * txt, lv_action_t rel_action);
+
 /**
  * Remove the index of the button in the list
  * @param list pointer to a list object
@@ -9,6 +9,7 @@
 #include "lv_lmeter.h"
 #if USE_LV_LMETER != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_draw/lv_draw.h"
 #include "../lv_themes/lv_theme.h"
 #include "../lv_core/lv_group.h"
@@ -30,6 +31,9 @@
 static bool lv_lmeter_design(lv_obj_t * lmeter, const lv_area_t * mask, lv_design_mode_t mode);
 static lv_res_t lv_lmeter_signal(lv_obj_t * lmeter, lv_signal_t sign, void * param);
 static lv_coord_t lv_lmeter_coord_round(int32_t x);
+static void lv_lmeter_get_line_points(const lv_obj_t * lmeter, uint8_t id, lv_coord_t r_out, lv_coord_t r_in,
+                                      lv_point_t * p_out, lv_point_t * p_in);
+static void lv_lmeter_invalidate_lines(lv_obj_t * lmeter, int16_t old_value);
 
 /**********************
  *  STATIC VARIABLES
@@ -59,7 +63,12 @@ lv_obj_t * lv_lmeter_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(new_lmeter);
     if(new_lmeter == NULL) return NULL;
 
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_lmeter);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_lmeter);
+        lv_signal_reg(lv_lmeter_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_STYLE_CHG) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_REFR_EXT_SIZE) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
 
     /*Allocate the line meter type specific extended data*/
     lv_lmeter_ext_t * ext = lv_obj_allocate_ext_attr(new_lmeter, sizeof(lv_lmeter_ext_t));
@@ -121,9 +130,10 @@ void lv_lmeter_set_value(lv_obj_t * lmeter, int16_t value)
     lv_lmeter_ext_t * ext = lv_obj_get_ext_attr(lmeter);
     if(ext->cur_value == value) return;
 
+    int16_t old_value = ext->cur_value;
     ext->cur_value = value > ext->max_value ? ext->max_value : value;
     ext->cur_value = ext->cur_value < ext->min_value ? ext->min_value : ext->cur_value;
-    lv_obj_invalidate(lmeter);
+    lv_lmeter_invalidate_lines(lmeter, old_value);
 }
 
 /**
@@ -268,9 +278,6 @@ static bool lv_lmeter_design(lv_obj_t * lmeter, const lv_area_t * mask, lv_desig
         lv_coord_t r_in = r_out - style->body.padding.hor;
         if(r_in < 1) r_in = 1;
 
-        lv_coord_t x_ofs = lv_obj_get_width(lmeter) / 2 + lmeter->coords.x1;
-        lv_coord_t y_ofs = lv_obj_get_height(lmeter) / 2 + lmeter->coords.y1;
-        int16_t angle_ofs = 90 + (360 - ext->scale_angle) / 2;
         int16_t level = (int32_t)((int32_t)(ext->cur_value - ext->min_value) * ext->line_cnt) / (ext->max_value - ext->min_value);
         uint8_t i;
 
@@ -281,28 +288,9 @@ static bool lv_lmeter_design(lv_obj_t * lmeter, const lv_area_t * mask, lv_desig
         r_in = r_in << LV_LMETER_LINE_UPSCALE;
 
         for(i = 0; i < ext->line_cnt; i++) {
-            /*Calculate the position a scale label*/
-            int16_t angle = (i * ext->scale_angle) / (ext->line_cnt - 1) + angle_ofs;
-
-            lv_coord_t y_out = (int32_t)((int32_t)lv_trigo_sin(angle) * r_out) >> LV_TRIGO_SHIFT;
-            lv_coord_t x_out = (int32_t)((int32_t)lv_trigo_sin(angle + 90) * r_out) >> LV_TRIGO_SHIFT;
-            lv_coord_t y_in = (int32_t)((int32_t)lv_trigo_sin(angle) * r_in) >> LV_TRIGO_SHIFT;
-            lv_coord_t x_in = (int32_t)((int32_t)lv_trigo_sin(angle + 90) * r_in) >> LV_TRIGO_SHIFT;
-
-            /*Rounding*/
-            x_out = lv_lmeter_coord_round(x_out);
-            x_in  = lv_lmeter_coord_round(x_in);
-            y_out = lv_lmeter_coord_round(y_out);
-            y_in  = lv_lmeter_coord_round(y_in);
-
             lv_point_t p1;
             lv_point_t p2;
-
-            p2.x = x_in + x_ofs;
-            p2.y = y_in +  y_ofs;
-
-            p1.x = x_out + x_ofs;
-            p1.y = y_out + y_ofs;
+            lv_lmeter_get_line_points(lmeter, i, r_out, r_in, &p1, &p2);
 
             if(i >= level) style_tmp.line.color = style->line.color;
             else {
@@ -333,7 +321,7 @@ static lv_res_t lv_lmeter_signal(lv_obj_t * lmeter, lv_signal_t sign, void * par
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(lmeter, sign, param);
+    res = lv_signal_call(ancestor_signal, lmeter, sign, param);
     if(res != LV_RES_OK) return res;
 
     if(sign == LV_SIGNAL_CLEANUP) {
@@ -355,6 +343,105 @@ static lv_res_t lv_lmeter_signal(lv_obj_t * lmeter, lv_signal_t sign, void * par
     return res;
 }
 
+/**
+ * Get the end points of a line of a line meter
+ * @param lmeter pointer to a line meter object
+ * @param id index of the line
+ * @param r_out outer radius (upscaled with `LV_LMETER_LINE_UPSCALE`)
+ * @param r_in inner radius (upscaled with `LV_LMETER_LINE_UPSCALE`)
+ * @param p_out store the outer end point here
+ * @param p_in store the inner end point here
+ */
+static void lv_lmeter_get_line_points(const lv_obj_t * lmeter, uint8_t id, lv_coord_t r_out, lv_coord_t r_in,
+                                      lv_point_t * p_out, lv_point_t * p_in)
+{
+    lv_lmeter_ext_t * ext = lv_obj_get_ext_attr(lmeter);
+    lv_coord_t x_ofs = lv_obj_get_width(lmeter) / 2 + lmeter->coords.x1;
+    lv_coord_t y_ofs = lv_obj_get_height(lmeter) / 2 + lmeter->coords.y1;
+    int16_t angle_ofs = 90 + (360 - ext->scale_angle) / 2;
+
+    /*Calculate the position a scale label*/
+    int16_t angle = (id * ext->scale_angle) / (ext->line_cnt - 1) + angle_ofs;
+
+    lv_coord_t y_out = (int32_t)((int32_t)lv_trigo_sin(angle) * r_out) >> LV_TRIGO_SHIFT;
+    lv_coord_t x_out = (int32_t)((int32_t)lv_trigo_sin(angle + 90) * r_out) >> LV_TRIGO_SHIFT;
+    lv_coord_t y_in = (int32_t)((int32_t)lv_trigo_sin(angle) * r_in) >> LV_TRIGO_SHIFT;
+    lv_coord_t x_in = (int32_t)((int32_t)lv_trigo_sin(angle + 90) * r_in) >> LV_TRIGO_SHIFT;
+
+    /*Rounding*/
+    x_out = lv_lmeter_coord_round(x_out);
+    x_in  = lv_lmeter_coord_round(x_in);
+    y_out = lv_lmeter_coord_round(y_out);
+    y_in  = lv_lmeter_coord_round(y_in);
+
+    p_in->x = x_in + x_ofs;
+    p_in->y = y_in +  y_ofs;
+
+    p_out->x = x_out + x_ofs;
+    p_out->y = y_out + y_ofs;
+}
+
+/**
+ * Invalidate only the lines of a line meter which change color because of a new value
+ * @param lmeter pointer to a line meter object
+ * @param old_value the value before the change (the new value is already set)
+ */
+static void lv_lmeter_invalidate_lines(lv_obj_t * lmeter, int16_t old_value)
+{
+    /*The derived objects (e.g. gauge) draw more things which depend on the value*/
+    if(lv_obj_get_design_func(lmeter) != lv_lmeter_design) {
+        lv_obj_invalidate(lmeter);
+        return;
+    }
+
+    lv_lmeter_ext_t * ext = lv_obj_get_ext_attr(lmeter);
+    int16_t range = ext->max_value - ext->min_value;
+    int16_t old_level = (int32_t)((int32_t)(old_value - ext->min_value) * ext->line_cnt) / range;
+    int16_t new_level = (int32_t)((int32_t)(ext->cur_value - ext->min_value) * ext->line_cnt) / range;
+    if(old_level == new_level) return;
+
+    /*Same geometry as in the design function*/
+    lv_style_t * style = lv_obj_get_style(lmeter);
+    lv_coord_t r_out = lv_obj_get_width(lmeter) / 2;
+    lv_coord_t r_in = r_out - style->body.padding.hor;
+    if(r_in < 1) r_in = 1;
+    r_out = r_out << LV_LMETER_LINE_UPSCALE;
+    r_in = r_in << LV_LMETER_LINE_UPSCALE;
+
+    /*The lines with index in [min level, max level) change color*/
+    int16_t first = LV_MATH_MIN(old_level, new_level);
+    int16_t last = LV_MATH_MAX(old_level, new_level) - 1;
+    if(last >= ext->line_cnt) last = ext->line_cnt - 1;
+
+    lv_area_t area;
+    area.x1 = LV_COORD_MAX;
+    area.y1 = LV_COORD_MAX;
+    area.x2 = LV_COORD_MIN;
+    area.y2 = LV_COORD_MIN;
+
+    int16_t i;
+    for(i = first; i <= last; i++) {
+        lv_point_t p1;
+        lv_point_t p2;
+        lv_lmeter_get_line_points(lmeter, i, r_out, r_in, &p1, &p2);
+        area.x1 = LV_MATH_MIN(area.x1, LV_MATH_MIN(p1.x, p2.x));
+        area.y1 = LV_MATH_MIN(area.y1, LV_MATH_MIN(p1.y, p2.y));
+        area.x2 = LV_MATH_MAX(area.x2, LV_MATH_MAX(p1.x, p2.x));
+        area.y2 = LV_MATH_MAX(area.y2, LV_MATH_MAX(p1.y, p2.y));
+    }
+
+    if(area.x1 > area.x2) return;
+
+    /*Add the line width (+1 if focused) and some extra space for anti-aliasing*/
+    lv_coord_t ext_size = style->line.width / 2 + 3;
+    area.x1 -= ext_size;
+    area.y1 -= ext_size;
+    area.x2 += ext_size;
+    area.y2 += ext_size;
+
+    lv_obj_invalidate_area(lmeter, &area);
+}
+
 /**
  * Round a coordinate which is upscaled  (>=x.5 -> x + 1;   <x.5 -> x)
  * @param x a coordinate which is greater then it should be
@@ -10,6 +10,7 @@
 #include "lv_mbox.h"
 #if USE_LV_MBOX != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_core/lv_group.h"
 #include "../lv_themes/lv_theme.h"
 #include "../lv_misc/lv_anim.h"
@@ -68,7 +69,14 @@ lv_obj_t * lv_mbox_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(new_mbox);
     if(new_mbox == NULL) return NULL;
 
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_mbox);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_mbox);
+        lv_signal_reg(lv_mbox_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CORD_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_STYLE_CHG) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE) | LV_SIGNAL_BIT(LV_SIGNAL_FOCUS) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_DEFOCUS) | LV_SIGNAL_BIT(LV_SIGNAL_CONTROLL) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_GET_EDITABLE));
+    }
 
     /*Allocate the message box type specific extended data*/
     lv_mbox_ext_t * ext = lv_obj_allocate_ext_attr(new_mbox, sizeof(lv_mbox_ext_t));
@@ -417,7 +425,7 @@ static lv_res_t lv_mbox_signal(lv_obj_t * mbox, lv_signal_t sign, void * param)
     }
 
     /* Include the ancient signal function */
-    res = ancestor_signal(mbox, sign, param);
+    res = lv_signal_call(ancestor_signal, mbox, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_mbox_ext_t * ext = lv_obj_get_ext_attr(mbox);
@@ -431,7 +439,7 @@ static lv_res_t lv_mbox_signal(lv_obj_t * mbox, lv_signal_t sign, void * param)
     } else if(sign == LV_SIGNAL_FOCUS || sign == LV_SIGNAL_DEFOCUS ||
               sign == LV_SIGNAL_CONTROLL || sign == LV_SIGNAL_GET_EDITABLE) {
         if(ext->btnm) {
-            ext->btnm->signal_func(ext->btnm, sign, param);
+            lv_signal_send(ext->btnm, sign, param);
         }
 
         /* The button matrix with ENCODER input supposes it's in a group but in this case it isn't (Only the message box's container)
@@ -16,6 +16,8 @@
 //#include "lv_templ.h" /*TODO uncomment this*/
 #if USE_LV_TEMPL != 0
 
+#include "../lv_core/lv_signal.h"
+
 /*********************
  *      DEFINES
  *********************/
@@ -64,7 +66,11 @@ lv_obj_t * lv_templ_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_templ_ext_t * ext = lv_obj_allocate_ext_attr(new_templ, sizeof(lv_templ_ext_t));
     lv_mem_assert(ext);
     if(ext == NULL) return NULL;
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_templ);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_templ);
+        lv_signal_reg(lv_templ_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
     if(ancestor_design == NULL) ancestor_design = lv_obj_get_design_func(new_templ);
 
     /*Initialize the allocated 'ext' */
@@ -210,7 +216,7 @@ static lv_res_t lv_templ_signal(lv_obj_t * templ, lv_signal_t sign, void * param
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(templ, sign, param);
+    res = lv_signal_call(ancestor_signal, templ, sign, param);
     if(res != LV_RES_OK) return res;
 
 
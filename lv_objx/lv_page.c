@@ -9,6 +9,7 @@
 #include "../lv_objx/lv_page.h"
 #if USE_LV_PAGE != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_core/lv_group.h"
 #include "../lv_draw/lv_draw.h"
 #include "../lv_themes/lv_theme.h"
@@ -69,7 +70,19 @@ lv_obj_t * lv_page_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(new_page);
     if(new_page == NULL) return NULL;
 
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_page);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_page);
+        lv_signal_reg(lv_page_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CHILD_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_CORD_CHG) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_STYLE_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_REFR_EXT_SIZE) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE) | LV_SIGNAL_BIT(LV_SIGNAL_PRESSED) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_RELEASED) | LV_SIGNAL_BIT(LV_SIGNAL_CONTROLL) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_GET_EDITABLE));
+        lv_signal_reg(lv_page_scrollable_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CORD_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_PRESSED) | LV_SIGNAL_BIT(LV_SIGNAL_RELEASED) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_DRAG_END));
+    }
     if(ancestor_design == NULL) ancestor_design = lv_obj_get_design_func(new_page);
 
     /*Allocate the object type specific extended data*/
@@ -464,6 +477,7 @@ void lv_page_focus(lv_obj_t * page, const lv_obj_t * obj, uint16_t anim_time)
     lv_style_t * style = lv_page_get_style(page, LV_PAGE_STYLE_BG);
     lv_style_t * style_scrl = lv_page_get_style(page, LV_PAGE_STYLE_SCRL);
 
+    lv_obj_update_coords(obj);
     lv_coord_t obj_y = obj->coords.y1 - ext->scrl->coords.y1;
     lv_coord_t obj_h = lv_obj_get_height(obj);
     lv_coord_t scrlable_y = lv_obj_get_y(ext->scrl);
@@ -761,7 +775,7 @@ static lv_res_t lv_page_signal(lv_obj_t * page, lv_signal_t sign, void * param)
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(page, sign, param);
+    res = lv_signal_call(ancestor_signal, page, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_page_ext_t * ext = lv_obj_get_ext_attr(page);
@@ -783,7 +797,7 @@ static lv_res_t lv_page_signal(lv_obj_t * page, lv_signal_t sign, void * param)
         if(lv_cont_get_hor_fit(ext->scrl) == false) {
             lv_obj_set_width(ext->scrl, lv_obj_get_width(page) - 2 * style->body.padding.hor);
         } else {
-            ext->scrl->signal_func(ext->scrl, LV_SIGNAL_CORD_CHG, &ext->scrl->coords);
+            lv_signal_send(ext->scrl, LV_SIGNAL_CORD_CHG, &ext->scrl->coords);
         }
 
         /*The scrollbars are important only if they are visible now*/
@@ -800,7 +814,7 @@ static lv_res_t lv_page_signal(lv_obj_t * page, lv_signal_t sign, void * param)
                 lv_obj_set_width(ext->scrl, lv_obj_get_width(page) - 2 * style->body.padding.hor);
             }
 
-            ext->scrl->signal_func(ext->scrl, LV_SIGNAL_CORD_CHG, &ext->scrl->coords);
+            lv_signal_send(ext->scrl, LV_SIGNAL_CORD_CHG, &ext->scrl->coords);
 
             /*The scrollbars are important only if they are visible now*/
             if(ext->sb.hor_draw || ext->sb.ver_draw) lv_page_sb_refresh(page);
@@ -862,7 +876,7 @@ static lv_res_t lv_page_scrollable_signal(lv_obj_t * scrl, lv_signal_t sign, voi
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(scrl, sign, param);
+    res = lv_signal_call(ancestor_signal, scrl, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_obj_t * page = lv_obj_get_parent(scrl);
@@ -1042,6 +1056,8 @@ static lv_res_t lv_page_scrollable_signal(lv_obj_t * scrl, lv_signal_t sign, voi
  */
 static void lv_page_sb_refresh(lv_obj_t * page)
 {
+    lv_obj_update_coords(page);
+
     lv_page_ext_t * ext = lv_obj_get_ext_attr(page);
     lv_style_t * style = lv_obj_get_style(page);
     lv_obj_t * scrl = ext->scrl;
@@ -9,6 +9,7 @@
 #include "lv_preload.h"
 #if USE_LV_PRELOAD != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_misc/lv_math.h"
 #include "../lv_draw/lv_draw_rect.h"
 #include "../lv_draw/lv_draw_arc.h"
@@ -29,6 +30,10 @@
 # define LV_PRELOAD_DEF_ANIM        LV_PRELOAD_TYPE_SPINNING_ARC    /*animation type*/
 #endif
 
+#ifndef LV_PRELOAD_DEF_ANGLE_CACHE
+# define LV_PRELOAD_DEF_ANGLE_CACHE 1       /*Calculate the angles of the arc's pixels only once*/
+#endif
+
 
 /**********************
  *      TYPEDEFS
@@ -74,7 +79,11 @@ lv_obj_t * lv_preload_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(ext);
     if(ext == NULL) return NULL;
 
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_preload);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_preload);
+        lv_signal_reg(lv_preload_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
     if(ancestor_design == NULL) ancestor_design = lv_obj_get_design_func(new_preload);
 
     /*Initialize the allocated 'ext' */
@@ -100,6 +109,9 @@ lv_obj_t * lv_preload_create(lv_obj_t * par, const lv_obj_t * copy)
 
         ext->time = LV_PRELOAD_DEF_SPIN_TIME;
 
+        /*The arc is redrawn continuously so don't calculate its pixels' angles again and again*/
+        lv_arc_set_angle_cache(new_preload, LV_PRELOAD_DEF_ANGLE_CACHE);
+
     }
     /*Copy an existing pre loader*/
     else {
@@ -390,7 +402,7 @@ static lv_res_t lv_preload_signal(lv_obj_t * preload, lv_signal_t sign, void * p
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(preload, sign, param);
+    res = lv_signal_call(ancestor_signal, preload, sign, param);
     if(res != LV_RES_OK) return res;
 
 
@@ -9,6 +9,7 @@
 #include "lv_roller.h"
 #if USE_LV_ROLLER != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_draw/lv_draw.h"
 #include "../lv_core/lv_group.h"
 #include "../lv_themes/lv_theme.h"
@@ -290,6 +291,9 @@ static bool lv_roller_design(lv_obj_t * roller, const lv_area_t * mask, lv_desig
         bool area_ok;
         area_ok = lv_area_intersect(&mask_sel, mask, &rect_area);
         if(area_ok) {
+            /*The label might be not drawn (so not moved) if it's out of the mask*/
+            lv_obj_update_coords(ext->ddlist.label);
+
             lv_style_t * sel_style = lv_roller_get_style(roller, LV_ROLLER_STYLE_SEL);
             lv_style_t new_style;
             lv_txt_flag_t txt_align = LV_TXT_FLAG_NONE;
@@ -329,7 +333,7 @@ static lv_res_t lv_roller_signal(lv_obj_t * roller, lv_signal_t sign, void * par
     /*Don't let the drop down list to handle the control signals. It works differently*/
     if(sign != LV_SIGNAL_CONTROLL && sign != LV_SIGNAL_FOCUS && sign != LV_SIGNAL_DEFOCUS) {
         /* Include the ancient signal function */
-        res = ancestor_signal(roller, sign, param);
+        res = lv_signal_call(ancestor_signal, roller, sign, param);
         if(res != LV_RES_OK) return res;
     }
 
@@ -436,7 +440,7 @@ static lv_res_t lv_roller_scrl_signal(lv_obj_t * roller_scrl, lv_signal_t sign,
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_scrl_signal(roller_scrl, sign, param);
+    res = lv_signal_call(ancestor_scrl_signal, roller_scrl, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_indev_t * indev = lv_indev_get_act();
@@ -452,6 +456,7 @@ static lv_res_t lv_roller_scrl_signal(lv_obj_t * roller_scrl, lv_signal_t sign,
 
     if(sign == LV_SIGNAL_DRAG_END) {
         /*If dragged then align the list to there be an element in the middle*/
+        lv_obj_update_coords(ext->ddlist.label);
         lv_coord_t label_y1 = ext->ddlist.label->coords.y1 - roller->coords.y1;
         lv_coord_t label_unit = font_h + style_label->text.line_space;
         lv_coord_t mid = (roller->coords.y2 - roller->coords.y1) / 2;
@@ -554,6 +559,7 @@ static void refr_position(lv_obj_t * roller, bool anim_en)
     lv_coord_t font_h = lv_font_get_height(font);
     lv_coord_t h = lv_obj_get_height(roller);
     int32_t id = ext->ddlist.sel_opt_id;
+    lv_obj_update_coords(ext->ddlist.label);
     lv_coord_t line_y1 = id * (font_h + style_label->text.line_space) + ext->ddlist.label->coords.y1 - roller_scrl->coords.y1;
     lv_coord_t new_y = - line_y1 + (h - font_h) / 2;
 
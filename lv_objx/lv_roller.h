@@ -82,6 +82,17 @@ static inline void lv_roller_set_options(lv_obj_t * roller, const char * options
     lv_ddlist_set_options(roller, options);
 }
 
+/**
+ * Set the options on a roller from a static string. It will not be saved by the roller
+ * so the `options` variable has to be 'alive' while the roller exists.
+ * @param roller pointer to roller object
+ * @param options a string with '\n' separated options. E.g. "One\nTwo\nThree"
+ */
+static inline void lv_roller_set_static_options(lv_obj_t * roller, const char * options)
+{
+    lv_ddlist_set_static_options(roller, options);
+}
+
 /**
  * Set the selected option
  * @param roller pointer to a roller object
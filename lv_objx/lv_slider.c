@@ -10,6 +10,7 @@
 #include "lv_slider.h"
 #if USE_LV_SLIDER != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_core/lv_group.h"
 #include "../lv_draw/lv_draw.h"
 #include "../lv_themes/lv_theme.h"
@@ -30,6 +31,9 @@
  **********************/
 static bool lv_slider_design(lv_obj_t * slider, const lv_area_t * mask, lv_design_mode_t mode);
 static lv_res_t lv_slider_signal(lv_obj_t * slider, lv_signal_t sign, void * param);
+static void lv_slider_get_areas(const lv_obj_t * slider, int16_t value, lv_area_t * area_bg,
+                                lv_area_t * area_indic, lv_area_t * knob_area);
+static void lv_slider_invalidate_value(lv_obj_t * slider, int16_t old_value, int16_t new_value);
 
 /**********************
  *  STATIC VARIABLES
@@ -61,7 +65,15 @@ lv_obj_t * lv_slider_create(lv_obj_t * par, const lv_obj_t * copy)
     if(new_slider == NULL) return NULL;
 
     if(ancestor_design_f == NULL) ancestor_design_f = lv_obj_get_design_func(new_slider);
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_slider);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_slider);
+        lv_signal_reg(lv_slider_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CORD_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_REFR_EXT_SIZE) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE) | LV_SIGNAL_BIT(LV_SIGNAL_PRESSED) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_PRESSING) | LV_SIGNAL_BIT(LV_SIGNAL_PRESS_LOST) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_RELEASED) | LV_SIGNAL_BIT(LV_SIGNAL_CONTROLL) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_GET_EDITABLE));
+    }
 
     /*Allocate the slider type specific extended data*/
     lv_slider_ext_t * ext = lv_obj_allocate_ext_attr(new_slider, sizeof(lv_slider_ext_t));
@@ -114,6 +126,27 @@ lv_obj_t * lv_slider_create(lv_obj_t * par, const lv_obj_t * copy)
  * Setter functions
  *====================*/
 
+/**
+ * Set a new value on the slider
+ * @param slider pointer to a slider object
+ * @param value new value
+ */
+void lv_slider_set_value(lv_obj_t * slider, int16_t value)
+{
+    lv_slider_ext_t * ext = lv_obj_get_ext_attr(slider);
+    if(ext->bar.cur_value == value) return;
+
+    /*Set the value directly because `lv_bar_set_value` would invalidate the whole slider*/
+    int16_t old_value = ext->bar.cur_value;
+    ext->bar.cur_value = value > ext->bar.max_value ? ext->bar.max_value : value;
+    ext->bar.cur_value = ext->bar.cur_value < ext->bar.min_value ? ext->bar.min_value : ext->bar.cur_value;
+
+    /*While dragging the drag value is drawn*/
+    if(ext->drag_value == LV_SLIDER_NOT_PRESSED) {
+        lv_slider_invalidate_value(slider, old_value, ext->bar.cur_value);
+    }
+}
+
 /**
  * Set a function which will be called when a new value is set on the slider
  * @param slider pointer to slider object
@@ -267,43 +300,17 @@ static bool lv_slider_design(lv_obj_t * slider, const lv_area_t * mask, lv_desig
     }
     /*Draw the object*/
     else if(mode == LV_DESIGN_DRAW_MAIN) {
-        lv_slider_ext_t * ext = lv_obj_get_ext_attr(slider);
-
         lv_style_t * style_bg = lv_slider_get_style(slider, LV_SLIDER_STYLE_BG);
         lv_style_t * style_knob = lv_slider_get_style(slider, LV_SLIDER_STYLE_KNOB);
         lv_style_t * style_indic = lv_slider_get_style(slider, LV_SLIDER_STYLE_INDIC);
 
         lv_opa_t opa_scale = lv_obj_get_opa_scale(slider);
 
-        lv_coord_t slider_w = lv_area_get_width(&slider->coords);
-        lv_coord_t slider_h = lv_area_get_height(&slider->coords);
-
-        /*Draw the bar*/
         lv_area_t area_bg;
-        lv_area_copy(&area_bg, &slider->coords);
-
-        /*Be sure at least LV_SLIDER_SIZE_MIN  size will remain*/
-        lv_coord_t pad_ver_bg = style_bg->body.padding.ver;
-        lv_coord_t pad_hor_bg = style_bg->body.padding.hor;
-        if(pad_ver_bg * 2 + LV_SLIDER_SIZE_MIN > lv_area_get_height(&area_bg)) {
-            pad_ver_bg = (lv_area_get_height(&area_bg) - LV_SLIDER_SIZE_MIN) >> 1;
-        }
-        if(pad_hor_bg * 2 + LV_SLIDER_SIZE_MIN > lv_area_get_width(&area_bg)) {
-            pad_hor_bg = (lv_area_get_width(&area_bg) - LV_SLIDER_SIZE_MIN) >> 1;
-        }
-
-        if(ext->knob_in) {  /*Enable extra size if the knob is inside */
-            area_bg.x1 += pad_hor_bg;
-            area_bg.x2 -= pad_hor_bg;
-            area_bg.y1 += pad_hor_bg;
-            area_bg.y2 -= pad_hor_bg;
-        } else  { /*Let space only in the perpendicular directions*/
-            area_bg.x1 += slider_w < slider_h ? pad_hor_bg : 0;   /*Pad only for vertical slider*/
-            area_bg.x2 -= slider_w < slider_h ? pad_hor_bg : 0;   /*Pad only for vertical slider*/
-            area_bg.y1 += slider_w > slider_h ? pad_ver_bg : 0;   /*Pad only for horizontal slider*/
-            area_bg.y2 -= slider_w > slider_h ? pad_ver_bg : 0;   /*Pad only for horizontal slider*/
-        }
-
+        lv_area_t area_indic;
+        lv_area_t knob_area;
+        int16_t cur_value = lv_slider_get_value(slider);
+        lv_slider_get_areas(slider, cur_value, &area_bg, &area_indic, &knob_area);
 
 #if USE_LV_GROUP == 0
         lv_draw_rect(&area_bg, mask, style_bg, lv_obj_get_opa_scale(slider));
@@ -322,42 +329,7 @@ static bool lv_slider_design(lv_obj_t * slider, const lv_area_t * mask, lv_desig
 
 
         /*Draw the indicator*/
-        lv_area_t area_indic;
-        lv_area_copy(&area_indic, &area_bg);
-
-        /*Be sure at least ver pad/hor pad width indicator will remain*/
-        lv_coord_t pad_ver_indic = style_indic->body.padding.ver;
-        lv_coord_t pad_hor_indic = style_indic->body.padding.hor;
-        if(pad_ver_indic * 2 + LV_SLIDER_SIZE_MIN > lv_area_get_height(&area_bg)) {
-            pad_ver_indic = (lv_area_get_height(&area_bg) - LV_SLIDER_SIZE_MIN) >> 1;
-        }
-        if(pad_hor_indic * 2 + LV_SLIDER_SIZE_MIN > lv_area_get_width(&area_bg)) {
-            pad_hor_indic = (lv_area_get_width(&area_bg) - LV_SLIDER_SIZE_MIN) >> 1;
-        }
-
-        area_indic.x1 += pad_hor_indic;
-        area_indic.x2 -= pad_hor_indic;
-        area_indic.y1 += pad_ver_indic;
-        area_indic.y2 -= pad_ver_indic;
-
-
-        lv_coord_t cur_value = lv_slider_get_value(slider);
-        lv_coord_t min_value = lv_slider_get_min_value(slider);
-        lv_coord_t max_value = lv_slider_get_max_value(slider);
-
-        /*If dragged draw to the drag position*/
-        if(ext->drag_value != LV_SLIDER_NOT_PRESSED) cur_value = ext->drag_value;
-
-        if(slider_w >= slider_h) {
-            area_indic.x2 = (int32_t)((int32_t)(lv_area_get_width(&area_indic)) * (cur_value - min_value)) / (max_value - min_value);
-            area_indic.x2 = area_indic.x1 + area_indic.x2 - 1;
-
-        } else {
-            area_indic.y1 = (int32_t)((int32_t)(lv_area_get_height(&area_indic)) * (cur_value - min_value)) / (max_value - min_value);
-            area_indic.y1 = area_indic.y2 - area_indic.y1 + 1;
-        }
-
-        if(cur_value != min_value) lv_draw_rect(&area_indic, mask, style_indic, opa_scale);
+        if(cur_value != lv_slider_get_min_value(slider)) lv_draw_rect(&area_indic, mask, style_indic, opa_scale);
 
         /*Before the knob add the border if required*/
 #if USE_LV_GROUP
@@ -373,34 +345,6 @@ static bool lv_slider_design(lv_obj_t * slider, const lv_area_t * mask, lv_desig
 #endif
 
         /*Draw the knob*/
-        lv_area_t knob_area;
-        lv_area_copy(&knob_area, &slider->coords);
-
-        if(slider_w >= slider_h) {
-            if(ext->knob_in == 0) {
-                knob_area.x1 = area_indic.x2 - slider_h / 2;
-                knob_area.x2 = knob_area.x1 + slider_h - 1;
-            } else {
-                knob_area.x1 = (int32_t)((int32_t)(slider_w - slider_h - 1) * (cur_value - min_value)) / (max_value - min_value);
-                knob_area.x1 += slider->coords.x1;
-                knob_area.x2 = knob_area.x1 + slider_h - 1;
-            }
-
-            knob_area.y1 = slider->coords.y1;
-            knob_area.y2 = slider->coords.y2;
-        } else {
-            if(ext->knob_in == 0) {
-                knob_area.y1 = area_indic.y1 - slider_w / 2;
-                knob_area.y2 = knob_area.y1 + slider_w - 1;
-            } else {
-                knob_area.y2 = (int32_t)((int32_t)(slider_h - slider_w - 1) * (cur_value - min_value)) / (max_value - min_value);
-                knob_area.y2 = slider->coords.y2 - knob_area.y2;
-                knob_area.y1 = knob_area.y2 - slider_w - 1;
-            }
-            knob_area.x1 = slider->coords.x1;
-            knob_area.x2 = slider->coords.x2;
-
-        }
         lv_draw_rect(&knob_area, mask, style_knob, opa_scale);
     }
     /*Post draw when the children are drawn*/
@@ -423,7 +367,7 @@ static lv_res_t lv_slider_signal(lv_obj_t * slider, lv_signal_t sign, void * par
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(slider, sign, param);
+    res = lv_signal_call(ancestor_signal, slider, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_slider_ext_t * ext = lv_obj_get_ext_attr(slider);
@@ -452,8 +396,8 @@ static lv_res_t lv_slider_signal(lv_obj_t * slider, lv_signal_t sign, void * par
         else if(tmp > ext->bar.max_value) tmp = ext->bar.max_value;
 
         if(tmp != ext->drag_value) {
+            lv_slider_invalidate_value(slider, ext->drag_value, tmp);
             ext->drag_value = tmp;
-            lv_obj_invalidate(slider);
             if(ext->action != NULL) res = ext->action(slider);
         }
     } else if(sign == LV_SIGNAL_RELEASED || sign == LV_SIGNAL_PRESS_LOST) {
@@ -465,7 +409,7 @@ static lv_res_t lv_slider_signal(lv_obj_t * slider, lv_signal_t sign, void * par
          * During the drawing method the ext. size is used by the knob so refresh the ext. size.*/
         if(lv_obj_get_width(slider) != lv_area_get_width(param) ||
                 lv_obj_get_height(slider) != lv_area_get_height(param)) {
-            slider->signal_func(slider, LV_SIGNAL_REFR_EXT_SIZE, NULL);
+            lv_signal_send(slider, LV_SIGNAL_REFR_EXT_SIZE, NULL);
         }
     } else if(sign == LV_SIGNAL_REFR_EXT_SIZE) {
         lv_style_t * style = lv_slider_get_style(slider, LV_SLIDER_STYLE_BG);
@@ -517,4 +461,184 @@ static lv_res_t lv_slider_signal(lv_obj_t * slider, lv_signal_t sign, void * par
 
     return res;
 }
+
+/**
+ * Get the areas of the parts of a slider with a given value
+ * @param slider pointer to a slider object
+ * @param value get the indicator and knob of this value
+ * @param area_bg store the area of the background here
+ * @param area_indic store the area of the indicator here
+ * @param knob_area store the area of the knob here
+ */
+static void lv_slider_get_areas(const lv_obj_t * slider, int16_t value, lv_area_t * area_bg,
+                                lv_area_t * area_indic, lv_area_t * knob_area)
+{
+    lv_slider_ext_t * ext = lv_obj_get_ext_attr(slider);
+    lv_style_t * style_bg = lv_slider_get_style(slider, LV_SLIDER_STYLE_BG);
+    lv_style_t * style_indic = lv_slider_get_style(slider, LV_SLIDER_STYLE_INDIC);
+
+    lv_coord_t slider_w = lv_area_get_width(&slider->coords);
+    lv_coord_t slider_h = lv_area_get_height(&slider->coords);
+
+    /*The background*/
+    lv_area_copy(area_bg, &slider->coords);
+
+    /*Be sure at least LV_SLIDER_SIZE_MIN  size will remain*/
+    lv_coord_t pad_ver_bg = style_bg->body.padding.ver;
+    lv_coord_t pad_hor_bg = style_bg->body.padding.hor;
+    if(pad_ver_bg * 2 + LV_SLIDER_SIZE_MIN > lv_area_get_height(area_bg)) {
+        pad_ver_bg = (lv_area_get_height(area_bg) - LV_SLIDER_SIZE_MIN) >> 1;
+    }
+    if(pad_hor_bg * 2 + LV_SLIDER_SIZE_MIN > lv_area_get_width(area_bg)) {
+        pad_hor_bg = (lv_area_get_width(area_bg) - LV_SLIDER_SIZE_MIN) >> 1;
+    }
+
+    if(ext->knob_in) {  /*Enable extra size if the knob is inside */
+        area_bg->x1 += pad_hor_bg;
+        area_bg->x2 -= pad_hor_bg;
+        area_bg->y1 += pad_hor_bg;
+        area_bg->y2 -= pad_hor_bg;
+    } else  { /*Let space only in the perpendicular directions*/
+        area_bg->x1 += slider_w < slider_h ? pad_hor_bg : 0;   /*Pad only for vertical slider*/
+        area_bg->x2 -= slider_w < slider_h ? pad_hor_bg : 0;   /*Pad only for vertical slider*/
+        area_bg->y1 += slider_w > slider_h ? pad_ver_bg : 0;   /*Pad only for horizontal slider*/
+        area_bg->y2 -= slider_w > slider_h ? pad_ver_bg : 0;   /*Pad only for horizontal slider*/
+    }
+
+    /*The indicator*/
+    lv_area_copy(area_indic, area_bg);
+
+    /*Be sure at least ver pad/hor pad width indicator will remain*/
+    lv_coord_t pad_ver_indic = style_indic->body.padding.ver;
+    lv_coord_t pad_hor_indic = style_indic->body.padding.hor;
+    if(pad_ver_indic * 2 + LV_SLIDER_SIZE_MIN > lv_area_get_height(area_bg)) {
+        pad_ver_indic = (lv_area_get_height(area_bg) - LV_SLIDER_SIZE_MIN) >> 1;
+    }
+    if(pad_hor_indic * 2 + LV_SLIDER_SIZE_MIN > lv_area_get_width(area_bg)) {
+        pad_hor_indic = (lv_area_get_width(area_bg) - LV_SLIDER_SIZE_MIN) >> 1;
+    }
+
+    area_indic->x1 += pad_hor_indic;
+    area_indic->x2 -= pad_hor_indic;
+    area_indic->y1 += pad_ver_indic;
+    area_indic->y2 -= pad_ver_indic;
+
+    lv_coord_t min_value = lv_slider_get_min_value(slider);
+    lv_coord_t max_value = lv_slider_get_max_value(slider);
+
+    if(slider_w >= slider_h) {
+        area_indic->x2 = (int32_t)((int32_t)(lv_area_get_width(area_indic)) * (value - min_value)) / (max_value - min_value);
+        area_indic->x2 = area_indic->x1 + area_indic->x2 - 1;
+
+    } else {
+        area_indic->y1 = (int32_t)((int32_t)(lv_area_get_height(area_indic)) * (value - min_value)) / (max_value - min_value);
+        area_indic->y1 = area_indic->y2 - area_indic->y1 + 1;
+    }
+
+    /*The knob*/
+    lv_area_copy(knob_area, &slider->coords);
+
+    if(slider_w >= slider_h) {
+        if(ext->knob_in == 0) {
+            knob_area->x1 = area_indic->x2 - slider_h / 2;
+            knob_area->x2 = knob_area->x1 + slider_h - 1;
+        } else {
+            knob_area->x1 = (int32_t)((int32_t)(slider_w - slider_h - 1) * (value - min_value)) / (max_value - min_value);
+            knob_area->x1 += slider->coords.x1;
+            knob_area->x2 = knob_area->x1 + slider_h - 1;
+        }
+
+        knob_area->y1 = slider->coords.y1;
+        knob_area->y2 = slider->coords.y2;
+    } else {
+        if(ext->knob_in == 0) {
+            knob_area->y1 = area_indic->y1 - slider_w / 2;
+            knob_area->y2 = knob_area->y1 + slider_w - 1;
+        } else {
+            knob_area->y2 = (int32_t)((int32_t)(slider_h - slider_w - 1) * (value - min_value)) / (max_value - min_value);
+            knob_area->y2 = slider->coords.y2 - knob_area->y2;
+            knob_area->y1 = knob_area->y2 - slider_w - 1;
+        }
+        knob_area->x1 = slider->coords.x1;
+        knob_area->x2 = slider->coords.x2;
+
+    }
+}
+
+/**
+ * Invalidate only the part of a slider which is changed by a new value:
+ * the old and new knob and the segment between the old and new end of the indicator.
+ * @param slider pointer to a slider object
+ * @param old_value the previously drawn value
+ * @param new_value the value to draw
+ */
+static void lv_slider_invalidate_value(lv_obj_t * slider, int16_t old_value, int16_t new_value)
+{
+    if(old_value == new_value) return;
+
+    lv_style_t * style_indic = lv_slider_get_style(slider, LV_SLIDER_STYLE_INDIC);
+    lv_coord_t slider_w = lv_obj_get_width(slider);
+    lv_coord_t slider_h = lv_obj_get_height(slider);
+    bool hor = slider_w >= slider_h ? true : false;
+
+    /*The gradient is vertical so on a vertical slider every pixel of the indicator can change*/
+    if(!hor && style_indic->body.main_color.full != style_indic->body.grad_color.full) {
+        lv_obj_invalidate(slider);
+        return;
+    }
+
+    lv_obj_update_coords(slider);
+
+    lv_area_t area_bg;
+    lv_area_t old_indic;
+    lv_area_t new_indic;
+    lv_area_t old_knob;
+    lv_area_t new_knob;
+    lv_slider_get_areas(slider, old_value, &area_bg, &old_indic, &old_knob);
+    lv_slider_get_areas(slider, new_value, &area_bg, &new_indic, &new_knob);
+
+    /*The rounded end of the indicator is redrawn too*/
+    lv_coord_t r = style_indic->body.radius;
+    lv_coord_t cross = hor ? lv_area_get_height(&new_indic) : lv_area_get_width(&new_indic);
+    if(r > cross / 2) r = cross / 2;
+
+    lv_coord_t old_len = hor ? lv_area_get_width(&old_indic) : lv_area_get_height(&old_indic);
+    lv_coord_t new_len = hor ? lv_area_get_width(&new_indic) : lv_area_get_height(&new_indic);
+
+    /*Range on the main axis between the moving ends of the indicator and the knobs.
+     * Redraw the whole indicator if it's too short for its radius (or not drawn at all)*/
+    lv_coord_t min;
+    lv_coord_t max;
+    if(hor) {
+        min = LV_MATH_MIN(old_indic.x2, new_indic.x2) - r;
+        max = LV_MATH_MAX(old_indic.x2, new_indic.x2) + r;
+        if(old_len <= 2 * r || new_len <= 2 * r) min = new_indic.x1;
+        min = LV_MATH_MIN(min, LV_MATH_MIN(old_knob.x1, new_knob.x1));
+        max = LV_MATH_MAX(max, LV_MATH_MAX(old_knob.x2, new_knob.x2));
+    } else {
+        min = LV_MATH_MIN(old_indic.y1, new_indic.y1) - r;
+        max = LV_MATH_MAX(old_indic.y1, new_indic.y1) + r;
+        if(old_len <= 2 * r || new_len <= 2 * r) max = new_indic.y2;
+        min = LV_MATH_MIN(min, LV_MATH_MIN(old_knob.y1, new_knob.y1));
+        max = LV_MATH_MAX(max, LV_MATH_MAX(old_knob.y2, new_knob.y2));
+    }
+
+    /*The shadows are in the extra size of the slider. +1 for anti-aliasing*/
+    lv_coord_t ext_size = slider->ext_size + 1;
+    lv_area_t inv_area;
+    if(hor) {
+        inv_area.x1 = min - ext_size;
+        inv_area.x2 = max + ext_size;
+        inv_area.y1 = slider->coords.y1 - ext_size;
+        inv_area.y2 = slider->coords.y2 + ext_size;
+    } else {
+        inv_area.x1 = slider->coords.x1 - ext_size;
+        inv_area.x2 = slider->coords.x2 + ext_size;
+        inv_area.y1 = min - ext_size;
+        inv_area.y2 = max + ext_size;
+    }
+
+    lv_obj_invalidate_area(slider, &inv_area);
+}
+
 #endif
@@ -77,10 +77,7 @@ lv_obj_t * lv_slider_create(lv_obj_t * par, const lv_obj_t * copy);
  * @param slider pointer to a slider object
  * @param value new value
  */
-static inline void lv_slider_set_value(lv_obj_t * slider, int16_t value)
-{
-    lv_bar_set_value(slider, value);
-}
+void lv_slider_set_value(lv_obj_t * slider, int16_t value);
 
 /**
  * Set a new value with animation on a slider
@@ -9,6 +9,7 @@
 #include "lv_spinbox.h"
 
 #if USE_LV_SPINBOX != 0
+#include "../lv_core/lv_signal.h"
 #include "../lv_themes/lv_theme.h"
 #include "../lv_misc/lv_math.h"
 
@@ -336,7 +337,7 @@ static lv_res_t lv_spinbox_signal(lv_obj_t * spinbox, lv_signal_t sign, void * p
     /* Include the ancient signal function */
     if(sign != LV_SIGNAL_CONTROLL)
     {
-        res = ancestor_signal(spinbox, sign, param);
+        res = lv_signal_call(ancestor_signal, spinbox, sign, param);
         if(res != LV_RES_OK) return res;
     }
 
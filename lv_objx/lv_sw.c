@@ -10,6 +10,8 @@
 
 #if USE_LV_SW != 0
 
+#include "../lv_core/lv_signal.h"
+
 /*Testing of dependencies*/
 #if USE_LV_SLIDER == 0
 #error "lv_sw: lv_slider is required. Enable it in lv_conf.h (USE_LV_SLIDER  1) "
@@ -316,7 +318,7 @@ static lv_res_t lv_sw_signal(lv_obj_t * sw, lv_signal_t sign, void * param)
 
     lv_res_t res;
     /* Include the ancient signal function */
-    res = ancestor_signal(sw, sign, param);
+    res = lv_signal_call(ancestor_signal, sw, sign, param);
     if(res != LV_RES_OK) return res;
 
     if(sign == LV_SIGNAL_CLEANUP) {
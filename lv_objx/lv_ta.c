@@ -10,6 +10,7 @@
 #include "lv_ta.h"
 #if USE_LV_TA != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_core/lv_group.h"
 #include "../lv_core/lv_refr.h"
 #include "../lv_draw/lv_draw.h"
@@ -17,6 +18,8 @@
 #include "../lv_misc/lv_anim.h"
 #include "../lv_misc/lv_txt.h"
 #include "../lv_misc/lv_math.h"
+#include "../lv_misc/lv_task.h"
+#include "../lv_misc/lv_gc.h"
 
 /*********************
  *      DEFINES
@@ -46,13 +49,17 @@ static bool lv_ta_scrollable_design(lv_obj_t * scrl, const lv_area_t * mask, lv_
 static lv_res_t lv_ta_signal(lv_obj_t * ta, lv_signal_t sign, void * param);
 static lv_res_t lv_ta_scrollable_signal(lv_obj_t * scrl, lv_signal_t sign, void * param);
 #if USE_LV_ANIMATION
-static void cursor_blink_anim(lv_obj_t * ta, uint8_t show);
+static void cursor_blink_task(void * param);
+static void cursor_blink_reg(lv_obj_t * ta);
+static void cursor_blink_unreg(lv_obj_t * ta);
+static void cursor_blink_reset(lv_obj_t * ta);
 static void pwd_char_hider_anim(lv_obj_t * ta, int32_t x);
 #endif
 static void pwd_char_hider(lv_obj_t * ta);
 static bool char_is_accepted(lv_obj_t * ta, uint32_t c);
 static void get_cursor_style(lv_obj_t * ta, lv_style_t * style_res);
 static void refr_cursor_area(lv_obj_t * ta);
+static void inv_cursor_area(lv_obj_t * ta);
 
 /**********************
  *  STATIC VARIABLES
@@ -61,6 +68,9 @@ static lv_design_func_t ancestor_design;
 static lv_design_func_t scrl_design;
 static lv_signal_func_t ancestor_signal;
 static lv_signal_func_t scrl_signal;
+#if USE_LV_ANIMATION
+static lv_task_t * blink_task;
+#endif
 
 /**********************
  *      MACROS
@@ -85,9 +95,21 @@ lv_obj_t * lv_ta_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(new_ta);
     if(new_ta == NULL) return NULL;
 
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_ta);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_ta);
+        lv_signal_reg(lv_ta_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_CORD_CHG) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_STYLE_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_FOCUS) | LV_SIGNAL_BIT(LV_SIGNAL_DEFOCUS) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_CONTROLL) | LV_SIGNAL_BIT(LV_SIGNAL_GET_EDITABLE));
+    }
     if(ancestor_design == NULL) ancestor_design = lv_obj_get_design_func(new_ta);
-    if(scrl_signal == NULL) scrl_signal = lv_obj_get_signal_func(lv_page_get_scrl(new_ta));
+    if(scrl_signal == NULL) {
+        scrl_signal = lv_obj_get_signal_func(lv_page_get_scrl(new_ta));
+        lv_signal_reg(lv_ta_scrollable_signal, scrl_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CORD_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_REFR_EXT_SIZE) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
     if(scrl_design == NULL) scrl_design = lv_obj_get_design_func(lv_page_get_scrl(new_ta));
 
     /*Allocate the object type specific extended data*/
@@ -96,6 +118,8 @@ lv_obj_t * lv_ta_create(lv_obj_t * par, const lv_obj_t * copy)
     if(ext == NULL) return NULL;
 
     ext->cursor.state = 1;
+    ext->cursor.blink_hold = 0;
+    ext->cursor.blink_node = NULL;
     ext->pwd_mode = 0;
     ext->pwd_tmp = NULL;
     ext->accapted_chars = NULL;
@@ -154,21 +178,8 @@ lv_obj_t * lv_ta_create(lv_obj_t * par, const lv_obj_t * copy)
     }
 
 #if USE_LV_ANIMATION
-    /*Create a cursor blinker animation*/
-    lv_anim_t a;
-    a.var = new_ta;
-    a.fp = (lv_anim_fp_t)cursor_blink_anim;
-    a.time = LV_TA_CURSOR_BLINK_TIME;
-    a.act_time = 0;
-    a.end_cb = NULL;
-    a.start = 1;
-    a.end = 0;
-    a.repeat = 1;
-    a.repeat_pause = 0;
-    a.playback = 1;
-    a.playback_pause = 0;
-    a.path = lv_anim_path_step;
-    lv_anim_create(&a);
+    /*Add the cursor to the common blinker task*/
+    cursor_blink_reg(new_ta);
 #endif
 
     LV_LOG_INFO("text area created");
@@ -469,21 +480,8 @@ void lv_ta_set_cursor_pos(lv_obj_t * ta, int16_t pos)
     ext->cursor.valid_x = cur_pos.x;
 
 #if USE_LV_ANIMATION
-    /*Reset cursor blink animation*/
-    lv_anim_t a;
-    a.var = ta;
-    a.fp = (lv_anim_fp_t)cursor_blink_anim;
-    a.time = LV_TA_CURSOR_BLINK_TIME;
-    a.act_time = 0;
-    a.end_cb = NULL;
-    a.start = 1;
-    a.end = 0;
-    a.repeat = 1;
-    a.repeat_pause = 0;
-    a.playback = 1;
-    a.playback_pause = 0;
-    a.path = lv_anim_path_step;
-    lv_anim_create(&a);
+    /*Show the cursor and restart the blinking*/
+    cursor_blink_reset(ta);
 #endif
 
     refr_cursor_area(ta);
@@ -499,6 +497,7 @@ void lv_ta_set_cursor_type(lv_obj_t * ta, lv_cursor_type_t cur_type)
     lv_ta_ext_t * ext = lv_obj_get_ext_attr(ta);
     if(ext->cursor.type == cur_type) return;
 
+    inv_cursor_area(ta);        /*Invalidate the old cursor while its type is known*/
     ext->cursor.type = cur_type;
 
     refr_cursor_area(ta);
@@ -1004,12 +1003,15 @@ static lv_res_t lv_ta_signal(lv_obj_t * ta, lv_signal_t sign, void * param)
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(ta, sign, param);
+    res = lv_signal_call(ancestor_signal, ta, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_ta_ext_t * ext = lv_obj_get_ext_attr(ta);
     if(sign == LV_SIGNAL_CLEANUP) {
         if(ext->pwd_tmp != NULL) lv_mem_free(ext->pwd_tmp);
+#if USE_LV_ANIMATION
+        cursor_blink_unreg(ta);
+#endif
 
         /* (The created label will be deleted automatically) */
     } else if(sign == LV_SIGNAL_STYLE_CHG) {
@@ -1108,7 +1110,7 @@ static lv_res_t lv_ta_scrollable_signal(lv_obj_t * scrl, lv_signal_t sign, void
     lv_ta_ext_t * ext = lv_obj_get_ext_attr(ta);
 
     /* Include the ancient signal function */
-    res = scrl_signal(scrl, sign, param);
+    res = lv_signal_call(scrl_signal, scrl, sign, param);
     if(res != LV_RES_OK) return res;
 
     if(sign == LV_SIGNAL_REFR_EXT_SIZE) {
@@ -1141,29 +1143,83 @@ static lv_res_t lv_ta_scrollable_signal(lv_obj_t * scrl, lv_signal_t sign, void
 #if USE_LV_ANIMATION
 
 /**
- * Called to blink the cursor
+ * Called periodically to blink the cursor of all text areas
+ * @param param unused
+ */
+static void cursor_blink_task(void * param)
+{
+    (void)param;
+
+    lv_obj_t ** ta_p;
+    LL_READ(LV_GC_ROOT(_lv_ta_blink_ll), ta_p) {
+        lv_ta_ext_t * ext = lv_obj_get_ext_attr(*ta_p);
+
+        /*The cursor was moved recently so keep it visible for one more period*/
+        if(ext->cursor.blink_hold) {
+            ext->cursor.blink_hold = 0;
+            continue;
+        }
+
+        ext->cursor.state = ext->cursor.state ? 0 : 1;
+        inv_cursor_area(*ta_p);
+    }
+}
+
+/**
+ * Add a text area to the blinking cursors. Creates the blinker task with the first one.
  * @param ta pointer to a text area
- * @param hide 1: hide the cursor, 0: show it
  */
-static void cursor_blink_anim(lv_obj_t * ta, uint8_t show)
+static void cursor_blink_reg(lv_obj_t * ta)
 {
     lv_ta_ext_t * ext = lv_obj_get_ext_attr(ta);
-    if(show != ext->cursor.state) {
-        ext->cursor.state = show == 0 ? 0 : 1;
-        if(ext->cursor.type != LV_CURSOR_NONE &&
-                (ext->cursor.type & LV_CURSOR_HIDDEN) == 0)
-        {
-            lv_area_t area_tmp;
-            lv_area_copy(&area_tmp, &ext->cursor.area);
-            area_tmp.x1 += ext->label->coords.x1;
-            area_tmp.y1 += ext->label->coords.y1;
-            area_tmp.x2 += ext->label->coords.x1;
-            area_tmp.y2 += ext->label->coords.y1;
-            lv_inv_area(&area_tmp);
-        }
+
+    if(blink_task == NULL) {
+        lv_ll_init(&LV_GC_ROOT(_lv_ta_blink_ll), sizeof(lv_obj_t *));
+        blink_task = lv_task_create(cursor_blink_task, LV_TA_CURSOR_BLINK_TIME, LV_TASK_PRIO_LOW, NULL);
+        lv_mem_assert(blink_task);
+        if(blink_task == NULL) return;
+    }
+
+    lv_obj_t ** ta_p = lv_ll_ins_tail(&LV_GC_ROOT(_lv_ta_blink_ll));
+    lv_mem_assert(ta_p);
+    if(ta_p == NULL) return;
+
+    *ta_p = ta;
+    ext->cursor.blink_node = ta_p;
+}
+
+/**
+ * Remove a text area from the blinking cursors. Deletes the blinker task with the last one.
+ * @param ta pointer to a text area
+ */
+static void cursor_blink_unreg(lv_obj_t * ta)
+{
+    lv_ta_ext_t * ext = lv_obj_get_ext_attr(ta);
+    if(ext->cursor.blink_node == NULL) return;
+
+    lv_ll_rem(&LV_GC_ROOT(_lv_ta_blink_ll), ext->cursor.blink_node);
+    lv_mem_free(ext->cursor.blink_node);
+    ext->cursor.blink_node = NULL;
+
+    if(lv_ll_get_head(&LV_GC_ROOT(_lv_ta_blink_ll)) == NULL && blink_task) {
+        lv_task_del(blink_task);
+        blink_task = NULL;
     }
 }
 
+/**
+ * Show the cursor and keep it visible until the next blink period
+ * @param ta pointer to a text area
+ */
+static void cursor_blink_reset(lv_obj_t * ta)
+{
+    lv_ta_ext_t * ext = lv_obj_get_ext_attr(ta);
+    ext->cursor.blink_hold = 1;
+    if(ext->cursor.state == 0) {
+        ext->cursor.state = 1;
+        inv_cursor_area(ta);
+    }
+}
 
 /**
  * Dummy function to animate char hiding in pwd mode.
@@ -1296,6 +1352,7 @@ static void refr_cursor_area(lv_obj_t * ta)
 
     lv_point_t letter_pos;
     lv_label_get_letter_pos(ext->label, cur_pos, &letter_pos);
+    lv_obj_update_coords(ext->label);
 
     /*If the cursor is out of the text (most right) draw it to the next line*/
     if(letter_pos.x + ext->label->coords.x1 + letter_w > ext->label->coords.x2 && ext->one_line == 0 && lv_label_get_align(ext->label) != LV_LABEL_ALIGN_RIGHT) {
@@ -1344,22 +1401,31 @@ static void refr_cursor_area(lv_obj_t * ta)
     }
 
     /*Save the new area*/
-    lv_area_t area_tmp;
-    lv_area_copy(&area_tmp, &ext->cursor.area);
-    area_tmp.x1 += ext->label->coords.x1;
-    area_tmp.y1 += ext->label->coords.y1;
-    area_tmp.x2 += ext->label->coords.x1;
-    area_tmp.y2 += ext->label->coords.y1;
-    lv_inv_area(&area_tmp);
-
+    inv_cursor_area(ta);
     lv_area_copy(&ext->cursor.area, &cur_area);
+    inv_cursor_area(ta);
+}
 
+/**
+ * Invalidate only the area of the cursor (if it's drawn at all)
+ * @param ta pointer to a text area
+ */
+static void inv_cursor_area(lv_obj_t * ta)
+{
+    lv_ta_ext_t * ext = lv_obj_get_ext_attr(ta);
+    if(ext->cursor.type == LV_CURSOR_NONE || (ext->cursor.type & LV_CURSOR_HIDDEN)) return;
+
+    lv_obj_update_coords(ext->label);
+
+    lv_area_t area_tmp;
     lv_area_copy(&area_tmp, &ext->cursor.area);
     area_tmp.x1 += ext->label->coords.x1;
     area_tmp.y1 += ext->label->coords.y1;
     area_tmp.x2 += ext->label->coords.x1;
     area_tmp.y2 += ext->label->coords.y1;
-    lv_inv_area(&area_tmp);
+
+    /*Clip to the text area, the cursor can be out of it when the label is scrolled*/
+    lv_obj_invalidate_area(ta, &area_tmp);
 }
 
 #endif
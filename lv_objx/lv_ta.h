@@ -72,6 +72,8 @@ typedef struct
         uint16_t txt_byte_pos;  /*Byte index of the letter after (on) the cursor*/
         lv_cursor_type_t type:4;  /*Shape of the cursor*/
         uint8_t state :1;       /*Indicates that the cursor is visible now or not (Handled by the library)*/
+        uint8_t blink_hold :1;  /*Keep the cursor visible on the next blink (Handled by the library)*/
+        void * blink_node;      /*Node in the list of the blinking cursors (Handled by the library)*/
     } cursor;
 } lv_ta_ext_t;
 
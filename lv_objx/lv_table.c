@@ -9,6 +9,7 @@
 #include "lv_table.h"
 #if USE_LV_TABLE != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_misc/lv_txt.h"
 #include "../lv_misc/lv_math.h"
 #include "../lv_draw/lv_draw_label.h"
@@ -29,6 +30,7 @@ static bool lv_table_design(lv_obj_t * table, const lv_area_t * mask, lv_design_
 static lv_res_t lv_table_signal(lv_obj_t * table, lv_signal_t sign, void * param);
 static lv_coord_t get_row_height(lv_obj_t * table, uint16_t row_id);
 static void refr_size(lv_obj_t * table);
+static const char * get_cell_txt(const char * cell_data);
 
 /**********************
  *  STATIC VARIABLES
@@ -63,7 +65,11 @@ lv_obj_t * lv_table_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_table_ext_t * ext = lv_obj_allocate_ext_attr(new_table, sizeof(lv_table_ext_t));
     lv_mem_assert(ext);
     if(ext == NULL) return NULL;
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_table);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_table);
+        lv_signal_reg(lv_table_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
     if(ancestor_scrl_design == NULL) ancestor_scrl_design = lv_obj_get_design_func(new_table);
 
     /*Initialize the allocated 'ext' */
@@ -149,6 +155,7 @@ void lv_table_set_cell_value(lv_obj_t * table, uint16_t row, uint16_t col, const
         format.type = 0;
         format.crop = 0;
     }
+    format.static_txt = 0;
 
 
     ext->cell_data[cell] = lv_mem_realloc(ext->cell_data[cell], strlen(txt) + 2);   /*+1: trailing '\0; +1: format byte*/
@@ -157,6 +164,47 @@ void lv_table_set_cell_value(lv_obj_t * table, uint16_t row, uint16_t col, const
     refr_size(table);
 }
 
+/**
+ * Set a static text as the value of a cell. It will not be saved by the table
+ * so the `txt` variable has to be 'alive' while the cell exists.
+ * @param table pointer to a Table object
+ * @param row id of the row [0 .. row_cnt -1]
+ * @param col id of the column [0 .. col_cnt -1]
+ * @param txt text to display in the cell
+ */
+void lv_table_set_cell_static_value(lv_obj_t * table, uint16_t row, uint16_t col, const char * txt)
+{
+    lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
+    if(row >= ext->row_cnt || col >= ext->col_cnt) {
+        LV_LOG_WARN("lv_table_set_cell_static_value: invalid row or column");
+        return;
+    }
+    uint32_t cell = row * ext->col_cnt + col;
+    lv_table_cell_format_t format;
+
+    /*Save the format byte*/
+    if(ext->cell_data[cell]) {
+        format.format_byte = ext->cell_data[cell][0];
+    }
+    /*Initialize the format byte*/
+    else {
+        format.align = LV_LABEL_ALIGN_LEFT;
+        format.right_merge = 0;
+        format.type = 0;
+        format.crop = 0;
+    }
+    format.static_txt = 1;
+
+    /*Store only the pointer to the text after the format byte*/
+    ext->cell_data[cell] = lv_mem_realloc(ext->cell_data[cell], sizeof(char *) + 1);    /*+1: format byte*/
+    lv_mem_assert(ext->cell_data[cell]);
+    if(ext->cell_data[cell] == NULL) return;
+
+    memcpy(&ext->cell_data[cell][1], &txt, sizeof(txt));
+    ext->cell_data[cell][0] = format.format_byte;
+    refr_size(table);
+}
+
 /**
  * Set the number of rows
  * @param table table pointer to a Table object
@@ -412,7 +460,7 @@ const char * lv_table_get_cell_value(lv_obj_t * table, uint16_t row, uint16_t co
 
     if(ext->cell_data[cell] == NULL) return "";
 
-    return &ext->cell_data[cell][1];    /*Skip the format byte*/
+    return get_cell_txt(ext->cell_data[cell]);
 }
 
 /**
@@ -675,7 +723,8 @@ static bool lv_table_design(lv_obj_t * table, const lv_area_t * mask, lv_design_
                         txt_flags = LV_TXT_FLAG_EXPAND;
                     }
 
-                    lv_txt_get_size(&txt_size, ext->cell_data[cell] + 1, cell_style->text.font,
+                    const char * cell_txt = get_cell_txt(ext->cell_data[cell]);
+                    lv_txt_get_size(&txt_size, cell_txt, cell_style->text.font,
                                               cell_style->text.letter_space, cell_style->text.line_space, lv_area_get_width(&txt_area), txt_flags);
 
                     /*Align the content to the middle if not cropped*/
@@ -701,25 +750,29 @@ static bool lv_table_design(lv_obj_t * table, const lv_area_t * mask, lv_design_
                     bool label_mask_ok;
                     label_mask_ok = lv_area_intersect(&label_mask, mask, &cell_area);
                     if(label_mask_ok) {
-                        lv_draw_label(&txt_area, &label_mask, cell_style, opa_scale, ext->cell_data[cell] + 1, txt_flags, NULL);
+                        lv_draw_label(&txt_area, &label_mask, cell_style, opa_scale, cell_txt, txt_flags, NULL);
                     }
                     /*Draw lines after '\n's*/
                     lv_point_t p1;
                     lv_point_t p2;
                     p1.x = cell_area.x1;
                     p2.x = cell_area.x2;
-                    uint16_t i;
-                    for(i = 1; ext->cell_data[cell][i] != '\0'; i++) {
-                        if(ext->cell_data[cell][i] == '\n') {
-                            ext->cell_data[cell][i] = '\0';
-                            lv_txt_get_size(&txt_size, ext->cell_data[cell] + 1, cell_style->text.font,
-                                                     cell_style->text.letter_space, cell_style->text.line_space, lv_area_get_width(&txt_area), txt_flags);
-
-                            p1.y = txt_area.y1 + txt_size.y + cell_style->text.line_space / 2;
-                            p2.y = txt_area.y1 + txt_size.y + cell_style->text.line_space / 2;
-                            lv_draw_line(&p1, &p2, mask, cell_style, opa_scale);
 
-                            ext->cell_data[cell][i] = '\n';
+                    /*Walk the lines of the text (as `lv_draw_label` breaks them) and draw a line below the ones closed by '\n'.
+                     *The text is only read so the static texts are drawn directly too.*/
+                    lv_coord_t max_w = txt_flags & LV_TXT_FLAG_EXPAND ? LV_COORD_MAX : lv_area_get_width(&txt_area);
+                    lv_coord_t line_h = lv_font_get_height(cell_style->text.font) + cell_style->text.line_space;
+                    lv_coord_t line_y = txt_area.y1 - cell_style->text.line_space + cell_style->text.line_space / 2;
+                    uint32_t line_start = 0;
+                    while(cell_txt[line_start] != '\0') {
+                        line_start += lv_txt_get_next_line(&cell_txt[line_start], cell_style->text.font,
+                                                           cell_style->text.letter_space, max_w, txt_flags);
+                        line_y += line_h;
+
+                        if(cell_txt[line_start - 1] == '\n') {
+                            p1.y = line_y;
+                            p2.y = line_y;
+                            lv_draw_line(&p1, &p2, mask, cell_style, opa_scale);
                         }
                     }
                 }
@@ -749,7 +802,7 @@ static lv_res_t lv_table_signal(lv_obj_t * table, lv_signal_t sign, void * param
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(table, sign, param);
+    res = lv_signal_call(ancestor_signal, table, sign, param);
     if(res != LV_RES_OK) return res;
 
 
@@ -763,6 +816,9 @@ static lv_res_t lv_table_signal(lv_obj_t * table, lv_signal_t sign, void * param
                 ext->cell_data[cell] = NULL;
             }
         }
+
+        lv_mem_free(ext->cell_data);
+        ext->cell_data = NULL;
     } else if(sign == LV_SIGNAL_GET_TYPE) {
         lv_obj_type_t * buf = param;
         uint8_t i;
@@ -840,7 +896,7 @@ static lv_coord_t get_row_height(lv_obj_t * table, uint16_t row_id)
             else {
                 txt_w -= 2 * cell_style->body.padding.hor;
 
-                lv_txt_get_size(&txt_size, ext->cell_data[cell] + 1, cell_style->text.font,
+                lv_txt_get_size(&txt_size, get_cell_txt(ext->cell_data[cell]), cell_style->text.font,
                         cell_style->text.letter_space, cell_style->text.line_space, txt_w, LV_TXT_FLAG_NONE);
 
                 h_max = LV_MATH_MAX(txt_size.y + 2 * cell_style->body.padding.ver, h_max);
@@ -853,4 +909,20 @@ static lv_coord_t get_row_height(lv_obj_t * table, uint16_t row_id)
     return h_max;
 }
 
+/**
+ * Get the text of a cell
+ * @param cell_data the data of a cell (not NULL)
+ * @return the text stored after the format byte or the static text referred there
+ */
+static const char * get_cell_txt(const char * cell_data)
+{
+    lv_table_cell_format_t format;
+    format.format_byte = cell_data[0];
+    if(format.static_txt == 0) return &cell_data[1];    /*Skip the format byte*/
+
+    const char * txt;
+    memcpy(&txt, &cell_data[1], sizeof(txt));
+    return txt;
+}
+
 #endif
@@ -47,6 +47,7 @@ typedef union {
         uint8_t right_merge:1;
         uint8_t type:2;
         uint8_t crop:1;
+        uint8_t static_txt:1;   /*The cell stores only a pointer to a static text after the format byte*/
     };
     uint8_t format_byte;
 }lv_table_cell_format_t;
@@ -98,6 +99,16 @@ lv_obj_t * lv_table_create(lv_obj_t * par, const lv_obj_t * copy);
  */
 void lv_table_set_cell_value(lv_obj_t * table, uint16_t row, uint16_t col, const char * txt);
 
+/**
+ * Set a static text as the value of a cell. It will not be saved by the table
+ * so the `txt` variable has to be 'alive' while the cell exists.
+ * @param table pointer to a Table object
+ * @param row id of the row [0 .. row_cnt -1]
+ * @param col id of the column [0 .. col_cnt -1]
+ * @param txt text to display in the cell
+ */
+void lv_table_set_cell_static_value(lv_obj_t * table, uint16_t row, uint16_t col, const char * txt);
+
 /**
  * Set the number of rows
  * @param table table pointer to a Table object
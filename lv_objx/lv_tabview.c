@@ -10,6 +10,7 @@
 #if USE_LV_TABVIEW != 0
 
 #include "lv_btnm.h"
+#include "../lv_core/lv_signal.h"
 #include "../lv_themes/lv_theme.h"
 #include "../lv_misc/lv_anim.h"
 
@@ -41,6 +42,7 @@ static void tabpage_pressing_handler(lv_obj_t * tabview, lv_obj_t * tabpage);
 static void tabpage_press_lost_handler(lv_obj_t * tabview, lv_obj_t * tabpage);
 static lv_res_t tab_btnm_action(lv_obj_t * tab_btnm, const char * tab_name);
 static void tabview_realign(lv_obj_t * tabview);
+static lv_obj_t * lv_tabview_add_tab_core(lv_obj_t * tabview, const char * name, bool static_name);
 
 /**********************
  *  STATIC VARIABLES
@@ -72,7 +74,14 @@ lv_obj_t * lv_tabview_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_obj_t * new_tabview = lv_obj_create(par, copy);
     lv_mem_assert(new_tabview);
     if(new_tabview == NULL) return NULL;
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_tabview);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_tabview);
+        lv_signal_reg(lv_tabview_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_CORD_CHG) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE) | LV_SIGNAL_BIT(LV_SIGNAL_FOCUS) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_DEFOCUS) | LV_SIGNAL_BIT(LV_SIGNAL_CONTROLL) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_GET_EDITABLE));
+    }
 
     /*Allocate the tab type specific extended data*/
     lv_tabview_ext_t * ext = lv_obj_allocate_ext_attr(new_tabview, sizeof(lv_tabview_ext_t));
@@ -84,6 +93,7 @@ lv_obj_t * lv_tabview_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->draging = 0;
     ext->slide_enable = 1;
     ext->tab_cur = 0;
+    ext->tab_cnt = 0;
     ext->point_last.x = 0;
     ext->point_last.y = 0;
     ext->content = NULL;
@@ -93,6 +103,7 @@ lv_obj_t * lv_tabview_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->btns_pos = LV_TABVIEW_BTNS_POS_TOP;
     ext->anim_time = LV_TABVIEW_ANIM_TIME;
     ext->btns_hide = 0;
+    ext->tab_name_static = NULL;
 
 
     /*The signal and design functions are not copied so set them here*/
@@ -104,7 +115,6 @@ lv_obj_t * lv_tabview_create(lv_obj_t * par, const lv_obj_t * copy)
         lv_mem_assert(ext->tab_name_ptr);
         if(ext->tab_name_ptr == NULL) return NULL;
         ext->tab_name_ptr[0] = "";
-        ext->tab_cnt = 0;
 
         lv_obj_set_size(new_tabview, LV_HOR_RES, LV_VER_RES);
 
@@ -163,7 +173,11 @@ lv_obj_t * lv_tabview_create(lv_obj_t * par, const lv_obj_t * copy)
         lv_obj_t * new_tab;
         lv_obj_t * copy_tab;
         for(i = 0; i < copy_ext->tab_cnt; i++) {
-            new_tab = lv_tabview_add_tab(new_tabview, copy_ext->tab_name_ptr[i]);
+            if(copy_ext->tab_name_static && copy_ext->tab_name_static[i]) {
+                new_tab = lv_tabview_add_static_tab(new_tabview, copy_ext->tab_name_ptr[i]);
+            } else {
+                new_tab = lv_tabview_add_tab(new_tabview, copy_ext->tab_name_ptr[i]);
+            }
             copy_tab = lv_tabview_get_tab(copy, i);
             lv_page_set_style(new_tab, LV_PAGE_STYLE_BG, lv_page_get_style(copy_tab, LV_PAGE_STYLE_BG));
             lv_page_set_style(new_tab, LV_PAGE_STYLE_SCRL, lv_page_get_style(copy_tab, LV_PAGE_STYLE_SCRL));
@@ -202,59 +216,20 @@ void lv_tabview_clean(lv_obj_t * obj)
  */
 lv_obj_t * lv_tabview_add_tab(lv_obj_t * tabview, const char * name)
 {
-    lv_tabview_ext_t  * ext = lv_obj_get_ext_attr(tabview);
-
-    /*Create the container page*/
-    lv_obj_t * h = lv_page_create(ext->content, NULL);
-    lv_obj_set_size(h, lv_obj_get_width(tabview), lv_obj_get_height(ext->content));
-    lv_page_set_sb_mode(h, LV_SB_MODE_AUTO);
-    lv_page_set_style(h, LV_PAGE_STYLE_BG, &lv_style_transp);
-    lv_page_set_style(h, LV_PAGE_STYLE_SCRL, &lv_style_transp);
-
-    if(page_signal == NULL) page_signal = lv_obj_get_signal_func(h);
-    if(page_scrl_signal == NULL) page_scrl_signal = lv_obj_get_signal_func(lv_page_get_scrl(h));
-    lv_obj_set_signal_func(h, tabpage_signal);
-    lv_obj_set_signal_func(lv_page_get_scrl(h), tabpage_scrl_signal);
-
-    /*Extend the button matrix map with the new name*/
-    char * name_dm;
-    if((name[0] & LV_BTNM_CTRL_MASK) == LV_BTNM_CTRL_CODE) { /*If control byte presented let is*/
-        name_dm = lv_mem_alloc(strlen(name) + 1); /*+1 for the the closing '\0' */
-        lv_mem_assert(name_dm);
-        if(name_dm == NULL) return NULL;
-        strcpy(name_dm, name);
-    } else { /*Set a no long press control byte is not presented*/
-        name_dm = lv_mem_alloc(strlen(name) + 2); /*+1 for the the closing '\0' and +1 for the control byte */
-        lv_mem_assert(name_dm);
-        if(name_dm == NULL) return NULL;
-        name_dm[0] = '\221';
-        strcpy(&name_dm[1], name);
-    }
-
-    ext->tab_cnt++;
-    ext->tab_name_ptr = lv_mem_realloc(ext->tab_name_ptr, sizeof(char *) * (ext->tab_cnt + 1));
-    lv_mem_assert(ext->tab_name_ptr);
-    if(ext->tab_name_ptr == NULL) return NULL;
-
-    ext->tab_name_ptr[ext->tab_cnt - 1] = name_dm;
-    ext->tab_name_ptr[ext->tab_cnt] = "";
-
-    lv_btnm_set_map(ext->btns, ext->tab_name_ptr);
-
-    /*Modify the indicator size*/
-    lv_style_t * style_tabs = lv_obj_get_style(ext->btns);
-    lv_coord_t indic_width = (lv_obj_get_width(tabview) - style_tabs->body.padding.inner * (ext->tab_cnt - 1) - 2 * style_tabs->body.padding.hor) / ext->tab_cnt;
-    lv_obj_set_width(ext->indic, indic_width);
-    lv_obj_set_x(ext->indic, indic_width * ext->tab_cur + style_tabs->body.padding.inner * ext->tab_cur + style_tabs->body.padding.hor);
-
-    /*Set the first btn as active*/
-    if(ext->tab_cnt == 1) {
-        ext->tab_cur = 0;
-        lv_tabview_set_tab_act(tabview, 0, false);
-        tabview_realign(tabview);       /*To set the proper btns height*/
-    }
+    return lv_tabview_add_tab_core(tabview, name, false);
+}
 
-    return h;
+/**
+ * Add a new tab with a static name. The name will not be saved by the Tab view
+ * so the `name` variable has to be 'alive' while the Tab view exists.
+ * (Start the name with `\221` to disable the long press of the tab button as with `lv_tabview_add_tab`)
+ * @param tabview pointer to Tab view object where to ass the new tab
+ * @param name the text on the tab button
+ * @return pointer to the created page object (lv_page). You can create your content here
+ */
+lv_obj_t * lv_tabview_add_static_tab(lv_obj_t * tabview, const char * name)
+{
+    return lv_tabview_add_tab_core(tabview, name, true);
 }
 
 /*=====================
@@ -471,17 +446,8 @@ uint16_t lv_tabview_get_tab_count(const lv_obj_t * tabview)
 lv_obj_t * lv_tabview_get_tab(const lv_obj_t * tabview, uint16_t id)
 {
     lv_tabview_ext_t * ext = lv_obj_get_ext_attr(tabview);
-    uint16_t i = 0;
-    lv_obj_t * page = lv_obj_get_child_back(ext->content, NULL);
-
-    while(page != NULL && i != id) {
-        i++;
-        page = lv_obj_get_child_back(ext->content, page);
-    }
-
-    if(i == id) return page;
 
-    return NULL;
+    return lv_obj_get_child_by_id(ext->content, id);
 }
 
 /**
@@ -581,6 +547,82 @@ bool lv_tabview_get_btns_hidden(const lv_obj_t *tabview)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Add a new tab with the given name
+ * @param tabview pointer to Tab view object where to ass the new tab
+ * @param name the text on the tab button
+ * @param static_name true: refer to `name` as a static text; false: save a copy of `name`
+ * @return pointer to the created page object (lv_page)
+ */
+static lv_obj_t * lv_tabview_add_tab_core(lv_obj_t * tabview, const char * name, bool static_name)
+{
+    lv_tabview_ext_t  * ext = lv_obj_get_ext_attr(tabview);
+
+    /*Create the container page*/
+    lv_obj_t * h = lv_page_create(ext->content, NULL);
+    lv_obj_set_size(h, lv_obj_get_width(tabview), lv_obj_get_height(ext->content));
+    lv_page_set_sb_mode(h, LV_SB_MODE_AUTO);
+    lv_page_set_style(h, LV_PAGE_STYLE_BG, &lv_style_transp);
+    lv_page_set_style(h, LV_PAGE_STYLE_SCRL, &lv_style_transp);
+
+    if(page_signal == NULL) page_signal = lv_obj_get_signal_func(h);
+    if(page_scrl_signal == NULL) page_scrl_signal = lv_obj_get_signal_func(lv_page_get_scrl(h));
+    lv_obj_set_signal_func(h, tabpage_signal);
+    lv_obj_set_signal_func(lv_page_get_scrl(h), tabpage_scrl_signal);
+
+    /*Extend the button matrix map with the new name*/
+    char * name_dm;
+    if(static_name) {
+        name_dm = (char *)name;
+    } else if((name[0] & LV_BTNM_CTRL_MASK) == LV_BTNM_CTRL_CODE) { /*If control byte presented let is*/
+        name_dm = lv_mem_alloc(strlen(name) + 1); /*+1 for the the closing '\0' */
+        lv_mem_assert(name_dm);
+        if(name_dm == NULL) return NULL;
+        strcpy(name_dm, name);
+    } else { /*Set a no long press control byte is not presented*/
+        name_dm = lv_mem_alloc(strlen(name) + 2); /*+1 for the the closing '\0' and +1 for the control byte */
+        lv_mem_assert(name_dm);
+        if(name_dm == NULL) return NULL;
+        name_dm[0] = '\221';
+        strcpy(&name_dm[1], name);
+    }
+
+    ext->tab_cnt++;
+    ext->tab_name_ptr = lv_mem_realloc(ext->tab_name_ptr, sizeof(char *) * (ext->tab_cnt + 1));
+    lv_mem_assert(ext->tab_name_ptr);
+    if(ext->tab_name_ptr == NULL) return NULL;
+
+    ext->tab_name_ptr[ext->tab_cnt - 1] = name_dm;
+    ext->tab_name_ptr[ext->tab_cnt] = "";
+
+    /*Mark the static names to not free them. Allocate the flags only when the first static name is added.*/
+    if(static_name || ext->tab_name_static) {
+        uint8_t * flags_new = lv_mem_realloc(ext->tab_name_static, ext->tab_cnt);
+        lv_mem_assert(flags_new);
+        if(flags_new == NULL) return NULL;
+        if(ext->tab_name_static == NULL) memset(flags_new, 0, ext->tab_cnt);
+        ext->tab_name_static = flags_new;
+        ext->tab_name_static[ext->tab_cnt - 1] = static_name ? 1 : 0;
+    }
+
+    lv_btnm_set_map(ext->btns, ext->tab_name_ptr);
+
+    /*Modify the indicator size*/
+    lv_style_t * style_tabs = lv_obj_get_style(ext->btns);
+    lv_coord_t indic_width = (lv_obj_get_width(tabview) - style_tabs->body.padding.inner * (ext->tab_cnt - 1) - 2 * style_tabs->body.padding.hor) / ext->tab_cnt;
+    lv_obj_set_width(ext->indic, indic_width);
+    lv_obj_set_x(ext->indic, indic_width * ext->tab_cur + style_tabs->body.padding.inner * ext->tab_cur + style_tabs->body.padding.hor);
+
+    /*Set the first btn as active*/
+    if(ext->tab_cnt == 1) {
+        ext->tab_cur = 0;
+        lv_tabview_set_tab_act(tabview, 0, false);
+        tabview_realign(tabview);       /*To set the proper btns height*/
+    }
+
+    return h;
+}
+
 /**
  * Signal function of the Tab view
  * @param tabview pointer to a Tab view object
@@ -593,16 +635,21 @@ static lv_res_t lv_tabview_signal(lv_obj_t * tabview, lv_signal_t sign, void * p
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(tabview, sign, param);
+    res = lv_signal_call(ancestor_signal, tabview, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_tabview_ext_t * ext = lv_obj_get_ext_attr(tabview);
     if(sign == LV_SIGNAL_CLEANUP) {
-        uint8_t i;
-        for(i = 0; ext->tab_name_ptr[i][0] != '\0'; i++) lv_mem_free(ext->tab_name_ptr[i]);
+        uint16_t i;
+        for(i = 0; i < ext->tab_cnt; i++) {
+            if(ext->tab_name_static && ext->tab_name_static[i]) continue;
+            lv_mem_free(ext->tab_name_ptr[i]);
+        }
 
         lv_mem_free(ext->tab_name_ptr);
         ext->tab_name_ptr = NULL;
+        lv_mem_free(ext->tab_name_static);
+        ext->tab_name_static = NULL;
         ext->btns = NULL;     /*These objects were children so they are already invalid*/
         ext->content = NULL;
     } else if(sign == LV_SIGNAL_CORD_CHG) {
@@ -615,7 +662,7 @@ static lv_res_t lv_tabview_signal(lv_obj_t * tabview, lv_signal_t sign, void * p
         /* The button matrix is not in a group (the tab view is in it) but it should handle the group signals.
          * So propagate the related signals to the button matrix manually*/
         if(ext->btns) {
-            ext->btns->signal_func(ext->btns, sign, param);
+            lv_signal_send(ext->btns, sign, param);
         }
         if(sign == LV_SIGNAL_FOCUS) {
             lv_hal_indev_type_t indev_type = lv_indev_get_type(lv_indev_get_act());
@@ -663,7 +710,7 @@ static lv_res_t tabpage_signal(lv_obj_t * tab_page, lv_signal_t sign, void * par
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = page_signal(tab_page, sign, param);
+    res = lv_signal_call(page_signal, tab_page, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_obj_t * cont = lv_obj_get_parent(tab_page);
@@ -693,7 +740,7 @@ static lv_res_t tabpage_scrl_signal(lv_obj_t * tab_scrl, lv_signal_t sign, void
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = page_scrl_signal(tab_scrl, sign, param);
+    res = lv_signal_call(page_scrl_signal, tab_scrl, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_obj_t * tab_page = lv_obj_get_parent(tab_scrl);
@@ -760,6 +807,7 @@ static void tabpage_pressing_handler(lv_obj_t * tabview, lv_obj_t * tabpage)
         lv_coord_t indic_width = lv_obj_get_width(ext->indic);
         lv_style_t * tabs_style = lv_obj_get_style(ext->btns);
         lv_style_t * indic_style = lv_obj_get_style(ext->indic);
+        lv_obj_update_coords(tabpage);
         lv_coord_t p = ((tabpage->coords.x1 - tabview->coords.x1) * (indic_width + tabs_style->body.padding.inner)) / lv_obj_get_width(tabview);
 
         lv_obj_set_x(ext->indic, indic_width * ext->tab_cur + tabs_style->body.padding.inner * ext->tab_cur + indic_style->body.padding.hor - p);
@@ -791,6 +839,7 @@ static void tabpage_press_lost_handler(lv_obj_t * tabview, lv_obj_t * tabpage)
         vect.x = vect.x * (100 - LV_INDEV_DRAG_THROW) / 100;
     }
 
+    lv_obj_update_coords(tabpage);
     lv_coord_t page_x1 = tabpage->coords.x1 - tabview->coords.x1 + x_predict;
     lv_coord_t page_x2 = page_x1 + lv_obj_get_width(tabpage);
     lv_coord_t treshold = lv_obj_get_width(tabview) / 2;
@@ -62,6 +62,7 @@ typedef struct
     lv_obj_t * indic;
     lv_obj_t * content;   /*A rectangle to show the current tab*/
     const char ** tab_name_ptr;
+    uint8_t * tab_name_static;  /*1 for the tabs with static name. NULL if there are no static names*/
     lv_point_t point_last;
     uint16_t tab_cur;
     uint16_t tab_cnt;
@@ -116,6 +117,16 @@ void lv_tabview_clean(lv_obj_t *obj);
  */
 lv_obj_t * lv_tabview_add_tab(lv_obj_t * tabview, const char * name);
 
+/**
+ * Add a new tab with a static name. The name will not be saved by the Tab view
+ * so the `name` variable has to be 'alive' while the Tab view exists.
+ * (Start the name with `\221` to disable the long press of the tab button as with `lv_tabview_add_tab`)
+ * @param tabview pointer to Tab view object where to ass the new tab
+ * @param name the text on the tab button
+ * @return pointer to the created page object (lv_page). You can create your content here
+ */
+lv_obj_t * lv_tabview_add_static_tab(lv_obj_t * tabview, const char * name);
+
 /*=====================
  * Setter functions
  *====================*/
@@ -11,6 +11,7 @@
 
 #include <stdbool.h>
 #include "lv_cont.h"
+#include "../lv_core/lv_signal.h"
 #include "../lv_themes/lv_theme.h"
 
 /*********************
@@ -72,8 +73,16 @@ lv_obj_t * lv_tileview_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_tileview_ext_t * ext = lv_obj_allocate_ext_attr(new_tileview, sizeof(lv_tileview_ext_t));
     lv_mem_assert(ext);
     if(ext == NULL) return NULL;
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_tileview);
-    if(ancestor_scrl_signal == NULL) ancestor_scrl_signal = lv_obj_get_signal_func(lv_page_get_scrl(new_tileview));
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_tileview);
+        lv_signal_reg(lv_tileview_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
+    if(ancestor_scrl_signal == NULL) {
+        ancestor_scrl_signal = lv_obj_get_signal_func(lv_page_get_scrl(new_tileview));
+        lv_signal_reg(lv_tileview_scrl_signal, ancestor_scrl_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CORD_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE));
+    }
     if(ancestor_design == NULL) ancestor_design = lv_obj_get_design_func(new_tileview);
 
     /*Initialize the allocated 'ext' */
@@ -299,7 +308,7 @@ static lv_res_t lv_tileview_signal(lv_obj_t * tileview, lv_signal_t sign, void *
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(tileview, sign, param);
+    res = lv_signal_call(ancestor_signal, tileview, sign, param);
     if(res != LV_RES_OK) return res;
 
 
@@ -330,7 +339,7 @@ static lv_res_t lv_tileview_scrl_signal(lv_obj_t * scrl, lv_signal_t sign, void
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_scrl_signal(scrl, sign, param);
+    res = lv_signal_call(ancestor_scrl_signal, scrl, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_obj_t * tileview = lv_obj_get_parent(scrl);
@@ -442,7 +451,7 @@ static lv_res_t element_signal_func(lv_obj_t * element, lv_signal_t sign, void *
 
     /* Include the ancient signal function */
     lv_signal_func_t sign_func = lv_obj_get_free_ptr(element);
-    res = sign_func(element, sign, param);
+    res = lv_signal_call(sign_func, element, sign, param);
     if(res != LV_RES_OK) return res;
 
     /*Initialize some variables on PRESS*/
@@ -485,7 +494,7 @@ static lv_res_t element_signal_func(lv_obj_t * element, lv_signal_t sign, void *
                     if(drag_obj == NULL) break;
                 }
                 indev->proc.drag_in_prog = 0;
-                if(drag_obj) drag_obj->signal_func(drag_obj, LV_SIGNAL_DRAG_END, NULL);
+                if(drag_obj) lv_signal_send(drag_obj, LV_SIGNAL_DRAG_END, NULL);
             }
 
              drag_end_handler(tileview);
@@ -508,6 +517,7 @@ static void drag_end_handler(lv_obj_t * tileview)
     lv_obj_t * scrl = lv_page_get_scrl(tileview);
     lv_point_t p;
 
+    lv_obj_update_coords(scrl);
     p.x = - (scrl->coords.x1 - LV_HOR_RES / 2);
     p.y = - (scrl->coords.y1 - LV_VER_RES / 2);
 
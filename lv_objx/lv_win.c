@@ -9,6 +9,7 @@
 #include "lv_win.h"
 #if USE_LV_WIN != 0
 
+#include "../lv_core/lv_signal.h"
 #include "../lv_themes/lv_theme.h"
 
 /*********************
@@ -53,7 +54,13 @@ lv_obj_t * lv_win_create(lv_obj_t * par, const lv_obj_t * copy)
     lv_mem_assert(new_win);
     if(new_win == NULL) return NULL;
 
-    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_func(new_win);
+    if(ancestor_signal == NULL) {
+        ancestor_signal = lv_obj_get_signal_func(new_win);
+        lv_signal_reg(lv_win_signal, ancestor_signal,
+                      LV_SIGNAL_BIT(LV_SIGNAL_CLEANUP) | LV_SIGNAL_BIT(LV_SIGNAL_CHILD_CHG) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_CORD_CHG) | LV_SIGNAL_BIT(LV_SIGNAL_STYLE_CHG) |
+                      LV_SIGNAL_BIT(LV_SIGNAL_GET_TYPE) | LV_SIGNAL_BIT(LV_SIGNAL_CONTROLL));
+    }
 
     /*Allocate the object type specific extended data*/
     lv_win_ext_t * ext = lv_obj_allocate_ext_attr(new_win, sizeof(lv_win_ext_t));
@@ -472,7 +479,7 @@ static lv_res_t lv_win_signal(lv_obj_t * win, lv_signal_t sign, void * param)
     lv_res_t res;
 
     /* Include the ancient signal function */
-    res = ancestor_signal(win, sign, param);
+    res = lv_signal_call(ancestor_signal, win, sign, param);
     if(res != LV_RES_OK) return res;
 
     lv_win_ext_t * ext = lv_obj_get_ext_attr(win);
@@ -505,7 +512,7 @@ static lv_res_t lv_win_signal(lv_obj_t * win, lv_signal_t sign, void * param)
         ext->title = NULL;
     } else if(sign == LV_SIGNAL_CONTROLL) {
         /*Forward all the control signals to the page*/
-        ext->page->signal_func(ext->page, sign, param);
+        lv_signal_send(ext->page, sign, param);
     } else if(sign == LV_SIGNAL_GET_TYPE) {
         lv_obj_type_t * buf = param;
         uint8_t i;
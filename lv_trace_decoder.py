@@ -0,0 +1,84 @@
+'''
+Convert a binary trace dump (written by `lv_trace_dump()`) to Chrome trace JSON.
+Open the result in chrome://tracing or https://ui.perfetto.dev
+
+Usage: python lv_trace_decoder.py trace.bin [trace.json]
+'''
+
+import sys
+import struct
+import json
+
+MAGIC = 0x5254564C
+HEADER_FMT = '<IHHII'
+REC_FMT = '<IiHBB'
+
+EVT_NAMES = {
+  1: 'refr',
+  2: 'refr_area',
+  3: 'design',
+  4: 'task',
+  5: 'flush',
+  6: 'indev_read',
+}
+EVT_USER = 0x100
+
+PHASES = {0: 'B', 1: 'E', 2: 'i'}
+
+def evt_name(evt):
+  if evt in EVT_NAMES: return EVT_NAMES[evt]
+  if evt >= EVT_USER: return 'user_' + str(evt - EVT_USER)
+  return 'evt_' + str(evt)
+
+def decode(data):
+  header_size = struct.calcsize(HEADER_FMT)
+  magic, version, rec_size, rec_cnt, time_freq = struct.unpack_from(HEADER_FMT, data, 0)
+  if magic != MAGIC: raise ValueError('Not an lv_trace dump (bad magic)')
+  if version != 1: raise ValueError('Unsupported lv_trace version: ' + str(version))
+  if time_freq == 0: time_freq = 1000
+
+  events = []
+  open_spans = {}
+  offset = header_size
+  time_last = None
+  time_high = 0
+  for i in range(rec_cnt):
+    if offset + rec_size > len(data): break      #Truncated dump
+    time, payload, evt, phase, _ = struct.unpack_from(REC_FMT, data, offset)
+    offset += rec_size
+
+    #The 32 bit time stamp can overflow. Assume the records are in order.
+    if time_last is not None and time < time_last: time_high += 1 << 32
+    time_last = time
+
+    #The beginning of the oldest spans can be overwritten in the ring buffer. Skip their ends.
+    if phase == 0: open_spans[evt] = open_spans.get(evt, 0) + 1
+    elif phase == 1:
+      if open_spans.get(evt, 0) == 0: continue
+      open_spans[evt] -= 1
+
+    ev = {
+      'name': evt_name(evt),
+      'ph': PHASES.get(phase, 'i'),
+      'ts': (time_high + time) * 1000000.0 / time_freq,
+      'pid': 0,
+      'tid': 0,
+      'args': {'payload': payload},
+    }
+    if ev['ph'] == 'i': ev['s'] = 't'
+    events.append(ev)
+
+  return {'traceEvents': events, 'displayTimeUnit': 'ms'}
+
+if __name__ == '__main__':
+  if len(sys.argv) < 2:
+    print(__doc__)
+    sys.exit(1)
+
+  fin = open(sys.argv[1], 'rb')
+  result = decode(fin.read())
+  fin.close()
+
+  if len(sys.argv) > 2: fout = open(sys.argv[2], 'w')
+  else: fout = sys.stdout
+  json.dump(result, fout, indent = 1)
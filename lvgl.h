@@ -17,6 +17,7 @@ extern "C" {
 #include "lv_version.h"
 
 #include "lv_misc/lv_log.h"
+#include "lv_misc/lv_trace.h"
 #include "lv_misc/lv_task.h"
 
 #include "lv_hal/lv_hal.h"
@@ -24,6 +25,9 @@ extern "C" {
 #include "lv_core/lv_obj.h"
 #include "lv_core/lv_group.h"
 #include "lv_core/lv_lang.h"
+#include "lv_core/lv_signal.h"
+#include "lv_core/lv_overlay.h"
+#include "lv_core/lv_quality.h"
 #include "lv_core/lv_vdb.h"
 #include "lv_core/lv_refr.h"
 